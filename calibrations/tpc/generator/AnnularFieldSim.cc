@@ -20,10 +20,14 @@
 #include <boost/format.hpp>
 
 #include <cassert>  // for assert
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <vector>
 
 #define ALMOST_ZERO 0.00001
 
@@ -1545,6 +1549,12 @@ void AnnularFieldSim::populate_fieldmap()
   unsigned long long percent = totalelements / 100 * debug_npercent;
   std::cout << boost::str(boost::format("total elements = %llu") % (totalelements * nr * nphi * nz)) << std::endl;
 
+  if (lookupCase == PhiSlice)
+  {
+    populate_phislice_fieldmap();
+    return;
+  }
+
   int el = 0;
 
   TVector3 localF;  // holder for the summed field at the current position.
@@ -1571,6 +1581,100 @@ void AnnularFieldSim::populate_fieldmap()
   return;
 }
 
+void AnnularFieldSim::populate_phislice_fieldmap()
+{
+  // same sum as sum_phislice_field_at for every cell of the roi, reorganized for speed:
+  //  - each (r,z) target slice of Epartial_phislice is copied once into flat x,y,z arrays, with the self-to-self entry zeroed,
+  //  - every target phi in that slice sees the same unit fields with a shifted source phi, so the rotation is applied once to the sum instead of to every term,
+  //  - the innermost loop runs over contiguous source z, and the slices are spread over n_threads.
+  int nsource = nr * nphi * nz;
+  std::vector<double> qflat(nsource);
+  for (int ir = 0; ir < nr; ir++)
+  {
+    for (int iphi = 0; iphi < nphi; iphi++)
+    {
+      for (int iz = 0; iz < nz; iz++)
+      {
+        qflat[(ir * nphi + iphi) * nz + iz] = q->GetChargeInBin(ir, iphi, iz);
+      }
+    }
+  }
+
+  int nslices = nr_roi * nz_roi;
+  int slicesdone = 0;
+  int percent = std::max(1, nslices / 100 * debug_npercent);
+
+#pragma omp parallel num_threads(n_threads)
+  {
+    std::vector<double> ex(nsource);
+    std::vector<double> ey(nsource);
+    std::vector<double> ez(nsource);
+
+#pragma omp for schedule(dynamic)
+    for (int islice = 0; islice < nslices; islice++)
+    {
+      int ir_roi = islice / nz_roi;
+      int iz_roi = islice % nz_roi;
+      const TVector3 *slice = Epartial_phislice->GetPtr(ir_roi, 0, iz_roi, 0, 0, 0);
+      for (int i = 0; i < nsource; i++)
+      {
+        ex[i] = slice[i].X();
+        ey[i] = slice[i].Y();
+        ez[i] = slice[i].Z();
+      }
+      // dont' compute self-to-self field.  the target is at relative phi zero in its own slice:
+      int self = ((ir_roi + rmin_roi) * nphi + 0) * nz + (iz_roi + zmin_roi);
+      ex[self] = 0;
+      ey[self] = 0;
+      ez[self] = 0;
+
+      TVector3 slicepos = GetRoiCellCenter(ir_roi, 0, iz_roi);
+      for (int iphi = phimin_roi; iphi < phimax_roi; iphi++)
+      {
+        double sumx = 0;
+        double sumy = 0;
+        double sumz = 0;
+        for (int ir = 0; ir < nr; ir++)
+        {
+          for (int iophi = 0; iophi < nphi; iophi++)
+          {
+            int phirel = (iophi - iphi < 0) ? iophi - iphi + nphi : iophi - iphi;
+            const double *qrow = &qflat[(ir * nphi + iophi) * nz];
+            const double *exrow = &ex[(ir * nphi + phirel) * nz];
+            const double *eyrow = &ey[(ir * nphi + phirel) * nz];
+            const double *ezrow = &ez[(ir * nphi + phirel) * nz];
+#pragma omp simd reduction(+ : sumx, sumy, sumz)
+            for (int iz = 0; iz < nz; iz++)
+            {
+              sumx += exrow[iz] * qrow[iz];
+              sumy += eyrow[iz] * qrow[iz];
+              sumz += ezrow[iz] * qrow[iz];
+            }
+          }
+        }
+        TVector3 localF(sumx, sumy, sumz);
+        TVector3 pos = GetRoiCellCenter(ir_roi, iphi - phimin_roi, iz_roi);
+        float rotphi = pos.Phi() - slicepos.Phi();
+        localF.RotateZ(rotphi);
+        localF += Eexternal->Get(ir_roi, iphi - phimin_roi, iz_roi);
+        Efield->Set(ir_roi, iphi - phimin_roi, iz_roi, localF);  // sets in roi coordinates.
+      }
+
+#pragma omp critical(phislice_fieldmap_progress)
+      {
+        slicesdone++;
+        if (!(slicesdone % percent))
+        {
+          TVector3 localF = Efield->Get(ir_roi, 0, iz_roi);
+          std::cout << boost::str(boost::format("populate_fieldmap %d/%d slices:  ") % slicesdone % nslices);
+          std::cout << boost::str(boost::format("field at (ir=%d,iphi=%d,iz=%d) is (%E,%E,%E)") % (ir_roi + rmin_roi) % phimin_roi % (iz_roi + zmin_roi) % localF.X() % localF.Y() % localF.Z()) << std::endl;
+        }
+      }
+    }
+  }
+  return;
+}
+
 void AnnularFieldSim::populate_lookup()
 {
   // with 'f' being the position the field is being measured at, and 'o' being the position of the charge generating the field.
@@ -1951,59 +2055,164 @@ void AnnularFieldSim::populate_phislice_lookup()
   totalelements *= nz;
   totalelements *= nr_roi;
   totalelements *= nz_roi;  // breaking up this multiplication prevents a 32bit math overflow
-  unsigned long long percent = totalelements / 100 * debug_npercent;
   std::cout << boost::str(boost::format("total elements = %llu") % totalelements) << std::endl;
-  TVector3 at(1, 0, 0);
-  TVector3 from(1, 0, 0);
   TVector3 zero(0, 0, 0);
 
-  int el = 0;
-  for (int ifr = rmin_roi; ifr < rmax_roi; ifr++)
+  // each (r,z) target cell of the slice is one independent block of nr*nphi*nz sources, which is the unit of work for the threads and for the checkpoint.
+  int nslices = nr_roi * nz_roi;
+  std::vector<char> done(nslices, 0);
+  std::ofstream checkpoint;
+  if (!lookup_checkpoint.empty())
   {
-    for (int ifz = zmin_roi; ifz < zmax_roi; ifz++)
+    int nloaded = read_phislice_checkpoint(done);
+    if (nloaded < 0)
     {
-      at = GetCellCenter(ifr, 0, ifz);
-      for (int ior = 0; ior < nr; ior++)
+      std::cout << boost::str(boost::format("populate_phislice_lookup: starting new checkpoint file %s") % lookup_checkpoint) << std::endl;
+      checkpoint.open(lookup_checkpoint, std::ios::binary | std::ios::trunc);
+      int header[8] = {nr, nphi, nz, rmin_roi, rmax_roi, zmin_roi, zmax_roi, (green == nullptr) ? 0 : 1};
+      float fheader[5] = {rmin, rmax, zmin, zmax, green_shift};
+      checkpoint.write(reinterpret_cast<const char *>(header), sizeof(header));
+      checkpoint.write(reinterpret_cast<const char *>(fheader), sizeof(fheader));
+    }
+    else
+    {
+      std::cout << boost::str(boost::format("populate_phislice_lookup: resumed %d of %d slices from %s") % nloaded % nslices % lookup_checkpoint) << std::endl;
+      checkpoint.open(lookup_checkpoint, std::ios::binary | std::ios::app);
+    }
+    if (!checkpoint)
+    {
+      std::cout << boost::str(boost::format("populate_phislice_lookup: can't write checkpoint file %s") % lookup_checkpoint) << std::endl;
+      exit(1);
+    }
+  }
+
+  int slicesdone = std::count(done.begin(), done.end(), 1);
+  int slicesloaded = slicesdone;
+  int percent = std::max(1, nslices / 100 * debug_npercent);
+  std::vector<double> record(3 * nr * nphi * nz);
+  auto start = std::chrono::steady_clock::now();
+
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+  for (int islice = 0; islice < nslices; islice++)
+  {
+    if (done[islice])
+    {
+      continue;
+    }
+    int ifr = rmin_roi + islice / nz_roi;
+    int ifz = zmin_roi + islice % nz_roi;
+    TVector3 at = GetCellCenter(ifr, 0, ifz);
+    for (int ior = 0; ior < nr; ior++)
+    {
+      for (int iophi = 0; iophi < nphi; iophi++)
       {
-        for (int iophi = 0; iophi < nphi; iophi++)
+        for (int ioz = 0; ioz < nz; ioz++)
         {
-          for (int ioz = 0; ioz < nz; ioz++)
+          //*f[ifx][ify][ifz][iox][ioy][ioz]=cacl_unit_field(at,from);
+          if (ifr == ior && 0 == iophi && ifz == ioz)
           {
-            el++;
-            from = GetCellCenter(ior, iophi, ioz);
-            //*f[ifx][ify][ifz][iox][ioy][ioz]=cacl_unit_field(at,from);
-            // print_need_cout("calc_unit_field...\n");
-            if (ifr == ior && 0 == iophi && ifz == ioz)
-            {
-              if (!(el % percent))
-              {
-                std::cout << boost::str(boost::format("populate_phislice_lookup %llu%%:  ") % ((uint64_t) (debug_npercent) *el / percent));
-                std::cout << boost::str(boost::format("self-to-self is zero (ir=%d,iphi=%d,iz=%d) to (or=%d,ophi=0,oz=%d) gives (%E,%E,%E)") % ior % iophi % ioz % ifr % ifz % zero.X() % zero.Y() % zero.Z()) << std::endl;
-              }
-              Epartial_phislice->Set(ifr - rmin_roi, 0, ifz - zmin_roi, ior, iophi, ioz, zero);
-            }
-            else
-            {
-              TVector3 unitf = calc_unit_field(at, from);
-              if (true)
-              {
-                if (!(el % percent))
-                {
-                  std::cout << boost::str(boost::format("populate_phislice_lookup %llu%%:  ") % ((uint64_t) (debug_npercent) *el / percent));
-                  std::cout << boost::str(boost::format("calc_unit_field (ir=%d,iphi=%d,iz=%d) to (or=%d,ophi=0,oz=%d) gives (%E,%E,%E)") % ior % iophi % ioz % ifr % ifz % unitf.X() % unitf.Y() % unitf.Z()) << std::endl;
-                }
-              }
-
-              Epartial_phislice->Set(ifr - rmin_roi, 0, ifz - zmin_roi, ior, iophi, ioz, unitf);  // the origin phi is relative to zero anyway.
-            }
+            Epartial_phislice->Set(ifr - rmin_roi, 0, ifz - zmin_roi, ior, iophi, ioz, zero);
           }
+          else
+          {
+            Epartial_phislice->Set(ifr - rmin_roi, 0, ifz - zmin_roi, ior, iophi, ioz, calc_unit_field(at, GetCellCenter(ior, iophi, ioz)));  // the origin phi is relative to zero anyway.
+          }
+        }
+      }
+    }
+
+#pragma omp critical(phislice_lookup_progress)
+    {
+      if (checkpoint.is_open())
+      {
+        TVector3 *slice = Epartial_phislice->GetPtr(ifr - rmin_roi, 0, ifz - zmin_roi, 0, 0, 0);
+        for (int i = 0; i < nr * nphi * nz; i++)
+        {
+          record[3 * i] = slice[i].X();
+          record[3 * i + 1] = slice[i].Y();
+          record[3 * i + 2] = slice[i].Z();
         }
+        checkpoint.write(reinterpret_cast<const char *>(&islice), sizeof(islice));
+        checkpoint.write(reinterpret_cast<const char *>(record.data()), record.size() * sizeof(double));
+        checkpoint.flush();
+      }
+      slicesdone++;
+      if (!(slicesdone % percent))
+      {
+        TVector3 unitf = Epartial_phislice->Get(ifr - rmin_roi, 0, ifz - zmin_roi, nr - 1, nphi - 1, nz - 1);
+        std::cout << boost::str(boost::format("populate_phislice_lookup %d/%d slices:  ") % slicesdone % nslices);
+        std::cout << boost::str(boost::format("calc_unit_field (ir=%d,iphi=%d,iz=%d) to (or=%d,ophi=0,oz=%d) gives (%E,%E,%E)") % (nr - 1) % (nphi - 1) % (nz - 1) % ifr % ifz % unitf.X() % unitf.Y() % unitf.Z()) << std::endl;
       }
     }
   }
+  std::cout << boost::str(boost::format("populate_phislice_lookup computed %d slices in %.1f s with %d threads")
+                          % (nslices - slicesloaded) % std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() % n_threads)
+            << std::endl;
   return;
 }
 
+int AnnularFieldSim::read_phislice_checkpoint(std::vector<char> &done)
+{
+  // reads back the slices a previous populate_phislice_lookup appended to lookup_checkpoint.
+  // returns the number of slices loaded, or -1 if there is no checkpoint yet.
+  std::ifstream input(lookup_checkpoint, std::ios::binary);
+  if (!input)
+  {
+    return -1;
+  }
+
+  int header[8] = {0};
+  float fheader[5] = {0};
+  input.read(reinterpret_cast<char *>(header), sizeof(header));
+  input.read(reinterpret_cast<char *>(fheader), sizeof(fheader));
+  if (!input)
+  {
+    return -1;  // not even a full header, start over.
+  }
+  if (header[0] != nr || header[1] != nphi || header[2] != nz ||
+      header[3] != rmin_roi || header[4] != rmax_roi ||
+      header[5] != zmin_roi || header[6] != zmax_roi ||
+      header[7] != ((green == nullptr) ? 0 : 1) ||
+      fheader[0] != rmin || fheader[1] != rmax ||
+      fheader[2] != zmin || fheader[3] != zmax || fheader[4] != green_shift)
+  {
+    std::cout << boost::str(boost::format("checkpoint file %s parameters do not match fieldsim parameters.  Remove it or choose another file.") % lookup_checkpoint) << std::endl;
+    exit(1);
+  }
+
+  int nloaded = 0;
+  int nslices = nr_roi * nz_roi;
+  std::vector<double> record(3 * nr * nphi * nz);
+  std::streamoff goodsize = input.tellg();
+  int islice;
+  while (input.read(reinterpret_cast<char *>(&islice), sizeof(islice)) &&
+         input.read(reinterpret_cast<char *>(record.data()), record.size() * sizeof(double)))
+  {
+    if (islice < 0 || islice >= nslices)
+    {
+      break;
+    }
+    int ifr = rmin_roi + islice / nz_roi;
+    int ifz = zmin_roi + islice % nz_roi;
+    TVector3 *slice = Epartial_phislice->GetPtr(ifr - rmin_roi, 0, ifz - zmin_roi, 0, 0, 0);
+    for (int i = 0; i < nr * nphi * nz; i++)
+    {
+      slice[i].SetXYZ(record[3 * i], record[3 * i + 1], record[3 * i + 2]);
+    }
+    if (!done[islice])
+    {
+      nloaded++;
+    }
+    done[islice] = 1;
+    goodsize = input.tellg();
+  }
+  input.close();
+
+  // drop a partially written record at the end (eg from a job that was killed mid-write), so that new slices are appended after the last good one:
+  std::filesystem::resize_file(lookup_checkpoint, goodsize);
+  return nloaded;
+}
+
 void AnnularFieldSim::load_phislice_lookup(const std::string &sourcefile)
 {
   std::cout << boost::str(boost::format("loading phislice  lookup for (%dx%dx%d)x(%dx%dx%d) grid from %s") % nr_roi % 1 % nz_roi % nr % nphi % nz % sourcefile) << std::endl;
@@ -4,6 +4,7 @@
 
 #include <cmath>   // for NAN, abs
 #include <string>  // for string
+#include <vector>
 
 class AnalyticFieldModel;
 class ChargeMapReader;
@@ -93,6 +94,16 @@ class AnnularFieldSim
     truncation_length = x;
     return;
   }
+  void SetNumberOfThreads(int n)
+  {
+    n_threads = n;
+    return;
+  }
+  void SetLookupCheckpoint(const std::string &filename)
+  {
+    lookup_checkpoint = filename;
+    return;
+  }  // finished slices of the phislice lookup are appended to this file, and are read back instead of recomputed if the file already exists.
 
   // getters for internal states:
   const std::string GetLookupString();
@@ -150,9 +161,13 @@ class AnnularFieldSim
 
   void loadField(MultiArray<TVector3> **field, TTree *source, float *rptr, float *phiptr, float *zptr, float *frptr, float *fphiptr, float *fzptr, float fieldunit, int zsign, float xshift=0, float yshift=0, float zshift=0);
 
-  void load_rossegger(double epsilon = 1E-4)
+  void load_rossegger(double epsilon = 1E-4, bool tabulate = true, const std::string &radialcachefile = "")
   {
     green = new Rossegger(rmin, rmax, zmax, epsilon);
+    if (tabulate)
+    {
+      green->TabulateRadialFunctions(nr, rmin + 0.5 * step.Perp(), step.Perp(), radialcachefile);  // the radii of our cell centers, which are the only ones the lookup asks for.
+    }
     return;
   };
   void borrow_rossegger(Rossegger *ross, float zshift)
@@ -225,6 +240,9 @@ class AnnularFieldSim
   int GetPhiIndex(float pos);
   int GetZindex(float pos);
 
+  void populate_phislice_fieldmap();
+  int read_phislice_checkpoint(std::vector<char> &done);
+
   void UpdateOmegaTau()
   {
     omegatau_nominal = -Bnominal * vdrift / std::abs(Enominal);
@@ -302,6 +320,8 @@ class AnnularFieldSim
   LookupCase lookupCase;  // which lookup system to instantiate and use.
   ChargeCase chargeCase;  // which charge model to use
   int truncation_length;  // distance in cells (full 3D metric in units of bins)
+  int n_threads = 1;              // number of threads used to fill the phislice lookup and to sum the phislice fieldmap
+  std::string lookup_checkpoint;  // file to save/resume a partially filled phislice lookup, empty to disable
 
   // variables related to the region of interest:
   //
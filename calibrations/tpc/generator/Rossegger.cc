@@ -12,6 +12,7 @@
 #include <boost/format.hpp>
 
 #include <algorithm>  // for max
+#include <chrono>
 #include <cmath>
 #include <cstdlib>  // for exit, abs
 #include <fstream>
@@ -351,6 +352,8 @@ double Rossegger::Limu(double mu, double x)
   int IERRO = 0;
 
   double X = x;
+  // the fortran routines keep their intermediate results in COMMON blocks, so only one thread at a time may be in there:
+#pragma omp critical(rossegger_fortran)
   dlia_(&IFAC, &X, &A, &DLI, &DERR, &IERRO);
   return DLI;
 }
@@ -363,6 +366,7 @@ double Rossegger::Kimu(double mu, double x)
   int IERRO = 0;
 
   double X = x;
+#pragma omp critical(rossegger_fortran)
   dkia_(&IFAC, &X, &A, &DKI, &DERR, &IERRO);
   return DKI;
 }
@@ -403,6 +407,12 @@ double Rossegger::Rmn(int m, int n, double r)
     return 0;
   }
 
+  int ir = RadialIndex(r);
+  if (ir >= 0)
+  {
+    return radial_Rmn[RadialTableIndex(ir, m, n)];
+  }
+
   //  Calculate the function using C-libraries from boost
   //  Rossegger Equation 5.11:
   //         Rmn(r) = Ym(Beta_mn a)*Jm(Beta_mn r) - Jm(Beta_mn a)*Ym(Beta_mn r)
@@ -483,6 +493,11 @@ double Rossegger::Rmn1(int m, int n, double r)
   //  Calculate using the TMath functions from root.
   //  Rossegger Equation 5.32
   //         Rmn1(r) = Km(BetaN a)Im(BetaN r) - Im(BetaN a) Km(BetaN r)
+  int ir = RadialIndex(r);
+  if (ir >= 0)
+  {
+    return radial_Rmn1[RadialTableIndex(ir, m, n)];
+  }
   double R = 0;
   R = km_BetaN_a[m][n] * in(m, BetaN[n] * r) - im_BetaN_a[m][n] * kn(m, BetaN[n] * r);
 
@@ -548,6 +563,11 @@ double Rossegger::Rmn2(int m, int n, double r)
   //  Calculate using the TMath functions from root.
   //  Rossegger Equation 5.33
   //         Rmn2(r) = Km(BetaN b)Im(BetaN r) - Im(BetaN b) Km(BetaN r)
+  int ir = RadialIndex(r);
+  if (ir >= 0)
+  {
+    return radial_Rmn2[RadialTableIndex(ir, m, n)];
+  }
   double R = 0;
   R = km_BetaN_b[m][n] * in(m, BetaN[n] * r) - im_BetaN_b[m][n] * kn(m, BetaN[n] * r);
 
@@ -622,6 +642,15 @@ double Rossegger::RPrime(int m, int n, double ref, double r)
   //  NOTE:  K-m(z) = Km(z) and I-m(z) = Im(z)... though boost handles negative orders.
   //
   // with: s -> ref,  t -> r,
+  int ir = RadialIndex(r);
+  if (ir >= 0 && ref == a)
+  {
+    return radial_RPrime_a[RadialTableIndex(ir, m, n)];
+  }
+  if (ir >= 0 && ref == b)
+  {
+    return radial_RPrime_b[RadialTableIndex(ir, m, n)];
+  }
   double BetaN_ = BetaN[n];
   double term1 = kn(m, BetaN_ * ref) * (in(m - 1, BetaN_ * r) + in(m + 1, BetaN_ * r));
   double term2 = in(m, BetaN_ * ref) * (kn(m - 1, BetaN_ * r) + kn(m + 1, BetaN_ * r));
@@ -727,6 +756,11 @@ double Rossegger::Rnk(int n, int k, double r)
   }
   //  Rossegger Equation 5.45
   //       Rnk(r) = Limu_nk (BetaN a) Kimu_nk (BetaN r) - Kimu_nk(BetaN a) Limu_nk (BetaN r)
+  int ir = RadialIndex(r);
+  if (ir >= 0)
+  {
+    return radial_Rnk[RadialTableIndex(ir, n, k)];
+  }
 
   return liMunk_BetaN_a[n][k] * kimu(Munk[n][k], BetaN[n] * r) - kiMunk_BetaN_a[n][k] * limu(Munk[n][k], BetaN[n] * r);
 }
@@ -1421,3 +1455,265 @@ void Rossegger::LoadZeroes(const std::string &destfile)
   f->Close();
   return;
 }
+
+void Rossegger::TabulateRadialFunctions(int nr, double r0, double dr, const std::string &cachefile)
+{
+  if (nr < 1 || r0 < a || r0 + (nr - 1) * dr > b)
+  {
+    std::cout << boost::str(boost::format("Invalid radial grid for TabulateRadialFunctions(nr=%d,r0=%f,dr=%f), must be inside a=%f to b=%f") % nr % r0 % dr % a % b) << std::endl;
+    return;
+  }
+  auto start = std::chrono::steady_clock::now();
+
+  radial_nr = 0;  // make sure RadialIndex() doesn't serve anything while we fill.
+  bool loaded = false;
+  if (!cachefile.empty())
+  {
+    TFile *fileptr = TFile::Open(cachefile.c_str(), "READ");
+    if (fileptr)
+    {
+      fileptr->Close();
+      loaded = LoadRadialTables(cachefile);
+    }
+  }
+  if (!loaded || radial_nr != nr || radial_r0 != r0 || radial_dr != dr)
+  {
+    radial_nr = nr;
+    radial_r0 = r0;
+    radial_dr = dr;
+    FillRadialTables();
+    if (!cachefile.empty())
+    {
+      SaveRadialTables(cachefile);
+    }
+  }
+  else if (!CheckRadialTables(1E-9))
+  {
+    std::cout << "CheckRadialTables(1E-9) failed for " << cachefile << ", recomputing the radial tables" << std::endl;
+    FillRadialTables();
+    SaveRadialTables(cachefile);
+  }
+
+  std::cout << boost::str(boost::format("Rossegger radial tables for %d radii from %2.4f cm in %2.4f cm steps ready in %.2f s")
+                          % radial_nr % radial_r0 % radial_dr % std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count())
+            << std::endl;
+  return;
+}
+
+int Rossegger::RadialIndex(double r)
+{
+  if (radial_nr == 0)
+  {
+    return -1;
+  }
+  int ir = std::lround((r - radial_r0) / radial_dr);
+  // the radii we get asked for come back from TVector3::Perp(), so allow for rounding, but nothing more:
+  if (ir < 0 || ir >= radial_nr || std::abs(r - (radial_r0 + ir * radial_dr)) > 1E-9)
+  {
+    return -1;
+  }
+  return ir;
+}
+
+void Rossegger::FillRadialTables()
+{
+  int nr = radial_nr;
+  radial_nr = 0;  // evaluate directly while filling.
+  std::cout << boost::str(boost::format("Precalcing radial functions at %d radii for %d modes") % nr % (NumberOfOrders * NumberOfOrders)) << std::endl;
+  int length = nr * NumberOfOrders * NumberOfOrders;
+  radial_Rmn.assign(length, 0);
+  radial_Rmn1.assign(length, 0);
+  radial_Rmn2.assign(length, 0);
+  radial_RPrime_a.assign(length, 0);
+  radial_RPrime_b.assign(length, 0);
+  radial_Rnk.assign(length, 0);
+  for (int ir = 0; ir < nr; ir++)
+  {
+    double r = radial_r0 + ir * radial_dr;
+    for (int i = 0; i < NumberOfOrders; i++)
+    {
+      for (int j = 0; j < NumberOfOrders; j++)
+      {
+        int index = RadialTableIndex(ir, i, j);
+        radial_Rmn[index] = Rmn(i, j, r);
+        radial_Rmn1[index] = Rmn1(i, j, r);
+        radial_Rmn2[index] = Rmn2(i, j, r);
+        radial_RPrime_a[index] = RPrime(i, j, a, r);
+        radial_RPrime_b[index] = RPrime(i, j, b, r);
+        radial_Rnk[index] = Rnk(i, j, r);  // i=n, j=k
+      }
+    }
+  }
+  radial_nr = nr;
+  return;
+}
+
+bool Rossegger::CheckRadialTables(double localepsilon)
+{
+  // compare the innermost, middle and outermost tabulated radius against direct evaluation for all modes:
+  int nr = radial_nr;
+  int check_r[3] = {0, nr / 2, nr - 1};
+  double worst = 0;
+  radial_nr = 0;  // evaluate directly while checking.
+  for (int ir : check_r)
+  {
+    double r = radial_r0 + ir * radial_dr;
+    for (int i = 0; i < NumberOfOrders; i++)
+    {
+      for (int j = 0; j < NumberOfOrders; j++)
+      {
+        int index = RadialTableIndex(ir, i, j);
+        double direct[6] = {Rmn(i, j, r), Rmn1(i, j, r), Rmn2(i, j, r), RPrime(i, j, a, r), RPrime(i, j, b, r), Rnk(i, j, r)};
+        double table[6] = {radial_Rmn[index], radial_Rmn1[index], radial_Rmn2[index], radial_RPrime_a[index], radial_RPrime_b[index], radial_Rnk[index]};
+        for (int f = 0; f < 6; f++)
+        {
+          worst = std::max(worst, std::abs(table[f] - direct[f]) / std::max(std::abs(direct[f]), 1E-300));
+        }
+      }
+    }
+  }
+  radial_nr = nr;
+  std::cout << boost::str(boost::format("Rossegger radial tables: largest relative deviation from direct evaluation is %E") % worst) << std::endl;
+  return worst < localepsilon;
+}
+
+void Rossegger::SaveRadialTables(const std::string &destfile)
+{
+  TFile *output = TFile::Open(destfile.c_str(), "RECREATE");
+  output->cd();
+
+  TTree *tInfo = new TTree("info", "radial grid of the tables");
+  int ord = NumberOfOrders;
+  tInfo->Branch("order", &ord);
+  tInfo->Branch("epsilon", &epsilon);
+  tInfo->Branch("a", &a);
+  tInfo->Branch("b", &b);
+  tInfo->Branch("L", &L);
+  tInfo->Branch("nr", &radial_nr);
+  tInfo->Branch("r0", &radial_r0);
+  tInfo->Branch("dr", &radial_dr);
+  tInfo->Fill();
+
+  int ir;
+  int i;
+  int j;
+  double rmn;
+  double rmn1;
+  double rmn2;
+  double rprime_a;
+  double rprime_b;
+  double rnk;
+  TTree *tradial = new TTree("radial", "radial functions, Rnk is stored with (n,k)=(m,n)");
+  tradial->Branch("ir", &ir);
+  tradial->Branch("m", &i);
+  tradial->Branch("n", &j);
+  tradial->Branch("rmn", &rmn);
+  tradial->Branch("rmn1", &rmn1);
+  tradial->Branch("rmn2", &rmn2);
+  tradial->Branch("rprime_a", &rprime_a);
+  tradial->Branch("rprime_b", &rprime_b);
+  tradial->Branch("rnk", &rnk);
+  for (ir = 0; ir < radial_nr; ir++)
+  {
+    for (i = 0; i < ord; i++)
+    {
+      for (j = 0; j < ord; j++)
+      {
+        int index = RadialTableIndex(ir, i, j);
+        rmn = radial_Rmn[index];
+        rmn1 = radial_Rmn1[index];
+        rmn2 = radial_Rmn2[index];
+        rprime_a = radial_RPrime_a[index];
+        rprime_b = radial_RPrime_b[index];
+        rnk = radial_Rnk[index];
+        tradial->Fill();
+      }
+    }
+  }
+
+  tInfo->Write();
+  tradial->Write();
+  output->Close();
+  return;
+}
+
+bool Rossegger::LoadRadialTables(const std::string &sourcefile)
+{
+  TFile *f = TFile::Open(sourcefile.c_str(), "READ");
+  std::cout << "reading rossegger radial tables from " << sourcefile << std::endl;
+  TTree *tInfo = (TTree *) (f->Get("info"));
+  TTree *tradial = (TTree *) (f->Get("radial"));
+  if (!tInfo || !tradial)
+  {
+    f->Close();
+    return false;
+  }
+  // the tables depend on the zeroes as well as the grid, so the file has to match our tags:
+  if (!tInfo->GetBranch("epsilon") || !tInfo->GetBranch("a") || !tInfo->GetBranch("b") || !tInfo->GetBranch("L"))
+  {
+    f->Close();
+    return false;
+  }
+  int ord;
+  int nr;
+  double file_epsilon;
+  double file_a;
+  double file_b;
+  double file_L;
+  tInfo->SetBranchAddress("order", &ord);
+  tInfo->SetBranchAddress("epsilon", &file_epsilon);
+  tInfo->SetBranchAddress("a", &file_a);
+  tInfo->SetBranchAddress("b", &file_b);
+  tInfo->SetBranchAddress("L", &file_L);
+  tInfo->SetBranchAddress("nr", &nr);
+  tInfo->SetBranchAddress("r0", &radial_r0);
+  tInfo->SetBranchAddress("dr", &radial_dr);
+  tInfo->GetEntry(0);
+  if (ord != NumberOfOrders || file_epsilon != epsilon || file_a != a || file_b != b || file_L != L || tradial->GetEntries() != nr * ord * ord)
+  {
+    std::cout << sourcefile << " was made for a different geometry or precision, ignoring it" << std::endl;
+    f->Close();
+    return false;
+  }
+
+  int ir;
+  int i;
+  int j;
+  double rmn;
+  double rmn1;
+  double rmn2;
+  double rprime_a;
+  double rprime_b;
+  double rnk;
+  tradial->SetBranchAddress("ir", &ir);
+  tradial->SetBranchAddress("m", &i);
+  tradial->SetBranchAddress("n", &j);
+  tradial->SetBranchAddress("rmn", &rmn);
+  tradial->SetBranchAddress("rmn1", &rmn1);
+  tradial->SetBranchAddress("rmn2", &rmn2);
+  tradial->SetBranchAddress("rprime_a", &rprime_a);
+  tradial->SetBranchAddress("rprime_b", &rprime_b);
+  tradial->SetBranchAddress("rnk", &rnk);
+  int length = nr * ord * ord;
+  radial_Rmn.assign(length, 0);
+  radial_Rmn1.assign(length, 0);
+  radial_Rmn2.assign(length, 0);
+  radial_RPrime_a.assign(length, 0);
+  radial_RPrime_b.assign(length, 0);
+  radial_Rnk.assign(length, 0);
+  for (int entry = 0; entry < tradial->GetEntries(); entry++)
+  {
+    tradial->GetEntry(entry);
+    int index = RadialTableIndex(ir, i, j);
+    radial_Rmn[index] = rmn;
+    radial_Rmn1[index] = rmn1;
+    radial_Rmn2[index] = rmn2;
+    radial_RPrime_a[index] = rprime_a;
+    radial_RPrime_b[index] = rprime_b;
+    radial_Rnk[index] = rnk;
+  }
+  f->Close();
+
+  radial_nr = nr;
+  return true;
+}
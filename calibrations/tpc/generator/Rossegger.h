@@ -21,6 +21,7 @@
 #include <cstdio>
 #include <map>
 #include <string>
+#include <vector>
 
 class TH2;
 class TH3;
@@ -52,6 +53,11 @@ class Rossegger
   double Limu(double mu, double x);  // Bessel functions of purely imaginary order
   double Kimu(double mu, double x);  // Bessel functions of purely imaginary order
 
+  // tabulate Rmn, Rmn1, Rmn2, RPrime and Rnk for all modes at the radii r0+i*dr, i<nr (eg the cell centers of a field sim),
+  // and serve those radii from the table afterwards.  If cachefile is given, the table is read from it when it matches
+  // this geometry and grid, and written to it otherwise.  With no cachefile nothing is written.
+  void TabulateRadialFunctions(int nr, double r0, double dr, const std::string &cachefile = "");
+
   double Ez(double r, double phi, double z, double r1, double phi1, double z1);
   double Er(double r, double phi, double z, double r1, double phi1, double z1);
   double Ephi(double r, double phi, double z, double r1, double phi1, double z1);
@@ -115,6 +121,23 @@ class Rossegger
   double sinh_Betamn_L[NumberOfOrders][NumberOfOrders]{};   // sinh(Betamn[m][n]*L)  as in Rossegger 5.64
   double sinh_pi_Munk[NumberOfOrders][NumberOfOrders]{};    // sinh(pi*Munk[n][k]) as in Rossegger 5.66
 
+  // radial functions at r0+i*dr, see TabulateRadialFunctions.  Flat in [i][m][n] (or [i][n][k] for Rnk):
+  int RadialIndex(double r);  // index of r in the radial table, or -1 if r is not one of the tabulated radii.
+  int RadialTableIndex(int ir, int i, int j) { return (ir * NumberOfOrders + i) * NumberOfOrders + j; }
+  void FillRadialTables();
+  bool CheckRadialTables(double localepsilon);  // compare a sample of the table against direct evaluation.
+  bool LoadRadialTables(const std::string &sourcefile);
+  void SaveRadialTables(const std::string &destfile);
+  int radial_nr = 0;
+  double radial_r0 = NAN;
+  double radial_dr = NAN;
+  std::vector<double> radial_Rmn;
+  std::vector<double> radial_Rmn1;
+  std::vector<double> radial_Rmn2;
+  std::vector<double> radial_RPrime_a;  // RPrime(m,n,a,r)
+  std::vector<double> radial_RPrime_b;  // RPrime(m,n,b,r)
+  std::vector<double> radial_Rnk;
+
   TH2 *Tags = nullptr;
   std::map<std::string, TH3 *> Grid;
 };
@@ -8,6 +8,15 @@
 #include <iostream>
 #include <stdexcept>
 
+namespace
+{
+  // validity requirement shared by getUrl and getUrlDict
+  bool is_valid(const nlohmann::json& payload_iov, long long iov)
+  {
+    return payload_iov["minor_iov_end"] > iov;
+  }
+}  // namespace
+
 SphenixClient::SphenixClient(const std::string& gt_name)
   : nopayloadclient::NoPayloadClient(gt_name)
   , m_CachedGlobalTag(gt_name)
@@ -40,7 +49,7 @@ nlohmann::json SphenixClient::getUrl(const std::string& pl_type, long long iov)
               << ", minor_iov_end: " << payload_iov["minor_iov_end"]
               << std::endl;
   }
-  if (payload_iov["minor_iov_end"] <= iov)
+  if (!is_valid(payload_iov, iov))
   {
     return nopayloadclient::DataBaseException("No valid payload with type " + pl_type).jsonify();
   }
@@ -60,7 +69,7 @@ nlohmann::json SphenixClient::getUrlDict(long long iov)
   }
   for (auto it = resp["msg"].begin(); it != resp["msg"].end();)
   {
-    if (it.value()["minor_iov_end"] < iov)
+    if (!is_valid(it.value(), iov))
     {
       it = resp["msg"].erase(it);
     }
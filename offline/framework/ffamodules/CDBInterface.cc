@@ -14,16 +14,62 @@
 #include <phool/PHNode.h>          // for PHNode
 #include <phool/PHNodeIterator.h>  // for PHNodeIterator
 #include <phool/PHObject.h>        // for PHObject
+#include <phool/PHTimer.h>
+#include <phool/fnv1a.h>
 #include <phool/getClass.h>
 #include <phool/phool.h>
 #include <phool/recoConsts.h>
 
+#include <nlohmann/json.hpp>
+
 #include <TSystem.h>
 
-#include <cstdint>   // for uint64_t
+#include <cstdint>  // for uint64_t
+#include <filesystem>
+#include <fstream>
 #include <iostream>  // for operator<<, basic_ostream, endl
-#include <utility>   // for pair
-#include <vector>    // for vector
+#include <sstream>
+#include <system_error>  // for error_code
+#include <utility>       // for pair
+#include <vector>        // for vector
+
+namespace
+{
+  std::string tohex(const uint64_t value)
+  {
+    std::ostringstream str;
+    str << std::hex << value;
+    return str.str();
+  }
+
+  // per process temporary name in the target directory, the rename
+  // into the final name is atomic on the same file system
+  std::filesystem::path tmpname(const std::filesystem::path &target)
+  {
+    return target.parent_path() / (".tmp-" + std::to_string(gSystem->GetPid()) + "-" + target.filename().string());
+  }
+
+  bool atomic_write(const std::filesystem::path &target, const std::string &content)
+  {
+    std::filesystem::path tmpfile = tmpname(target);
+    {
+      std::ofstream out(tmpfile);
+      out << content << std::endl;
+      if (!out)
+      {
+        return false;
+      }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpfile, target, ec);
+    if (ec)
+    {
+      std::filesystem::remove(tmpfile, ec);
+      return false;
+    }
+    return true;
+  }
+}  // namespace
 
 CDBInterface *CDBInterface::__instance{nullptr};
 
@@ -40,6 +86,7 @@ CDBInterface *CDBInterface::instance()
 //____________________________________________________________________________..
 CDBInterface::CDBInterface(const std::string &name)
   : SubsysReco(name)
+  , m_Timer(new PHTimer("CDBInterface"))
 {
   Fun4AllServer *se = Fun4AllServer::instance();
   se->addNewSubsystem(this);
@@ -50,6 +97,23 @@ CDBInterface::CDBInterface(const std::string &name)
 CDBInterface::~CDBInterface()
 {
   delete cdbclient;
+  delete m_Timer;
+}
+
+//____________________________________________________________________________..
+void CDBInterface::LocalCache(const std::string &dir)
+{
+  m_LocalCacheDir = dir;
+  m_PrefetchFlag = true;
+  std::error_code ec;
+  std::filesystem::create_directories(std::filesystem::path(dir) / "urls", ec);
+  std::filesystem::create_directories(std::filesystem::path(dir) / "payloads", ec);
+  if (ec)
+  {
+    std::cout << PHWHERE << " cannot create cache directory " << dir
+              << ": " << ec.message() << ", local cache disabled" << std::endl;
+    m_LocalCacheDir.clear();
+  }
 }
 
 //____________________________________________________________________________..
@@ -99,6 +163,11 @@ int CDBInterface::End(PHCompositeNode *topNode)
   {
     cdburls->identify();
   }
+  if (Verbosity() > 0)
+  {
+    std::cout << Name() << ": time spent resolving " << m_UrlVector.size()
+              << " urls: " << m_Timer->get_accumulated_time() << " ms" << std::endl;
+  }
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
@@ -137,6 +206,7 @@ std::string CDBInterface::getUrl(const std::string &domain, const std::string &f
   {
     cdbclient = new SphenixClient(rc->get_StringFlag("CDB_GLOBALTAG"));
   }
+  m_Timer->restart();
   uint64_t timestamp = rc->get_uint64Flag("TIMESTAMP");
   if (Verbosity() > 0)
   {
@@ -144,14 +214,14 @@ std::string CDBInterface::getUrl(const std::string &domain, const std::string &f
               << ", domain: " << domain_noconst
               << ", timestamp: " << timestamp;
   }
-  std::string return_url = cdbclient->getCalibration(domain_noconst, timestamp);
+  std::string return_url = lookup(domain_noconst, timestamp);
   if (return_url.empty())
   {
     if (!disable_default)
     {
       std::string domain_copy = domain_noconst;
       domain_noconst = domain_noconst + "_default";
-      return_url = cdbclient->getCalibration(domain_noconst, timestamp);
+      return_url = lookup(domain_noconst, timestamp);
       if (return_url.empty())
       {
         if (Verbosity() > 0)
@@ -184,5 +254,155 @@ std::string CDBInterface::getUrl(const std::string &domain, const std::string &f
     std::cout << PHWHERE << "not adding again " << domain_noconst << ", url: " << return_url
               << ", time stamp: " << timestamp << std::endl;
   }
+  // the run node keeps the database url, the job reads the local copy
+  if (!m_LocalCacheDir.empty() && !return_url.empty())
+  {
+    return_url = cache_payload(return_url);
+    if (Verbosity() > 0)
+    {
+      std::cout << "... using cached payload " << return_url << std::endl;
+    }
+  }
+  m_Timer->stop();
   return return_url;
 }
+
+std::string CDBInterface::lookup(const std::string &domain, const uint64_t timestamp)
+{
+  if (m_PrefetchFlag)
+  {
+    std::string globaltag = recoConsts::instance()->get_StringFlag("CDB_GLOBALTAG");
+    if (globaltag != m_PrefetchGlobalTag || timestamp != m_PrefetchTimestamp)
+    {
+      prefetch_urls(globaltag, timestamp);
+    }
+    if (m_PrefetchValid)
+    {
+      auto iter = m_PrefetchedUrls.find(domain);
+      if (iter == m_PrefetchedUrls.end())
+      {
+        return "";
+      }
+      return iter->second;
+    }
+  }
+  return cdbclient->getCalibration(domain, timestamp);
+}
+
+int CDBInterface::prefetch_urls(const std::string &globaltag, const uint64_t timestamp)
+{
+  // remember the attempt, a failed prefetch falls back to single queries
+  // and is not retried for the same global tag/timestamp
+  m_PrefetchGlobalTag = globaltag;
+  m_PrefetchTimestamp = timestamp;
+  m_PrefetchValid = false;
+  m_PrefetchedUrls.clear();
+  std::filesystem::path cachefile;
+  if (!m_LocalCacheDir.empty())
+  {
+    cachefile = std::filesystem::path(m_LocalCacheDir) / "urls" / (globaltag + "-" + std::to_string(timestamp) + ".json");
+    std::ifstream infile(cachefile);
+    if (infile.is_open())
+    {
+      nlohmann::json urls = nlohmann::json::parse(infile, nullptr, false);
+      if (urls.is_object())
+      {
+        for (auto &it : urls.items())
+        {
+          m_PrefetchedUrls[it.key()] = it.value();
+        }
+        m_PrefetchValid = true;
+        if (Verbosity() > 0)
+        {
+          std::cout << Name() << ": read " << m_PrefetchedUrls.size() << " urls from " << cachefile << std::endl;
+        }
+        return 0;
+      }
+    }
+  }
+  // same lookup and validity requirement as SphenixClient::getUrl()
+  nlohmann::json resp = cdbclient->getUrlDict(timestamp);
+  if (resp["code"] != 0)
+  {
+    if (Verbosity() > 0)
+    {
+      std::cout << PHWHERE << " prefetch failed, querying domains one by one: " << resp << std::endl;
+    }
+    return -1;
+  }
+  const nlohmann::json &urls = resp["msg"];
+  for (auto &it : urls.items())
+  {
+    m_PrefetchedUrls[it.key()] = it.value();
+  }
+  m_PrefetchValid = true;
+  if (Verbosity() > 0)
+  {
+    std::cout << Name() << ": prefetched " << m_PrefetchedUrls.size() << " urls for global tag "
+              << globaltag << ", timestamp " << timestamp << std::endl;
+  }
+  if (!cachefile.empty() && !atomic_write(cachefile, urls.dump()))
+  {
+    std::cout << PHWHERE << " could not write " << cachefile << std::endl;
+  }
+  return 0;
+}
+
+std::string CDBInterface::cache_payload(const std::string &url) const
+{
+  std::error_code ec;
+  std::filesystem::path source(url);
+  if (!std::filesystem::is_regular_file(source, ec))
+  {
+    // remote urls (root://, http://) are handed to ROOT as they are
+    return url;
+  }
+  // the url index points to the content addressed copy, payload files
+  // are never modified once they are in the database
+  std::filesystem::path cachedir(m_LocalCacheDir);
+  std::filesystem::path indexfile = cachedir / "urls" / ("payload-" + tohex(fnv1a::hash(url)));
+  {
+    std::ifstream index(indexfile);
+    std::string cached;
+    if (std::getline(index, cached) && std::filesystem::is_regular_file(cached, ec))
+    {
+      return cached;
+    }
+  }
+  // copy and hash in one pass, the content hash and size make the name
+  std::filesystem::path tmpfile = tmpname(cachedir / "payloads" / indexfile.filename());
+  uint64_t hash = fnv1a::offset;
+  uint64_t size = 0;
+  {
+    std::ifstream in(source, std::ios::binary);
+    std::ofstream out(tmpfile, std::ios::binary);
+    if (!in || !out)
+    {
+      return url;
+    }
+    std::vector<char> buffer(1U << 20U);
+    while (in.read(buffer.data(), buffer.size()) || in.gcount() > 0)
+    {
+      hash = fnv1a::hash(buffer.data(), in.gcount(), hash);
+      out.write(buffer.data(), in.gcount());
+      size += in.gcount();
+    }
+    if (!out)
+    {
+      out.close();
+      std::filesystem::remove(tmpfile, ec);
+      return url;
+    }
+  }
+  // if another job stored the same content already the rename
+  // replaces it by identical bytes
+  std::filesystem::path cached = cachedir / "payloads" / (tohex(hash) + "-" + std::to_string(size) + source.extension().string());
+  std::filesystem::rename(tmpfile, cached, ec);
+  if (ec)
+  {
+    std::filesystem::remove(tmpfile, ec);
+    return url;
+  }
+  atomic_write(indexfile, cached.string());
+  return cached.string();
+}
@@ -6,11 +6,13 @@
 #include <fun4all/SubsysReco.h>
 
 #include <cstdint>  // for uint64_t
+#include <map>
 #include <set>
 #include <string>
 #include <tuple>  // for tuple
 
 class PHCompositeNode;
+class PHTimer;
 class SphenixClient;
 
 class CDBInterface : public SubsysReco
@@ -33,13 +35,38 @@ class CDBInterface : public SubsysReco
 
   std::string getUrl(const std::string &domain, const std::string &filename = "");
 
+  //! resolve the urls of all domains for the current timestamp with a single
+  //! database query on the first getUrl() call instead of one query per domain
+  void Prefetch(const bool b = true) { m_PrefetchFlag = b; }
+
+  /*!
+    node local cache directory. The prefetched url list of a global tag/timestamp
+    is kept in <dir>/urls, local payload files are copied to <dir>/payloads
+    under the hash of their content and getUrl() returns the copy.
+    The cache is filled with atomic renames, so concurrent jobs on one node
+    can share it. Switches on Prefetch().
+    Only use with locked global tags, cached url lists are never refreshed.
+  */
+  void LocalCache(const std::string &dir);
+
  private:
   CDBInterface(const std::string &name = "CDBInterface");
 
+  std::string lookup(const std::string &domain, const uint64_t timestamp);
+  int prefetch_urls(const std::string &globaltag, const uint64_t timestamp);
+  std::string cache_payload(const std::string &url) const;
+
   static CDBInterface *__instance;
   SphenixClient *cdbclient{nullptr};
   bool disable{false};
   bool disable_default{false};
+  bool m_PrefetchFlag{false};
+  bool m_PrefetchValid{false};
+  uint64_t m_PrefetchTimestamp{0};
+  PHTimer *m_Timer{nullptr};
+  std::string m_PrefetchGlobalTag;
+  std::string m_LocalCacheDir;
+  std::map<std::string, std::string> m_PrefetchedUrls;
   std::set<std::tuple<std::string, std::string, uint64_t>> m_UrlVector;
 };
 
@@ -0,0 +1,87 @@
+// test of the CDBInterface prefetch and local payload cache against a
+// file based stand-in for the database. A hand written url list in
+// <cache>/urls/<global tag>-<timestamp>.json answers all getUrl() calls,
+// so no database connection is made
+#include "CDBInterface.h"
+
+#include <phool/recoConsts.h>
+
+#include <unistd.h>  // for getpid
+
+#include <cstdint>  // for uint64_t
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <system_error>  // for error_code
+
+namespace
+{
+  int nfailed = 0;
+
+  void check(bool condition, const std::string &what)
+  {
+    std::cout << (condition ? "passed: " : "FAILED: ") << what << std::endl;
+    if (!condition)
+    {
+      ++nfailed;
+    }
+  }
+
+  std::string content(const std::filesystem::path &file)
+  {
+    std::ifstream in(file, std::ios::binary);
+    std::ostringstream str;
+    str << in.rdbuf();
+    return str.str();
+  }
+}  // namespace
+
+int main()
+{
+  const std::string globaltag = "standin";
+  const uint64_t timestamp = 12345;
+
+  const std::filesystem::path topdir = std::filesystem::temp_directory_path() / ("testCDBLocalCache-" + std::to_string(getpid()));
+  const std::filesystem::path cachedir = topdir / "cache";
+  const std::filesystem::path payloaddir = topdir / "payloads";
+  std::filesystem::create_directories(cachedir / "urls");
+  std::filesystem::create_directories(payloaddir);
+
+  // stand-in payloads, two domains share the same content
+  const std::filesystem::path payload_a = payloaddir / "a.root";
+  const std::filesystem::path payload_b = payloaddir / "b.root";
+  std::ofstream(payload_a) << "payload a";
+  std::ofstream(payload_b) << "payload a";
+
+  // stand-in database, in the layout written by the prefetch
+  std::ofstream(cachedir / "urls" / (globaltag + "-" + std::to_string(timestamp) + ".json"))
+      << "{\"DOMAIN_A\": \"" << payload_a.string() << "\", "
+      << "\"DOMAIN_B\": \"" << payload_b.string() << "\", "
+      << "\"DOMAIN_C_default\": \"root://remote/c.root\"}" << std::endl;
+
+  recoConsts *rc = recoConsts::instance();
+  rc->set_StringFlag("CDB_GLOBALTAG", globaltag);
+  rc->set_uint64Flag("TIMESTAMP", timestamp);
+
+  CDBInterface *cdb = CDBInterface::instance();
+  cdb->LocalCache(cachedir.string());
+
+  // local payloads are returned as content addressed copies in the cache
+  const std::string url_a = cdb->getUrl("DOMAIN_A");
+  check(std::filesystem::path(url_a).parent_path() == cachedir / "payloads", "DOMAIN_A is read from the cache");
+  check(content(url_a) == content(payload_a), "DOMAIN_A cached copy has the payload content");
+  check(cdb->getUrl("DOMAIN_A") == url_a, "DOMAIN_A resolves to the same copy twice");
+  check(cdb->getUrl("DOMAIN_B") == url_a, "identical payloads share one copy");
+
+  // remote urls are not copied, missing domains fall back to <domain>_default, then to the file name
+  check(cdb->getUrl("DOMAIN_C") == "root://remote/c.root", "DOMAIN_C falls back to DOMAIN_C_default");
+  check(cdb->getUrl("DOMAIN_D", "fallback.root") == "fallback.root", "DOMAIN_D falls back to the file name");
+
+  std::error_code ec;
+  std::filesystem::remove_all(topdir, ec);
+
+  std::cout << (nfailed ? "testCDBLocalCache FAILED" : "testCDBLocalCache passed") << std::endl;
+  return nfailed ? 1 : 0;
+}
@@ -0,0 +1,35 @@
+#ifndef PHOOL_FNV1A_H
+#define PHOOL_FNV1A_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*!
+ * \file fnv1a.h
+ * \brief 64 bit FNV-1a hash. Unlike std::hash it is stable between builds,
+ * so it can be used for file names shared by jobs (node local caches)
+ */
+namespace fnv1a
+{
+  static constexpr uint64_t offset = 14695981039346656037ULL;
+  static constexpr uint64_t prime = 1099511628211ULL;
+
+  //! hash len bytes, pass the previous result as value to continue a hash over several buffers
+  inline uint64_t hash(const char *data, const size_t len, uint64_t value = offset)
+  {
+    for (size_t i = 0; i < len; ++i)
+    {
+      value ^= static_cast<unsigned char>(data[i]);
+      value *= prime;
+    }
+    return value;
+  }
+
+  inline uint64_t hash(const std::string &str)
+  {
+    return hash(str.data(), str.size());
+  }
+}  // namespace fnv1a
+
+#endif
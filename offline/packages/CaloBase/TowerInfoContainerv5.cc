@@ -0,0 +1,149 @@
+#include "TowerInfoContainerv5.h"
+#include "TowerInfov5.h"
+
+#include <algorithm>
+
+TowerInfoContainerv5::TowerInfoContainerv5(DETECTOR detec)
+  : _detector(detec)
+{
+  int nchannels = 744;
+  if (_detector == DETECTOR::SEPD)
+  {
+    nchannels = 744;
+  }
+  else if (_detector == DETECTOR::EMCAL)
+  {
+    nchannels = 24576;
+  }
+  else if (_detector == DETECTOR::HCAL)
+  {
+    nchannels = 1536;
+  }
+  else if (_detector == DETECTOR::MBD)
+  {
+    nchannels = 256;
+  }
+  else if (_detector == DETECTOR::ZDC)
+  {
+    nchannels = 52;
+  }
+
+  // as tower numbers are fixed per event
+  // allocate arrays once per run
+  m_energy.assign(nchannels, 0);
+  m_time.assign(nchannels, 0);
+  m_chi2.assign(nchannels, 0);
+  m_pedestal.assign(nchannels, 0);
+  m_status.assign(nchannels, 0);
+}
+
+TowerInfoContainerv5::TowerInfoContainerv5(const TowerInfoContainerv5& source)
+  : TowerInfoContainer(source)
+  , _detector(source.get_detectorid())
+  , m_energy(source.m_energy)
+  , m_time(source.m_time)
+  , m_chi2(source.m_chi2)
+  , m_pedestal(source.m_pedestal)
+  , m_status(source.m_status)
+{
+}
+
+void TowerInfoContainerv5::identify(std::ostream& os) const
+{
+  os << "TowerInfoContainerv5 of size " << size() << std::endl;
+}
+
+void TowerInfoContainerv5::Reset()
+{
+  // clear content of towers in the container for the next event
+  std::fill(m_energy.begin(), m_energy.end(), 0);
+  std::fill(m_time.begin(), m_time.end(), 0);
+  std::fill(m_chi2.begin(), m_chi2.end(), 0);
+  std::fill(m_pedestal.begin(), m_pedestal.end(), 0);
+  std::fill(m_status.begin(), m_status.end(), 0);
+}
+
+void TowerInfoContainerv5::make_towers()
+{
+  // views only hold the container address and channel,
+  // so they stay valid when arrays are re-filled, e.g. when reading from file
+  if (m_towers.size() == size())
+  {
+    return;
+  }
+
+  m_towers.clear();
+  m_towers.reserve(size());
+  for (unsigned int i = 0; i < size(); ++i)
+  {
+    m_towers.emplace_back(this, i);
+  }
+}
+
+TowerInfov5* TowerInfoContainerv5::get_tower_at_channel(int pos)
+{
+  if (pos < 0 || pos >= static_cast<int>(size()))
+  {
+    return nullptr;
+  }
+  make_towers();
+  return &m_towers[pos];
+}
+
+TowerInfov5* TowerInfoContainerv5::get_tower_at_key(int pos)
+{
+  return get_tower_at_channel(decode_key(pos));
+}
+
+unsigned int TowerInfoContainerv5::encode_key(unsigned int towerIndex)
+{
+  int key = 0;
+  if (_detector == DETECTOR::EMCAL)
+  {
+    key = TowerInfoContainer::encode_emcal(towerIndex);
+  }
+  else if (_detector == DETECTOR::HCAL)
+  {
+    key = TowerInfoContainer::encode_hcal(towerIndex);
+  }
+  else if (_detector == DETECTOR::SEPD)
+  {
+    key = TowerInfoContainer::encode_epd(towerIndex);
+  }
+  else if (_detector == DETECTOR::MBD)
+  {
+    key = TowerInfoContainer::encode_mbd(towerIndex);
+  }
+  else if (_detector == DETECTOR::ZDC)
+  {
+    key = TowerInfoContainer::encode_zdc(towerIndex);
+  }
+  return key;
+}
+
+unsigned int TowerInfoContainerv5::decode_key(unsigned int tower_key)
+{
+  int index = 0;
+
+  if (_detector == DETECTOR::EMCAL)
+  {
+    index = TowerInfoContainer::decode_emcal(tower_key);
+  }
+  else if (_detector == DETECTOR::HCAL)
+  {
+    index = TowerInfoContainer::decode_hcal(tower_key);
+  }
+  else if (_detector == DETECTOR::SEPD)
+  {
+    index = TowerInfoContainer::decode_epd(tower_key);
+  }
+  else if (_detector == DETECTOR::MBD)
+  {
+    index = TowerInfoContainer::decode_mbd(tower_key);
+  }
+  else if (_detector == DETECTOR::ZDC)
+  {
+    index = TowerInfoContainer::decode_zdc(tower_key);
+  }
+  return index;
+}
@@ -0,0 +1,78 @@
+#ifndef TOWERINFOCONTAINERV5_H
+#define TOWERINFOCONTAINERV5_H
+
+#include "TowerInfoContainer.h"
+#include "TowerInfov5.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+class PHObject;
+
+// structure of arrays tower container: energy, time, chi2, pedestal and status are stored
+// in contiguous per channel arrays, rather than in a TClonesArray of TowerInfo objects.
+// Whole detector loops can use the bulk array accessors directly. get_tower_at_channel still
+// returns a TowerInfo, as a transient view on the arrays, for compatibility with existing code
+class TowerInfoContainerv5 : public TowerInfoContainer
+{
+ public:
+  TowerInfoContainerv5(DETECTOR detec);
+
+  // default constructor for ROOT IO
+  TowerInfoContainerv5() {}
+  PHObject *CloneMe() const override { return new TowerInfoContainerv5(*this); }
+  TowerInfoContainerv5(const TowerInfoContainerv5 &);
+  TowerInfoContainerv5 &operator=(const TowerInfoContainerv5 &) = delete;
+
+  ~TowerInfoContainerv5() override {}
+
+  void identify(std::ostream &os = std::cout) const override;
+
+  void Reset() override;
+  TowerInfov5 *get_tower_at_channel(int pos) override;
+  TowerInfov5 *get_tower_at_key(int pos) override;
+
+  unsigned int encode_key(unsigned int towerIndex) override;
+  unsigned int decode_key(unsigned int tower_key) override;
+
+  size_t size() const override { return m_energy.size(); }
+  DETECTOR get_detectorid() const override { return _detector; }
+
+  // bulk accessors, indexed by channel, size() entries each
+  float *get_energy_array() { return m_energy.data(); }
+  const float *get_energy_array() const { return m_energy.data(); }
+
+  float *get_time_array() { return m_time.data(); }
+  const float *get_time_array() const { return m_time.data(); }
+
+  float *get_chi2_array() { return m_chi2.data(); }
+  const float *get_chi2_array() const { return m_chi2.data(); }
+
+  float *get_pedestal_array() { return m_pedestal.data(); }
+  const float *get_pedestal_array() const { return m_pedestal.data(); }
+
+  uint8_t *get_status_array() { return m_status.data(); }
+  const uint8_t *get_status_array() const { return m_status.data(); }
+
+ protected:
+  DETECTOR _detector = DETECTOR_INVALID;
+
+ private:
+  // (re)create the per channel views, if needed
+  void make_towers();
+
+  std::vector<float> m_energy;
+  std::vector<float> m_time;
+  std::vector<float> m_chi2;
+  std::vector<float> m_pedestal;
+  std::vector<uint8_t> m_status;
+
+  // per channel views, created on first access
+  std::vector<TowerInfov5> m_towers;  //!
+
+  ClassDefOverride(TowerInfoContainerv5, 1);
+};
+
+#endif
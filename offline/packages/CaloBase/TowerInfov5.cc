@@ -0,0 +1,52 @@
+#include "TowerInfov5.h"
+#include "TowerInfo.h"
+#include "TowerInfoContainerv5.h"
+
+#include <limits>
+
+void TowerInfov5::Reset()
+{
+  m_container->get_energy_array()[m_channel] = std::numeric_limits<float>::signaling_NaN();
+  m_container->get_time_array()[m_channel] = 0;
+  m_container->get_chi2_array()[m_channel] = 0;
+  m_container->get_pedestal_array()[m_channel] = 0;
+  m_container->get_status_array()[m_channel] = 0;
+}
+
+void TowerInfov5::Clear(Option_t* /*unused*/)
+{
+  m_container->get_energy_array()[m_channel] = 0;
+  m_container->get_time_array()[m_channel] = 0;
+  m_container->get_chi2_array()[m_channel] = 0;
+  m_container->get_pedestal_array()[m_channel] = 0;
+  m_container->get_status_array()[m_channel] = 0;
+}
+
+void TowerInfov5::set_energy(float energy) { m_container->get_energy_array()[m_channel] = energy; }
+float TowerInfov5::get_energy() { return m_container->get_energy_array()[m_channel]; }
+
+// time is stored as float, short accessors truncate like the other versions
+void TowerInfov5::set_time(short t) { m_container->get_time_array()[m_channel] = t; }
+short TowerInfov5::get_time() { return m_container->get_time_array()[m_channel]; }
+
+void TowerInfov5::set_time_float(float t) { m_container->get_time_array()[m_channel] = t; }
+float TowerInfov5::get_time_float() { return m_container->get_time_array()[m_channel]; }
+
+void TowerInfov5::set_chi2(float chi2) { m_container->get_chi2_array()[m_channel] = chi2; }
+float TowerInfov5::get_chi2() { return m_container->get_chi2_array()[m_channel]; }
+
+void TowerInfov5::set_pedestal(float pedestal) { m_container->get_pedestal_array()[m_channel] = pedestal; }
+float TowerInfov5::get_pedestal() { return m_container->get_pedestal_array()[m_channel]; }
+
+uint8_t TowerInfov5::get_status() const { return static_cast<const TowerInfoContainerv5*>(m_container)->get_status_array()[m_channel]; }
+void TowerInfov5::set_status(uint8_t status) { m_container->get_status_array()[m_channel] = status; }
+
+void TowerInfov5::copy_tower(TowerInfo* tower)
+{
+  set_time_float(tower->get_time_float());
+  set_energy(tower->get_energy());
+  set_chi2(tower->get_chi2());
+  set_pedestal(tower->get_pedestal());
+  set_status(tower->get_status());
+  return;
+}
@@ -0,0 +1,103 @@
+#ifndef TOWERINFOV5_H
+#define TOWERINFOV5_H
+
+#include "TowerInfo.h"
+
+#include <cstdint>
+
+class TowerInfoContainerv5;
+
+// transient view on one channel of TowerInfoContainerv5, which stores tower content in contiguous arrays
+// it holds no data on its own and is never written out
+class TowerInfov5 : public TowerInfo
+{
+ public:
+  TowerInfov5() {}
+
+  TowerInfov5(TowerInfoContainerv5* container, unsigned int channel)
+    : m_container(container)
+    , m_channel(channel)
+  {
+  }
+
+  ~TowerInfov5() override {}
+
+  void Reset() override;
+  void Clear(Option_t* = "") override;
+
+  void set_energy(float energy) override;
+  float get_energy() override;
+
+  void set_time(short t) override;
+  short get_time() override;
+
+  void set_time_float(float t) override;
+  float get_time_float() override;
+
+  void set_chi2(float chi2) override;
+  float get_chi2() override;
+
+  void set_pedestal(float pedestal) override;
+  float get_pedestal() override;
+
+  void set_isHot(bool isHot) override { set_status_bit(0, isHot); }
+  bool get_isHot() const override { return get_status_bit(0); }
+
+  void set_isBadTime(bool isBadTime) override { set_status_bit(1, isBadTime); }
+  bool get_isBadTime() const override { return get_status_bit(1); }
+
+  void set_isBadChi2(bool isBadChi2) override { set_status_bit(2, isBadChi2); }
+  bool get_isBadChi2() const override { return get_status_bit(2); }
+
+  void set_isNotInstr(bool isNotInstr) override { set_status_bit(3, isNotInstr); }
+  bool get_isNotInstr() const override { return get_status_bit(3); }
+
+  void set_isNoCalib(bool isNoCalib) override { set_status_bit(4, isNoCalib); }
+  bool get_isNoCalib() const override { return get_status_bit(4); }
+
+  void set_isZS(bool isZS) override { set_status_bit(5, isZS); }
+  bool get_isZS() const override { return get_status_bit(5); }
+
+  void set_isRecovered(bool isRecovered) override { set_status_bit(6, isRecovered); }
+  bool get_isRecovered() const override { return get_status_bit(6); }
+
+  void set_isSaturated(bool isSaturated) override { set_status_bit(7, isSaturated); }
+  bool get_isSaturated() const override { return get_status_bit(7); }
+
+  bool get_isGood() const override { return !(get_isHot() || get_isBadChi2() || get_isNoCalib()); }
+
+  uint8_t get_status() const override;
+
+  void set_status(uint8_t status) override;
+
+  void copy_tower(TowerInfo* tower) override;
+
+ private:
+  TowerInfoContainerv5* m_container = nullptr;  //!
+  unsigned int m_channel = 0;                   //!
+
+  void set_status_bit(int bit, bool value)
+  {
+    if (bit < 0 || bit > 7)
+    {
+      return;
+    }
+    uint8_t status = get_status();
+    status &= ~((uint8_t) 1 << bit);
+    status |= (uint8_t) value << bit;
+    set_status(status);
+  }
+
+  bool get_status_bit(int bit) const
+  {
+    if (bit < 0 || bit > 7)
+    {
+      return false;  // default behavior
+    }
+    return (get_status() & ((uint8_t) 1 << bit)) != 0;
+  }
+
+  ClassDefOverride(TowerInfov5, 1);
+};
+
+#endif
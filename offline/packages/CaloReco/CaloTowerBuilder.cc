@@ -9,6 +9,7 @@
 #include <calobase/TowerInfoContainerv2.h>
 #include <calobase/TowerInfoContainerv3.h>
 #include <calobase/TowerInfoContainerv4.h>
+#include <calobase/TowerInfoContainerv5.h>
 
 #include <ffarawobjects/CaloPacket.h>
 #include <ffarawobjects/CaloPacketContainer.h>
@@ -34,6 +35,7 @@
 
 #include <TSystem.h>
 
+#include <algorithm>
 #include <climits>
 #include <iostream>  // for operator<<, endl, basic...
 #include <memory>    // for allocator_traits<>::val...
@@ -170,18 +172,21 @@ int CaloTowerBuilder::InitRun(PHCompositeNode *topNode)
   }
 
   CreateNodeTree(topNode);
+
+  // waveform storage, allocated once per run and reused for every event
+  const int nchannels_total = m_isdata ? (m_packet_high - m_packet_low + 1) * m_nchannels : m_CalowaveformContainer->size();
+  m_waveforms.reserve(nchannels_total, std::max(m_nsamples, m_nzerosuppsamples));
+
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
 int CaloTowerBuilder::process_sim()
 {
-  std::vector<std::vector<float>> waveforms;
+  m_waveforms.clear();
 
   for (int ich = 0; ich < (int) m_CalowaveformContainer->size(); ich++)
   {
     TowerInfo *towerinfo = m_CalowaveformContainer->get_tower_at_channel(ich);
-    std::vector<float> waveform;
-    waveform.reserve(m_nsamples);
     bool fillwaveform = true;
     // get key
     if (m_dotbtszs)
@@ -195,36 +200,34 @@ int CaloTowerBuilder::process_sim()
       {
         // zero suppressed
         fillwaveform = false;
-        waveform.push_back(pre);
-        waveform.push_back(post);
+        m_waveforms.add_zs_channel(pre, post);
       }
     }
     if (fillwaveform)
     {
+      float *waveform = m_waveforms.add_channel(m_nsamples);
       for (int samp = 0; samp < m_nsamples; samp++)
       {
-        waveform.push_back(towerinfo->get_waveform_value(samp));
+        waveform[samp] = towerinfo->get_waveform_value(samp);
       }
     }
-    waveforms.push_back(waveform);
-    waveform.clear();
   }
 
-  std::vector<std::vector<float>> processed_waveforms = WaveformProcessing->process_waveform(waveforms);
-  int n_channels = processed_waveforms.size();
+  WaveformProcessing->process_waveform(m_waveforms);
+  int n_channels = m_waveforms.size();
   for (int i = 0; i < n_channels; i++)
   {
     // this is for copying the truth info to the downstream object
     TowerInfo *towerwaveform = m_CalowaveformContainer->get_tower_at_channel(i);
     TowerInfo *towerinfo = m_CaloInfoContainer->get_tower_at_channel(i);
     towerinfo->copy_tower(towerwaveform);
-    towerinfo->set_time(processed_waveforms.at(i).at(1));
-    towerinfo->set_energy(processed_waveforms.at(i).at(0));
-    towerinfo->set_time_float(processed_waveforms.at(i).at(1));
-    towerinfo->set_pedestal(processed_waveforms.at(i).at(2));
-    towerinfo->set_chi2(processed_waveforms.at(i).at(3));
-    bool SZS = isSZS(processed_waveforms.at(i).at(1), processed_waveforms.at(i).at(3));
-    if (processed_waveforms.at(i).at(4) == 0)
+    towerinfo->set_time(m_waveforms.get_time(i));
+    towerinfo->set_energy(m_waveforms.get_amplitude(i));
+    towerinfo->set_time_float(m_waveforms.get_time(i));
+    towerinfo->set_pedestal(m_waveforms.get_pedestal(i));
+    towerinfo->set_chi2(m_waveforms.get_chi2(i));
+    bool SZS = isSZS(m_waveforms.get_time(i), m_waveforms.get_chi2(i));
+    if (m_waveforms.get_recovered(i) == 0)
     {
       towerinfo->set_isRecovered(false);
     }
@@ -232,26 +235,27 @@ int CaloTowerBuilder::process_sim()
     {
       towerinfo->set_isRecovered(true);
     }
-    int n_samples = waveforms.at(i).size();
+    int n_samples = m_waveforms.get_nsamples(i);
+    const float *waveform = m_waveforms.get_samples(i);
     if (n_samples == m_nzerosuppsamples || SZS)
     {
       towerinfo->set_isZS(true);
     }
     for (int j = 0; j < n_samples; j++)
     {
-      towerinfo->set_waveform_value(j, waveforms.at(i).at(j));
-      if (std::round(waveforms.at(i).at(j)) >= m_saturation)
+      towerinfo->set_waveform_value(j, waveform[j]);
+      if (std::round(waveform[j]) >= m_saturation)
       {
         towerinfo->set_isSaturated(true);
       }
     }
   }
-  waveforms.clear();
+  m_waveforms.clear();
 
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
-int CaloTowerBuilder::process_data(PHCompositeNode *topNode, std::vector<std::vector<float>> &waveforms)
+int CaloTowerBuilder::process_data(PHCompositeNode *topNode, CaloWaveformBatch &waveforms)
 {
   std::variant<CaloPacketContainer *, Event *> event;
   if (m_UseOfflinePacketFlag)
@@ -329,36 +333,24 @@ int CaloTowerBuilder::process_data(PHCompositeNode *topNode, std::vector<std::ve
               for (int iskip = 0; iskip < 64; iskip++)
               {
                 n_pad_skip_mask++;
-                std::vector<float> waveform;
-                waveform.reserve(m_nsamples);
-
-                for (int samp = 0; samp < m_nzerosuppsamples; samp++)
-                {
-                  waveform.push_back(0);
-                }
-                waveforms.push_back(waveform);
-                waveform.clear();
+                waveforms.add_zero_channel(m_nzerosuppsamples);
               }
             }
           }
         }
 
-        std::vector<float> waveform;
-        waveform.reserve(m_nsamples);
         if (packet->iValue(channel, "SUPPRESSED"))
         {
-          waveform.push_back(packet->iValue(channel, "PRE"));
-          waveform.push_back(packet->iValue(channel, "POST"));
+          waveforms.add_zs_channel(packet->iValue(channel, "PRE"), packet->iValue(channel, "POST"));
         }
         else
         {
+          float *waveform = waveforms.add_channel(m_nsamples);
           for (int samp = 0; samp < m_nsamples; samp++)
           {
-            waveform.push_back(packet->iValue(samp, channel));
+            waveform[samp] = packet->iValue(samp, channel);
           }
         }
-        waveforms.push_back(waveform);
-        waveform.clear();
       }
 
       int nch_padded = nchannels;
@@ -374,15 +366,7 @@ int CaloTowerBuilder::process_data(PHCompositeNode *topNode, std::vector<std::ve
           {
             continue;
           }
-          std::vector<float> waveform;
-          waveform.reserve(m_nsamples);
-
-          for (int samp = 0; samp < m_nzerosuppsamples; samp++)
-          {
-            waveform.push_back(0);
-          }
-          waveforms.push_back(waveform);
-          waveform.clear();
+          waveforms.add_zero_channel(m_nzerosuppsamples);
         }
       }
     }
@@ -394,14 +378,7 @@ int CaloTowerBuilder::process_data(PHCompositeNode *topNode, std::vector<std::ve
         {
           continue;
         }
-        std::vector<float> waveform;
-        waveform.reserve(2);
-        for (int samp = 0; samp < m_nzerosuppsamples; samp++)
-        {
-          waveform.push_back(0);
-        }
-        waveforms.push_back(waveform);
-        waveform.clear();
+        waveforms.add_zero_channel(m_nzerosuppsamples);
       }
     }
     return Fun4AllReturnCodes::EVENT_OK;
@@ -447,20 +424,20 @@ int CaloTowerBuilder::process_event(PHCompositeNode *topNode)
   {
     return process_sim();
   }
-  std::vector<std::vector<float>> waveforms;
-  if (process_data(topNode, waveforms) == Fun4AllReturnCodes::ABORTEVENT)
+  m_waveforms.clear();
+  if (process_data(topNode, m_waveforms) == Fun4AllReturnCodes::ABORTEVENT)
   {
     return Fun4AllReturnCodes::ABORTEVENT;
   }
-  if (waveforms.empty())
+  if (m_waveforms.empty())
   {
     return Fun4AllReturnCodes::EVENT_OK;
   }
-  // waveform vector is filled here, now fill our output. methods from the base class make sure
+  // waveform matrix is filled here, now fill our output. methods from the base class make sure
   // we only fill what the chosen container version supports
-  std::vector<std::vector<float>> processed_waveforms = WaveformProcessing->process_waveform(waveforms);
+  WaveformProcessing->process_waveform(m_waveforms);
 
-  int n_channels = processed_waveforms.size();
+  int n_channels = m_waveforms.size();
   for (int i = 0; i < n_channels; i++)
   {
     int idx = i;
@@ -470,13 +447,13 @@ int CaloTowerBuilder::process_event(PHCompositeNode *topNode)
       idx = cdbttree_sepd_map->GetIntValue(i, m_fieldname);
     }
     TowerInfo *towerinfo = m_CaloInfoContainer->get_tower_at_channel(i);
-    towerinfo->set_time(processed_waveforms.at(idx).at(1));
-    towerinfo->set_energy(processed_waveforms.at(idx).at(0));
-    towerinfo->set_time_float(processed_waveforms.at(idx).at(1));
-    towerinfo->set_pedestal(processed_waveforms.at(idx).at(2));
-    towerinfo->set_chi2(processed_waveforms.at(idx).at(3));
-    bool SZS = isSZS(processed_waveforms.at(idx).at(1), processed_waveforms.at(idx).at(3));
-    if (processed_waveforms.at(idx).at(4) == 0)
+    towerinfo->set_time(m_waveforms.get_time(idx));
+    towerinfo->set_energy(m_waveforms.get_amplitude(idx));
+    towerinfo->set_time_float(m_waveforms.get_time(idx));
+    towerinfo->set_pedestal(m_waveforms.get_pedestal(idx));
+    towerinfo->set_chi2(m_waveforms.get_chi2(idx));
+    bool SZS = isSZS(m_waveforms.get_time(idx), m_waveforms.get_chi2(idx));
+    if (m_waveforms.get_recovered(idx) == 0)
     {
       towerinfo->set_isRecovered(false);
     }
@@ -484,10 +461,11 @@ int CaloTowerBuilder::process_event(PHCompositeNode *topNode)
     {
       towerinfo->set_isRecovered(true);
     }
-    int n_samples = waveforms.at(idx).size();
+    int n_samples = m_waveforms.get_nsamples(idx);
+    const float *waveform = m_waveforms.get_samples(idx);
     if (n_samples == m_nzerosuppsamples || SZS)
     {
-      if (waveforms.at(idx).at(0) == 0)
+      if (waveform[0] == 0)
       {
         towerinfo->set_isNotInstr(true);
       }
@@ -499,14 +477,14 @@ int CaloTowerBuilder::process_event(PHCompositeNode *topNode)
 
     for (int j = 0; j < n_samples; j++)
     {
-      if (std::round(waveforms.at(idx).at(j)) >= m_saturation)
+      if (std::round(waveform[j]) >= m_saturation)
       {
         towerinfo->set_isSaturated(true);
       }
-      towerinfo->set_waveform_value(j, waveforms.at(idx).at(j));
+      towerinfo->set_waveform_value(j, waveform[j]);
     }
   }
-  waveforms.clear();
+  m_waveforms.clear();
 
   return Fun4AllReturnCodes::EVENT_OK;
 }
@@ -638,6 +616,10 @@ void CaloTowerBuilder::CreateNodeTree(PHCompositeNode *topNode)
   {
     m_CaloInfoContainer = new TowerInfoContainerSimv1(DetectorEnum);
   }
+  else if (m_buildertype == CaloTowerDefs::kPRDFTowerv5)
+  {
+    m_CaloInfoContainer = new TowerInfoContainerv5(DetectorEnum);
+  }
   else
   {
     std::cout << PHWHERE << "invalid builder type " << m_buildertype << std::endl;
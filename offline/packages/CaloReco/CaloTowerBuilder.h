@@ -4,6 +4,7 @@
 #define CALORECO_CALOTOWERBUILDER_H
 
 #include "CaloTowerDefs.h"
+#include "CaloWaveformBatch.h"
 #include "CaloWaveformProcessing.h"
 
 #include <cdbobjects/CDBTTree.h>  // for CDBTTree
@@ -29,7 +30,7 @@ class CaloTowerBuilder : public SubsysReco
 
   void CreateNodeTree(PHCompositeNode *topNode);
 
-  int process_data(PHCompositeNode *topNode, std::vector<std::vector<float>> &waveforms);
+  int process_data(PHCompositeNode *topNode, CaloWaveformBatch &waveforms);
 
   void set_detector_type(CaloTowerDefs::DetectorSystem dettype)
   {
@@ -116,6 +117,9 @@ class CaloTowerBuilder : public SubsysReco
   CaloWaveformProcessing *WaveformProcessing{nullptr};
   TowerInfoContainer *m_CaloInfoContainer{nullptr};      //! Calo info
   TowerInfoContainer *m_CalowaveformContainer{nullptr};  // waveform from simulation
+
+  // channels x samples waveforms and fit results, reused between events
+  CaloWaveformBatch m_waveforms;
   CDBTTree *cdbttree = nullptr;
   CDBTTree *cdbttree_sepd_map = nullptr;
   CDBTTree *cdbttree_tbt_zs = nullptr;
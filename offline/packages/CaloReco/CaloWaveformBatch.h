@@ -0,0 +1,126 @@
+#ifndef CALORECO_CALOWAVEFORMBATCH_H
+#define CALORECO_CALOWAVEFORMBATCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// channels x samples waveform matrix, with one row per channel, and matching fit result arrays.
+// Storage is kept across events: clear() only resets the number of channels,
+// so once reserved for the largest event no further allocation happens
+class CaloWaveformBatch
+{
+ public:
+  CaloWaveformBatch() = default;
+  ~CaloWaveformBatch() = default;
+
+  // allocate storage for nchannels channels with up to nsamples samples each
+  void reserve(int nchannels, int nsamples)
+  {
+    if (nsamples > m_maxsamples)
+    {
+      // re-layout existing rows with the larger stride
+      std::vector<float> samples(static_cast<std::size_t>(m_maxchannels) * nsamples, 0);
+      for (int ich = 0; ich < m_nchannels; ++ich)
+      {
+        std::copy_n(&m_samples[static_cast<std::size_t>(ich) * m_maxsamples], m_nsamples[ich], &samples[static_cast<std::size_t>(ich) * nsamples]);
+      }
+      m_samples.swap(samples);
+      m_maxsamples = nsamples;
+    }
+    if (nchannels > m_maxchannels)
+    {
+      m_maxchannels = nchannels;
+      m_samples.resize(static_cast<std::size_t>(m_maxchannels) * m_maxsamples, 0);
+      m_nsamples.resize(m_maxchannels, 0);
+      m_amplitude.resize(m_maxchannels, 0);
+      m_time.resize(m_maxchannels, 0);
+      m_pedestal.resize(m_maxchannels, 0);
+      m_chi2.resize(m_maxchannels, 0);
+      m_recovered.resize(m_maxchannels, 0);
+    }
+  }
+
+  // remove all channels, storage is kept
+  void clear() { m_nchannels = 0; }
+
+  // append a channel with nsamples samples and return its (uninitialized) samples
+  float *add_channel(int nsamples)
+  {
+    if (m_nchannels >= m_maxchannels || nsamples > m_maxsamples)
+    {
+      reserve(std::max(m_maxchannels, 2 * m_nchannels + 1), std::max(nsamples, m_maxsamples));
+    }
+    const int ich = m_nchannels++;
+    m_nsamples[ich] = nsamples;
+    return get_samples(ich);
+  }
+
+  // append a channel with nsamples samples set to zero
+  void add_zero_channel(int nsamples)
+  {
+    std::fill_n(add_channel(nsamples), nsamples, 0);
+  }
+
+  // append a zero suppressed channel, with pre and post samples
+  void add_zs_channel(float pre, float post)
+  {
+    float *samples = add_channel(2);
+    samples[0] = pre;
+    samples[1] = post;
+  }
+
+  int size() const { return m_nchannels; }
+  bool empty() const { return m_nchannels == 0; }
+  int get_max_samples() const { return m_maxsamples; }
+  int get_nsamples(int ich) const { return m_nsamples[ich]; }
+
+  float *get_samples(int ich) { return &m_samples[static_cast<std::size_t>(ich) * m_maxsamples]; }
+  const float *get_samples(int ich) const { return &m_samples[static_cast<std::size_t>(ich) * m_maxsamples]; }
+
+  // fit results
+  void set_result(int ich, float amplitude, float time, float pedestal, float chi2, float recovered)
+  {
+    m_amplitude[ich] = amplitude;
+    m_time[ich] = time;
+    m_pedestal[ich] = pedestal;
+    m_chi2[ich] = chi2;
+    m_recovered[ich] = recovered;
+  }
+
+  // set results for a channel from a {amplitude, time, pedestal, chi2, recovered} array
+  void set_result(int ich, const float *result)
+  {
+    set_result(ich, result[0], result[1], result[2], result[3], result[4]);
+  }
+
+  float get_amplitude(int ich) const { return m_amplitude[ich]; }
+  float get_time(int ich) const { return m_time[ich]; }
+  float get_pedestal(int ich) const { return m_pedestal[ich]; }
+  float get_chi2(int ich) const { return m_chi2[ich]; }
+  float get_recovered(int ich) const { return m_recovered[ich]; }
+
+  const float *get_amplitudes() const { return m_amplitude.data(); }
+  const float *get_times() const { return m_time.data(); }
+  const float *get_pedestals() const { return m_pedestal.data(); }
+  const float *get_chi2s() const { return m_chi2.data(); }
+
+ private:
+  int m_nchannels{0};
+  int m_maxchannels{0};
+  int m_maxsamples{0};
+
+  // samples, m_maxsamples per channel
+  std::vector<float> m_samples;
+
+  // number of valid samples per channel
+  std::vector<int> m_nsamples;
+
+  std::vector<float> m_amplitude;
+  std::vector<float> m_time;
+  std::vector<float> m_pedestal;
+  std::vector<float> m_chi2;
+  std::vector<float> m_recovered;
+};
+
+#endif
@@ -1,9 +1,9 @@
 #include "CaloWaveformFitting.h"
+#include "CaloWaveformBatch.h"
 
 #include <TF1.h>
 #include <TFile.h>
 #include <TProfile.h>
-#include <TSpline.h>
 
 #include <Fit/BinData.h>
 #include <Fit/Chi2FCN.h>
@@ -12,6 +12,7 @@
 #include <HFitInterface.h>
 #include <Math/WrappedMultiTF1.h>
 #include <Math/WrappedTF1.h>
+#include <ROOT/TSeq.hxx>
 #include <ROOT/TThreadExecutor.hxx>
 #include <ROOT/TThreadedObject.hxx>
 
@@ -62,260 +63,273 @@ std::vector<std::vector<float>> CaloWaveformFitting::calo_processing_templatefit
 {
   auto func = [&](std::vector<float> &v)
   {
+    // last element is the channel index
     int size1 = v.size() - 1;
-    if (size1 == _nzerosuppresssamples)
+    float result[5];
+    templatefit_channel(v.data(), size1, (int) round(v.at(size1)), result);
+    v.insert(v.end(), result, result + 5);
+  };
+
+  t->Foreach(func, chnlvector);
+  int size3 = chnlvector.size();
+  std::vector<std::vector<float>> fit_params;
+  std::vector<float> fit_params_tmp;
+  for (int i = 0; i < size3; i++)
+  {
+    const std::vector<float> &tv = chnlvector.at(i);
+    int size2 = tv.size();
+    for (int q = 5; q > 0; q--)
     {
-      v.push_back(v.at(1) - v.at(0));                        // returns peak sample - pedestal sample
-      v.push_back(std::numeric_limits<float>::quiet_NaN());  // set time to qnan for ZS
-      v.push_back(v.at(0));
-      if (v.at(0) != 0 && v.at(1) == 0)  // check if post-sample is 0, if so set high chi2
-      {
-        v.push_back(1000000);
-      }
-      else
-      {
-        v.push_back(std::numeric_limits<float>::quiet_NaN());
-      }
-      v.push_back(0);
+      fit_params_tmp.push_back(tv.at(size2 - q));
+    }
+    fit_params.push_back(fit_params_tmp);
+    fit_params_tmp.clear();
+  }
+  chnlvector.clear();
+  return fit_params;
+}
+
+void CaloWaveformFitting::calo_processing_templatefit(CaloWaveformBatch &batch)
+{
+  auto func = [&](int ich)
+  {
+    float result[5];
+    templatefit_channel(batch.get_samples(ich), batch.get_nsamples(ich), ich, result);
+    batch.set_result(ich, result);
+  };
+  t->Foreach(func, ROOT::TSeqI(batch.size()));
+}
+
+void CaloWaveformFitting::templatefit_channel(const float *v, int size1, int index, float *result)
+{
+  if (size1 == _nzerosuppresssamples)
+  {
+    result[0] = v[1] - v[0];                               // returns peak sample - pedestal sample
+    result[1] = std::numeric_limits<float>::quiet_NaN();  // set time to qnan for ZS
+    result[2] = v[0];
+    if (v[0] != 0 && v[1] == 0)  // check if post-sample is 0, if so set high chi2
+    {
+      result[3] = 1000000;
     }
     else
     {
-      float maxheight = 0;
-      int maxbin = 0;
+      result[3] = std::numeric_limits<float>::quiet_NaN();
+    }
+    result[4] = 0;
+    return;
+  }
+
+  float maxheight = 0;
+  int maxbin = 0;
+  for (int i = 0; i < size1; i++)
+  {
+    if (v[i] > maxheight)
+    {
+      maxheight = v[i];
+      maxbin = i;
+    }
+  }
+  float pedestal = 1500;
+  if (maxbin > 4)
+  {
+    pedestal = 0.5 * (v[maxbin - 4] + v[maxbin - 5]);
+  }
+  else if (maxbin > 3)
+  {
+    pedestal = (v[maxbin - 4]);
+  }
+  else
+  {
+    pedestal = 0.5 * (v[size1 - 3] + v[size1 - 2]);
+  }
+
+  if ((_bdosoftwarezerosuppression && v[6] - v[0] < _nsoftwarezerosuppression) || (_maxsoftwarezerosuppression && maxheight - pedestal < _nsoftwarezerosuppression))
+  {
+    result[0] = v[6] - v[0];
+    result[1] = std::numeric_limits<float>::quiet_NaN();
+    result[2] = v[0];
+    if (v[0] != 0 && v[1] == 0)  // check if post-sample is 0, if so set high chi2
+    {
+      result[3] = 1000000;
+    }
+    else
+    {
+      result[3] = std::numeric_limits<float>::quiet_NaN();
+    }
+    result[4] = 0;
+    return;
+  }
+
+  auto *h = new TH1F(std::string("h_" + std::to_string(index)).c_str(), "", size1, -0.5, size1 - 0.5);
+
+  int ndata = 0;
+  for (int i = 0; i < size1; ++i)
+  {
+    if ((v[i] == 16383) && _handleSaturation)
+    {
+      continue;
+    }
+
+    h->SetBinContent(i + 1, v[i]);
+    h->SetBinError(i + 1, 1);
+    ndata++;
+  }
+  // if too many are saturated don't do the saturation recovery need enough ndf
+  if (ndata < (size1 - 4))
+  {
+    ndata = size1;
+    for (int i = 0; i < size1; ++i)
+    {
+      h->SetBinContent(i + 1, v[i]);
+      h->SetBinError(i + 1, 1);
+    }
+  }
+
+  auto *f = new TF1(std::string("f_" + std::to_string(index)).c_str(), this, &CaloWaveformFitting::template_function, 0, 31, 3, "CaloWaveformFitting", "template_function");
+  ROOT::Math::WrappedMultiTF1 *fitFunction = new ROOT::Math::WrappedMultiTF1(*f, 3);
+  ROOT::Fit::BinData data(size1, 1);
+  ROOT::Fit::FillData(data, h);
+  ROOT::Fit::Chi2Function *EPChi2 = new ROOT::Fit::Chi2Function(data, *fitFunction);
+  ROOT::Fit::Fitter *fitter = new ROOT::Fit::Fitter();
+  fitter->Config().MinimizerOptions().SetMinimizerType("GSLMultiFit");
+  fitter->Config().MinimizerOptions().SetPrintLevel(-1);
+  double params[] = {static_cast<double>(maxheight - pedestal), static_cast<double>(maxbin - m_peakTimeTemp), static_cast<double>(pedestal)};
+  // double params[] = {static_cast<double>(maxheight - pedestal), 0, static_cast<double>(pedestal)};
+  fitter->Config().SetParamsSettings(3, params);
+  fitter->Config().ParSettings(1).SetLimits(-1 * m_peakTimeTemp, size1 - m_peakTimeTemp);  // set lim on time par
+  if (m_setTimeLim)
+  {
+    fitter->Config().ParSettings(1).SetLimits(m_timeLim_low, m_timeLim_high);
+  }
+  fitter->FitFCN(*EPChi2, nullptr, data.Size(), true);
+  ROOT::Fit::FitResult fitres = fitter->Result();
+  double chi2min = fitres.MinFcnValue();
+  // chi2min /= size1 - 3;  // divide by the number of dof
+  chi2min /= ndata - 3;  // divide by the number of dof
+  if (chi2min > _chi2threshold && (f->GetParameter(2) < _bfr_highpedestalthreshold || pedestal < _bfr_highpedestalthreshold) && (f->GetParameter(2) > _bfr_lowpedestalthreshold || pedestal > _bfr_lowpedestalthreshold) && _dobitfliprecovery)
+  {
+    std::vector<float> rv;  // temporary recovered waveform
+    rv.reserve(size1);
+    for (int i = 0; i < size1; i++)
+    {
+      rv.push_back(v[i]);
+    }
+    unsigned int bits[3] = {8192, 4096, 2048};
+    for (auto bit : bits)
+    {
       for (int i = 0; i < size1; i++)
       {
-        if (v.at(i) > maxheight)
+        if (((unsigned int) rv.at(i) & bit) && ((unsigned int) rv.at(i) % bit > _bfr_lowpedestalthreshold))
         {
-          maxheight = v.at(i);
-          maxbin = i;
+          rv.at(i) = rv.at(i) - bit;
         }
       }
-      float pedestal = 1500;
-      if (maxbin > 4)
-      {
-        pedestal = 0.5 * (v.at(maxbin - 4) + v.at(maxbin - 5));
-      }
-      else if (maxbin > 3)
-      {
-        pedestal = (v.at(maxbin - 4));
-      }
-      else
+    }
+    for (int i = 0; i < size1; i++)
+    {
+      h->SetBinContent(i + 1, rv.at(i));
+      h->SetBinError(i + 1, 1);
+    }
+
+    maxheight = 0;
+    maxbin = 0;
+    for (int i = 0; i < size1; i++)
+    {
+      if (rv.at(i) > maxheight)
       {
-        pedestal = 0.5 * (v.at(size1 - 3) + v.at(size1 - 2));
+        maxheight = rv.at(i);
+        maxbin = i;
       }
+    }
+    if (maxbin > 4)
+    {
+      pedestal = 0.5 * (rv.at(maxbin - 4) + rv.at(maxbin - 5));
+    }
+    else if (maxbin > 3)
+    {
+      pedestal = (rv.at(maxbin - 4));
+    }
+    else
+    {
+      pedestal = 0.5 * (rv.at(size1 - 3) + rv.at(size1 - 2));
+    }
 
-      if ((_bdosoftwarezerosuppression && v.at(6) - v.at(0) < _nsoftwarezerosuppression) || (_maxsoftwarezerosuppression && maxheight - pedestal < _nsoftwarezerosuppression))
+    auto *recover_f = new TF1(std::string("recover_f_" + std::to_string(index)).c_str(), this, &CaloWaveformFitting::template_function, 0, 31, 3, "CaloWaveformFitting", "template_function");
+    ROOT::Math::WrappedMultiTF1 *recoverFitFunction = new ROOT::Math::WrappedMultiTF1(*recover_f, 3);
+    ROOT::Fit::BinData recoverData(rv.size() - 1, 1);
+    ROOT::Fit::FillData(recoverData, h);
+    ROOT::Fit::Chi2Function *recoverEPChi2 = new ROOT::Fit::Chi2Function(recoverData, *recoverFitFunction);
+    ROOT::Fit::Fitter *recoverFitter = new ROOT::Fit::Fitter();
+    recoverFitter->Config().MinimizerOptions().SetMinimizerType("GSLMultiFit");
+    double recover_params[] = {static_cast<double>(maxheight - pedestal), 0, static_cast<double>(pedestal)};
+    recoverFitter->Config().SetParamsSettings(3, recover_params);
+    recoverFitter->Config().ParSettings(1).SetLimits(-1 * m_peakTimeTemp, size1 - m_peakTimeTemp);  // set lim on time par
+    recoverFitter->FitFCN(*recoverEPChi2, nullptr, recoverData.Size(), true);
+    ROOT::Fit::FitResult recover_fitres = recoverFitter->Result();
+    double recover_chi2min = recover_fitres.MinFcnValue();
+    recover_chi2min /= size1 - 3;  // divide by the number of dof
+    if (recover_chi2min < _chi2lowthreshold && recover_f->GetParameter(2) < _bfr_highpedestalthreshold && recover_f->GetParameter(2) > _bfr_lowpedestalthreshold)
+    {
+      for (int i = 0; i < 3; i++)
       {
-        v.push_back(v.at(6) - v.at(0));
-        v.push_back(std::numeric_limits<float>::quiet_NaN());
-        v.push_back(v.at(0));
-        if (v.at(0) != 0 && v.at(1) == 0)  // check if post-sample is 0, if so set high chi2
-        {
-          v.push_back(1000000);
-        }
-        else
-        {
-          v.push_back(std::numeric_limits<float>::quiet_NaN());
-        }
-        v.push_back(0);
+        result[i] = recover_f->GetParameter(i);
       }
-      else
+      result[3] = recover_chi2min;
+      result[4] = 1;
+    }
+    else
+    {
+      for (int i = 0; i < 3; i++)
       {
-        auto *h = new TH1F(std::string("h_" + std::to_string((int) round(v.at(size1)))).c_str(), "", size1, -0.5, size1 - 0.5);
-
-        int ndata = 0;
-        for (int i = 0; i < size1; ++i)
-        {
-          if ((v.at(i) == 16383) && _handleSaturation)
-          {
-            continue;
-          }
-
-          h->SetBinContent(i + 1, v.at(i));
-          h->SetBinError(i + 1, 1);
-          ndata++;
-        }
-        // if too many are saturated don't do the saturation recovery need enough ndf
-        if (ndata < (size1 - 4))
-        {
-          ndata = size1;
-          for (int i = 0; i < size1; ++i)
-          {
-            h->SetBinContent(i + 1, v.at(i));
-            h->SetBinError(i + 1, 1);
-          }
-        }
-
-        auto *f = new TF1(std::string("f_" + std::to_string((int) round(v.at(size1)))).c_str(), this, &CaloWaveformFitting::template_function, 0, 31, 3, "CaloWaveformFitting", "template_function");
-        ROOT::Math::WrappedMultiTF1 *fitFunction = new ROOT::Math::WrappedMultiTF1(*f, 3);
-        ROOT::Fit::BinData data(v.size() - 1, 1);
-        ROOT::Fit::FillData(data, h);
-        ROOT::Fit::Chi2Function *EPChi2 = new ROOT::Fit::Chi2Function(data, *fitFunction);
-        ROOT::Fit::Fitter *fitter = new ROOT::Fit::Fitter();
-        fitter->Config().MinimizerOptions().SetMinimizerType("GSLMultiFit");
-        fitter->Config().MinimizerOptions().SetPrintLevel(-1);
-        double params[] = {static_cast<double>(maxheight - pedestal), static_cast<double>(maxbin - m_peakTimeTemp), static_cast<double>(pedestal)};
-        // double params[] = {static_cast<double>(maxheight - pedestal), 0, static_cast<double>(pedestal)};
-        fitter->Config().SetParamsSettings(3, params);
-        fitter->Config().ParSettings(1).SetLimits(-1 * m_peakTimeTemp, size1 - m_peakTimeTemp);  // set lim on time par
-        if (m_setTimeLim)
-        {
-          fitter->Config().ParSettings(1).SetLimits(m_timeLim_low, m_timeLim_high);
-        }
-        fitter->FitFCN(*EPChi2, nullptr, data.Size(), true);
-        ROOT::Fit::FitResult fitres = fitter->Result();
-        // get the result status
-        /*
-        bool validfit = fitres.IsValid();
-        if(!validfit)
-        {
-          std::cout<<"invalid fit"<<std::endl;
-          for (int i = 0; i < size1; ++i)
-        {
-          std::cout<<v.at(i)<<std::endl;
-        }
-        }
-        */
-        double chi2min = fitres.MinFcnValue();
-        // chi2min /= size1 - 3;  // divide by the number of dof
-        chi2min /= ndata - 3;  // divide by the number of dof
-        if (chi2min > _chi2threshold && (f->GetParameter(2) < _bfr_highpedestalthreshold || pedestal < _bfr_highpedestalthreshold) && (f->GetParameter(2) > _bfr_lowpedestalthreshold || pedestal > _bfr_lowpedestalthreshold) && _dobitfliprecovery)
-        {
-          std::vector<float> rv;  // temporary recovered waveform
-          rv.reserve(size1);
-          for (int i = 0; i < size1; i++)
-          {
-            rv.push_back(v.at(i));
-          }
-          unsigned int bits[3] = {8192, 4096, 2048};
-          for (auto bit : bits)
-          {
-            for (int i = 0; i < size1; i++)
-            {
-              if (((unsigned int) rv.at(i) & bit) && ((unsigned int) rv.at(i) % bit > _bfr_lowpedestalthreshold))
-              {
-                rv.at(i) = rv.at(i) - bit;
-              }
-            }
-          }
-          for (int i = 0; i < size1; i++)
-          {
-            h->SetBinContent(i + 1, rv.at(i));
-            h->SetBinError(i + 1, 1);
-          }
-
-          maxheight = 0;
-          maxbin = 0;
-          for (int i = 0; i < size1; i++)
-          {
-            if (rv.at(i) > maxheight)
-            {
-              maxheight = rv.at(i);
-              maxbin = i;
-            }
-          }
-          if (maxbin > 4)
-          {
-            pedestal = 0.5 * (rv.at(maxbin - 4) + rv.at(maxbin - 5));
-          }
-          else if (maxbin > 3)
-          {
-            pedestal = (rv.at(maxbin - 4));
-          }
-          else
-          {
-            pedestal = 0.5 * (rv.at(size1 - 3) + rv.at(size1 - 2));
-          }
-
-          auto *recover_f = new TF1(std::string("recover_f_" + std::to_string((int) round(v.at(size1)))).c_str(), this, &CaloWaveformFitting::template_function, 0, 31, 3, "CaloWaveformFitting", "template_function");
-          ROOT::Math::WrappedMultiTF1 *recoverFitFunction = new ROOT::Math::WrappedMultiTF1(*recover_f, 3);
-          ROOT::Fit::BinData recoverData(rv.size() - 1, 1);
-          ROOT::Fit::FillData(recoverData, h);
-          ROOT::Fit::Chi2Function *recoverEPChi2 = new ROOT::Fit::Chi2Function(recoverData, *recoverFitFunction);
-          ROOT::Fit::Fitter *recoverFitter = new ROOT::Fit::Fitter();
-          recoverFitter->Config().MinimizerOptions().SetMinimizerType("GSLMultiFit");
-          double recover_params[] = {static_cast<double>(maxheight - pedestal), 0, static_cast<double>(pedestal)};
-          recoverFitter->Config().SetParamsSettings(3, recover_params);
-          recoverFitter->Config().ParSettings(1).SetLimits(-1 * m_peakTimeTemp, size1 - m_peakTimeTemp);  // set lim on time par
-          recoverFitter->FitFCN(*recoverEPChi2, nullptr, recoverData.Size(), true);
-          ROOT::Fit::FitResult recover_fitres = recoverFitter->Result();
-          double recover_chi2min = recover_fitres.MinFcnValue();
-          recover_chi2min /= size1 - 3;  // divide by the number of dof
-          if (recover_chi2min < _chi2lowthreshold && recover_f->GetParameter(2) < _bfr_highpedestalthreshold && recover_f->GetParameter(2) > _bfr_lowpedestalthreshold)
-          {
-            for (int i = 0; i < size1; i++)
-            {
-              v.at(i) = rv.at(i);
-            }
-            for (int i = 0; i < 3; i++)
-            {
-              v.push_back(recover_f->GetParameter(i));
-            }
-            v.push_back(recover_chi2min);
-            v.push_back(1);
-          }
-          else
-          {
-            for (int i = 0; i < 3; i++)
-            {
-              v.push_back(f->GetParameter(i));
-            }
-            v.push_back(chi2min);
-            v.push_back(0);
-          }
-          recover_f->Delete();
-          delete recoverFitFunction;
-          delete recoverFitter;
-          delete recoverEPChi2;
-        }
-        else
-        {
-          for (int i = 0; i < 3; i++)
-          {
-            v.push_back(f->GetParameter(i));
-          }
-          v.push_back(chi2min);
-          v.push_back(0);
-        }
-        h->Delete();
-        f->Delete();
-        delete fitFunction;
-        delete fitter;
-        delete EPChi2;
+        result[i] = f->GetParameter(i);
       }
+      result[3] = chi2min;
+      result[4] = 0;
     }
-  };
-
-  t->Foreach(func, chnlvector);
-  int size3 = chnlvector.size();
-  std::vector<std::vector<float>> fit_params;
-  std::vector<float> fit_params_tmp;
-  for (int i = 0; i < size3; i++)
+    recover_f->Delete();
+    delete recoverFitFunction;
+    delete recoverFitter;
+    delete recoverEPChi2;
+  }
+  else
   {
-    const std::vector<float> &tv = chnlvector.at(i);
-    int size2 = tv.size();
-    for (int q = 5; q > 0; q--)
+    for (int i = 0; i < 3; i++)
     {
-      fit_params_tmp.push_back(tv.at(size2 - q));
+      result[i] = f->GetParameter(i);
     }
-    fit_params.push_back(fit_params_tmp);
-    fit_params_tmp.clear();
+    result[3] = chi2min;
+    result[4] = 0;
   }
-  chnlvector.clear();
-  return fit_params;
+  h->Delete();
+  f->Delete();
+  delete fitFunction;
+  delete fitter;
+  delete EPChi2;
 }
 
 void CaloWaveformFitting::FastMax(float x0, float x1, float x2, float y0, float y1, float y2, float &xmax, float &ymax)
 {
-  int n = 3;
+  // natural cubic spline through the three points, as TSpline3 with "b2e2" and zero second derivative at both ends,
+  // computed in closed form to avoid allocating a TSpline3 per channel.
+  // On segment i, y = Y + B*dx + C*dx^2 + D*dx^3, with dx = x - xp[i]
   double xp[3] = {x0, x1, x2};
   double yp[3] = {y0, y1, y2};
-  TSpline3 *sp = new TSpline3("", xp, yp, n, "b2e2", 0, 0);
-  double X;
-  double Y;
-  double B;
-  double C;
-  double D;
+  double hp[2] = {xp[1] - xp[0], xp[2] - xp[1]};
+
+  // second derivatives at the three points
+  double mp[3] = {0, 3 * ((yp[2] - yp[1]) / hp[1] - (yp[1] - yp[0]) / hp[0]) / (hp[0] + hp[1]), 0};
+
+  double X = 0;
+  double Y = 0;
+  double B = 0;
+  double C = 0;
+  double D = 0;
+  auto eval = [&](double x)
+  {
+    double dx = x - X;
+    return Y + dx * (B + dx * (C + dx * D));
+  };
+
   ymax = y1;
   xmax = x1;
   if (y0 > ymax)
@@ -330,7 +344,11 @@ void CaloWaveformFitting::FastMax(float x0, float x1, float x2, float y0, float
   }
   for (int i = 0; i <= 1; i++)
   {
-    sp->GetCoeff(i, X, Y, B, C, D);
+    X = xp[i];
+    Y = yp[i];
+    B = (yp[i + 1] - yp[i]) / hp[i] - hp[i] * (2 * mp[i] + mp[i + 1]) / 6;
+    C = mp[i] / 2;
+    D = (mp[i + 1] - mp[i]) / (6 * hp[i]);
     if (D == 0)
     {
       if (C < 0)
@@ -340,7 +358,7 @@ void CaloWaveformFitting::FastMax(float x0, float x1, float x2, float y0, float
         float root = (-B / (2 * C)) + X;
         if (root >= xp[i] && root <= xp[i + 1])
         {
-          float yvalue = sp->Eval(root);
+          float yvalue = eval(root);
           if (yvalue > ymax)
           {
             ymax = yvalue;
@@ -355,7 +373,7 @@ void CaloWaveformFitting::FastMax(float x0, float x1, float x2, float y0, float
       float root = ((-2 * C + sqrt((4 * C * C) - (12 * B * D))) / (6 * D)) + X;
       if (root >= xp[i] && root <= xp[i + 1])
       {
-        float yvalue = sp->Eval(root);
+        float yvalue = eval(root);
         if (yvalue > ymax)
         {
           ymax = yvalue;
@@ -365,7 +383,7 @@ void CaloWaveformFitting::FastMax(float x0, float x1, float x2, float y0, float
       root = (-2 * C - sqrt((4 * C * C) - (12 * B * D))) / (6 * D) + X;
       if (root >= xp[i] && root <= xp[i + 1])
       {
-        float yvalue = sp->Eval(root);
+        float yvalue = eval(root);
         if (yvalue > ymax)
         {
           ymax = yvalue;
@@ -374,103 +392,140 @@ void CaloWaveformFitting::FastMax(float x0, float x1, float x2, float y0, float
       }
     }
   }
-  delete sp;
   return;
 }
-std::vector<std::vector<float>> CaloWaveformFitting::calo_processing_fast(const std::vector<std::vector<float>> &chnlvector)
+
+void CaloWaveformFitting::fast_channel(const float *v, int nsamples, float *result)
 {
-  std::vector<std::vector<float>> fit_values;
-  int nchnls = chnlvector.size();
-  for (int m = 0; m < nchnls; m++)
+  double maxy = v[0];
+  float amp = 0;
+  float time = 0;
+  float ped = 0;
+  float chi2 = std::numeric_limits<float>::quiet_NaN();
+  if (nsamples == 2)
   {
-    const std::vector<float> &v = chnlvector.at(m);
-    int nsamples = v.size();
-
-    double maxy = v.at(0);
-    float amp = 0;
-    float time = 0;
-    float ped = 0;
-    float chi2 = std::numeric_limits<float>::quiet_NaN();
-    if (nsamples == 2)
+    amp = v[1];
+    time = std::numeric_limits<float>::quiet_NaN();
+    ped = v[0];
+    if (v[0] != 0 && v[1] == 0)  // check if post-sample is 0, if so set high chi2
     {
-      amp = v.at(1);
-      time = std::numeric_limits<float>::quiet_NaN();
-      ped = v.at(0);
-      if (v.at(0) != 0 && v.at(1) == 0)  // check if post-sample is 0, if so set high chi2
-      {
-        chi2 = 1000000;
-      }
+      chi2 = 1000000;
     }
-    else if (nsamples >= 3)
+  }
+  else if (nsamples >= 3)
+  {
+    int maxx = 0;
+    for (int i = 0; i < nsamples; i++)
     {
-      int maxx = 0;
-      for (int i = 0; i < nsamples; i++)
+      if (i < 3)
       {
-        if (i < 3)
-        {
-          ped += v.at(i);
-        }
-        if (v.at(i) > maxy)
-        {
-          maxy = v.at(i);
-          maxx = i;
-        }
-      }
-      ped /= 3;
-      // if maxx <=5 nsample >=10 use the last two sample for pedestal(for HCal TP)
-      if (maxx <= 5 && nsamples >= 10)
-      {
-        ped = 0.5 * (v.at(nsamples - 2) + v.at(nsamples - 1));
+        ped += v[i];
       }
-      if (maxx == 0 || maxx == nsamples - 1)
+      if (v[i] > maxy)
       {
-        amp = maxy;
-        time = maxx;
-      }
-      else
-      {
-        FastMax(maxx - 1, maxx, maxx + 1, v.at(maxx - 1), v.at(maxx), v.at(maxx + 1), time, amp);
+        maxy = v[i];
+        maxx = i;
       }
     }
-    amp -= ped;
-    std::vector<float> val = {amp, time, ped, chi2, 0};
-    fit_values.push_back(val);
-    val.clear();
+    ped /= 3;
+    // if maxx <=5 nsample >=10 use the last two sample for pedestal(for HCal TP)
+    if (maxx <= 5 && nsamples >= 10)
+    {
+      ped = 0.5 * (v[nsamples - 2] + v[nsamples - 1]);
+    }
+    if (maxx == 0 || maxx == nsamples - 1)
+    {
+      amp = maxy;
+      time = maxx;
+    }
+    else
+    {
+      FastMax(maxx - 1, maxx, maxx + 1, v[maxx - 1], v[maxx], v[maxx + 1], time, amp);
+    }
   }
-  return fit_values;
+  amp -= ped;
+  result[0] = amp;
+  result[1] = time;
+  result[2] = ped;
+  result[3] = chi2;
+  result[4] = 0;
 }
 
-std::vector<std::vector<float>> CaloWaveformFitting::calo_processing_nyquist(const std::vector<std::vector<float>> &chnlvector)
+std::vector<std::vector<float>> CaloWaveformFitting::calo_processing_fast(const std::vector<std::vector<float>> &chnlvector)
 {
   std::vector<std::vector<float>> fit_values;
   int nchnls = chnlvector.size();
   for (int m = 0; m < nchnls; m++)
   {
-    std::vector<float> v = chnlvector.at(m);
-    int nsamples = (int) v.size();
+    const std::vector<float> &v = chnlvector.at(m);
+    float result[5];
+    fast_channel(v.data(), v.size(), result);
+    fit_values.emplace_back(result, result + 5);
+  }
+  return fit_values;
+}
 
-    if (nsamples == 2)
+void CaloWaveformFitting::calo_processing_fast(CaloWaveformBatch &batch)
+{
+  int nchnls = batch.size();
+  float result[5];
+  for (int m = 0; m < nchnls; m++)
+  {
+    fast_channel(batch.get_samples(m), batch.get_nsamples(m), result);
+    batch.set_result(m, result);
+  }
+}
+
+void CaloWaveformFitting::nyquist_channel(const float *v, int nsamples, float *result)
+{
+  if (nsamples == 2)
+  {
+    float chi2 = std::numeric_limits<float>::quiet_NaN();
+    if (v[0] != 0 && v[1] == 0)  // check if post-sample is 0, if so set high chi2
     {
-      float chi2 = std::numeric_limits<float>::quiet_NaN();
-      if (v.at(0) != 0 && v.at(1) == 0)  // check if post-sample is 0, if so set high chi2
-      {
-        chi2 = 1000000;
-      }
-      fit_values.push_back({v.at(1) - v.at(0), std::numeric_limits<float>::quiet_NaN(), v.at(0), chi2, 0});
-      continue;
+      chi2 = 1000000;
     }
+    result[0] = v[1] - v[0];
+    result[1] = std::numeric_limits<float>::quiet_NaN();
+    result[2] = v[0];
+    result[3] = chi2;
+    result[4] = 0;
+    return;
+  }
 
-    std::vector<float> result = NyquistInterpolation(v);
-    fit_values.push_back(result);
+  NyquistInterpolation(v, nsamples, result);
+}
+
+std::vector<std::vector<float>> CaloWaveformFitting::calo_processing_nyquist(const std::vector<std::vector<float>> &chnlvector)
+{
+  std::vector<std::vector<float>> fit_values;
+  int nchnls = chnlvector.size();
+  for (int m = 0; m < nchnls; m++)
+  {
+    const std::vector<float> &v = chnlvector.at(m);
+    float result[5];
+    nyquist_channel(v.data(), v.size(), result);
+    fit_values.emplace_back(result, result + 5);
   }
   return fit_values;
 }
+
+void CaloWaveformFitting::calo_processing_nyquist(CaloWaveformBatch &batch)
+{
+  int nchnls = batch.size();
+  float result[5];
+  for (int m = 0; m < nchnls; m++)
+  {
+    nyquist_channel(batch.get_samples(m), batch.get_nsamples(m), result);
+    batch.set_result(m, result);
+  }
+}
+
 // mabye I can find a way to make it thread safe
-std::vector<float> CaloWaveformFitting::NyquistInterpolation(std::vector<float> &vec_signal_samples)
+void CaloWaveformFitting::NyquistInterpolation(const float *vec_signal_samples, int N, float *result)
 {
-  // int N = (int) vec_signal_samples.size();
-  auto max_elem_iter = std::max_element(vec_signal_samples.begin(), vec_signal_samples.end());
-  int maxx = std::distance(vec_signal_samples.begin(), max_elem_iter);
+  const auto *max_elem_iter = std::max_element(vec_signal_samples, vec_signal_samples + N);
+  int maxx = std::distance(vec_signal_samples, max_elem_iter);
   float max = *max_elem_iter;
 
   float maxpos = maxx;
@@ -487,7 +542,7 @@ std::vector<float> CaloWaveformFitting::NyquistInterpolation(std::vector<float>
       float yval = max;
       if (i != maxpos)
       {
-        yval = psinc(i, vec_signal_samples);
+        yval = psinc(i, vec_signal_samples, N);
       }
       if (yval > max)
       {
@@ -518,21 +573,24 @@ std::vector<float> CaloWaveformFitting::NyquistInterpolation(std::vector<float>
     pedestal = max;
     for (float i = maxpos - 5; i < maxpos; i += 0.1)
     {
-      float yval = psinc(i, vec_signal_samples);
+      float yval = psinc(i, vec_signal_samples, N);
       pedestal = std::min(yval, pedestal);
     }
   }
   // calculate chi2 using the tempalte
   float chi2 = 0;
   double par[3] = {max - pedestal, maxpos - m_peakTimeTemp, pedestal};
-  for (int i = 0; i < (int) vec_signal_samples.size(); i++)
+  for (int i = 0; i < N; i++)
   {
     double xval[1] = {(double) i};
     float diff = vec_signal_samples[i] - template_function(xval, par);
     chi2 += diff * diff;
   }
-  std::vector<float> val = {max - pedestal, maxpos, pedestal, chi2, 0};
-  return val;
+  result[0] = max - pedestal;
+  result[1] = maxpos;
+  result[2] = pedestal;
+  result[3] = chi2;
+  result[4] = 0;
 }
 
 // for odd N
@@ -562,9 +620,8 @@ double CaloWaveformFitting::Dkernel(double x, int N)
   return sum;
 }
 
-float CaloWaveformFitting::stablepsinc(float time, std::vector<float> &vec_signal_samples)
+float CaloWaveformFitting::stablepsinc(float time, const float *vec_signal_samples, int N)
 {
-  int N = (int) vec_signal_samples.size();
   float sum = 0;
   if (N % 2 == 0)
   {
@@ -583,18 +640,16 @@ float CaloWaveformFitting::stablepsinc(float time, std::vector<float> &vec_signa
   return sum;
 }
 
-float CaloWaveformFitting::psinc(float time, std::vector<float> &vec_signal_samples)
+float CaloWaveformFitting::psinc(float time, const float *vec_signal_samples, int N)
 {
-  int N = (int) vec_signal_samples.size();
-
   if (std::abs(std::round(time) - time) < 1e-6)
   {
     if (time < 0 || time >= N)
     {
-      return stablepsinc(time, vec_signal_samples);
+      return stablepsinc(time, vec_signal_samples, N);
     }
 
-    return vec_signal_samples.at(std::round(time));
+    return vec_signal_samples[(int) std::round(time)];
   }
 
   float sum = 0;
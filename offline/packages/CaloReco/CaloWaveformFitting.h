@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+class CaloWaveformBatch;
 class TProfile;
 
 class CaloWaveformFitting
@@ -62,17 +63,27 @@ class CaloWaveformFitting
   static std::vector<std::vector<float>> calo_processing_fast(const std::vector<std::vector<float>> &chnlvector);
   std::vector<std::vector<float>> calo_processing_nyquist(const std::vector<std::vector<float>> &chnlvector);
 
+  // in place processing of a channels x samples batch. Results are stored in the batch
+  void calo_processing_templatefit(CaloWaveformBatch &batch);
+  static void calo_processing_fast(CaloWaveformBatch &batch);
+  void calo_processing_nyquist(CaloWaveformBatch &batch);
+
   void initialize_processing(const std::string &templatefile);
 
  private:
+  // single channel processing. result is {amplitude, time, pedestal, chi2, recovered}
+  void templatefit_channel(const float *v, int size1, int index, float *result);
+  static void fast_channel(const float *v, int nsamples, float *result);
+  void nyquist_channel(const float *v, int nsamples, float *result);
+
   static void FastMax(float x0, float x1, float x2, float y0, float y1, float y2, float &xmax, float &ymax);
-  std::vector<float> NyquistInterpolation(std::vector<float> &vec_signal_samples);
+  void NyquistInterpolation(const float *vec_signal_samples, int N, float *result);
   static double Dkernelodd(double x, int N);
   static double Dkernel(double x, int N);
 
-  static float stablepsinc(float t, std::vector<float> &vec_signal_samples);
+  static float stablepsinc(float t, const float *vec_signal_samples, int N);
 
-  static float psinc(float t, std::vector<float> &vec_signal_samples);
+  static float psinc(float t, const float *vec_signal_samples, int N);
   double template_function(double *x, double *par);
 
   TProfile *h_template{nullptr};
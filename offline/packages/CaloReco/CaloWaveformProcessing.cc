@@ -1,4 +1,5 @@
 #include "CaloWaveformProcessing.h"
+#include "CaloWaveformBatch.h"
 #include "CaloWaveformFitting.h"
 
 #include <ffamodules/CDBInterface.h>
@@ -94,102 +95,133 @@ std::vector<std::vector<float>> CaloWaveformProcessing::process_waveform(std::ve
   return fitresults;
 }
 
+void CaloWaveformProcessing::process_waveform(CaloWaveformBatch &batch)
+{
+  if (m_processingtype == CaloWaveformProcessing::TEMPLATE || m_processingtype == CaloWaveformProcessing::TEMPLATE_NOSAT)
+  {
+    m_Fitter->calo_processing_templatefit(batch);
+  }
+  if (m_processingtype == CaloWaveformProcessing::ONNX)
+  {
+    CaloWaveformProcessing::calo_processing_ONNX(batch);
+  }
+  if (m_processingtype == CaloWaveformProcessing::FAST)
+  {
+    CaloWaveformFitting::calo_processing_fast(batch);
+  }
+  if (m_processingtype == CaloWaveformProcessing::NYQUIST)
+  {
+    m_Fitter->calo_processing_nyquist(batch);
+  }
+}
+
 std::vector<std::vector<float>> CaloWaveformProcessing::calo_processing_ONNX(const std::vector<std::vector<float>> &chnlvector)
 {
   std::vector<std::vector<float>> fit_values;
-  std::vector<float> val;  // single row to return
   unsigned int nchnls = chnlvector.size();
   for (unsigned int m = 0; m < nchnls; m++)
   {
-    val.clear();
     const std::vector<float> &v = chnlvector.at(m);
-    int size1 = v.size();
-    if (size1 == _nzerosuppresssamples)
+    float result[5];
+    onnx_channel(v.data(), v.size(), result);
+    fit_values.emplace_back(result, result + 5);
+  }
+  return fit_values;
+}
+
+void CaloWaveformProcessing::calo_processing_ONNX(CaloWaveformBatch &batch)
+{
+  int nchnls = batch.size();
+  float result[5];
+  for (int m = 0; m < nchnls; m++)
+  {
+    onnx_channel(batch.get_samples(m), batch.get_nsamples(m), result);
+    batch.set_result(m, result);
+  }
+}
+
+void CaloWaveformProcessing::onnx_channel(const float *v, int size1, float *result)
+{
+  if (size1 == _nzerosuppresssamples)
+  {
+    result[0] = v[1] - v[0];
+    result[1] = std::numeric_limits<float>::quiet_NaN();
+    result[2] = v[0];
+    if (v[0] != 0 && v[1] == 0)  // check if post-sample is 0, if so set high chi2
     {
-      val.push_back(v.at(1) - v.at(0));
-      val.push_back(std::numeric_limits<float>::quiet_NaN());
-      val.push_back(v.at(0));
-      if (v.at(0) != 0 && v.at(1) == 0)  // check if post-sample is 0, if so set high chi2
-      {
-        val.push_back(1000000);
-      }
-      else
-      {
-        val.push_back(std::numeric_limits<float>::quiet_NaN());
-      }
-      val.push_back(0);
-      fit_values.push_back(val);
+      result[3] = 1000000;
     }
     else
     {
-      float maxheight = 0;
-      int maxbin = 0;
-      for (int i = 0; i < size1; i++)
-      {
-        if (v.at(i) > maxheight)
-        {
-          maxheight = v.at(i);
-          maxbin = i;
-        }
-      }
-      float pedestal = 1500;
-      if (maxbin > 4)
-      {
-        pedestal = 0.5 * (v.at(maxbin - 4) + v.at(maxbin - 5));
-      }
-      else if (maxbin > 3)
-      {
-        pedestal = (v.at(maxbin - 4));
-      }
-      else
-      {
-        pedestal = 0.5 * (v.at(size1 - 3) + v.at(size1 - 2));
-      }
+      result[3] = std::numeric_limits<float>::quiet_NaN();
+    }
+    result[4] = 0;
+    return;
+  }
 
-      if ((_bdosoftwarezerosuppression && v.at(6) - v.at(0) < _nsoftwarezerosuppression) || (_maxsoftwarezerosuppression && maxheight - pedestal < _nsoftwarezerosuppression))
-      {
-        val.push_back(v.at(6) - v.at(0));
-        val.push_back(std::numeric_limits<float>::quiet_NaN());
-        val.push_back(v.at(0));
-        if (v.at(0) != 0 && v.at(1) == 0)  // check if post-sample is 0, if so set high chi2
-        {
-          val.push_back(1000000);
-        }
-        else
-        {
-          val.push_back(std::numeric_limits<float>::quiet_NaN());
-        }
-        val.push_back(0);
-        fit_values.push_back(val);
-      }
-      else
-      {
-        unsigned int nsamples = v.size();
-        if (nsamples == 12)
-        {
-          // downstream onnx does not have a static input vector API,
-          // so we need to make a copy
-          std::vector<float> vtmp(v);
-          val = onnxInference(onnxmodule, vtmp, 1, 12, 3);
-          unsigned int nvals = val.size();
-          for (unsigned int i = 0; i < nvals; i++)
-          {
-            val.at(i) = val.at(i) * m_Onnx_factor[i] + m_Onnx_offset[i];
-          }
-          val.push_back(2000);
-          val.push_back(0);
-          fit_values.push_back(val);
-        }
-        else
-        {
-          float v_diff = v[1] - v[0];
-          std::vector<float> val1{v_diff, std::numeric_limits<float>::quiet_NaN(), v[1], std::numeric_limits<float>::quiet_NaN(), 0};
-          fit_values.push_back(val1);
-        }
-      }
+  float maxheight = 0;
+  int maxbin = 0;
+  for (int i = 0; i < size1; i++)
+  {
+    if (v[i] > maxheight)
+    {
+      maxheight = v[i];
+      maxbin = i;
     }
   }
-  return fit_values;
+  float pedestal = 1500;
+  if (maxbin > 4)
+  {
+    pedestal = 0.5 * (v[maxbin - 4] + v[maxbin - 5]);
+  }
+  else if (maxbin > 3)
+  {
+    pedestal = (v[maxbin - 4]);
+  }
+  else
+  {
+    pedestal = 0.5 * (v[size1 - 3] + v[size1 - 2]);
+  }
+
+  if ((_bdosoftwarezerosuppression && v[6] - v[0] < _nsoftwarezerosuppression) || (_maxsoftwarezerosuppression && maxheight - pedestal < _nsoftwarezerosuppression))
+  {
+    result[0] = v[6] - v[0];
+    result[1] = std::numeric_limits<float>::quiet_NaN();
+    result[2] = v[0];
+    if (v[0] != 0 && v[1] == 0)  // check if post-sample is 0, if so set high chi2
+    {
+      result[3] = 1000000;
+    }
+    else
+    {
+      result[3] = std::numeric_limits<float>::quiet_NaN();
+    }
+    result[4] = 0;
+  }
+  else if (size1 == 12)
+  {
+    // downstream onnx does not have a static input vector API,
+    // so we need to make a copy. The input buffer is reused between channels
+    m_onnx_input.assign(v, v + size1);
+    std::vector<float> val = onnxInference(onnxmodule, m_onnx_input, 1, 12, 3);
+    unsigned int nvals = val.size();
+    // defaults in case the model returns fewer than 3 values
+    std::fill_n(result, 3, 0);
+    for (unsigned int i = 0; i < nvals && i < 3; i++)
+    {
+      result[i] = val.at(i) * m_Onnx_factor[i] + m_Onnx_offset[i];
+    }
+    result[3] = 2000;
+    result[4] = 0;
+  }
+  else
+  {
+    result[0] = v[1] - v[0];
+    result[1] = std::numeric_limits<float>::quiet_NaN();
+    result[2] = v[1];
+    result[3] = std::numeric_limits<float>::quiet_NaN();
+    result[4] = 0;
+  }
 }
 
 int CaloWaveformProcessing::get_nthreads()
@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 
+class CaloWaveformBatch;
 class CaloWaveformFitting;
 
 class CaloWaveformProcessing : public SubsysReco
@@ -78,6 +79,12 @@ class CaloWaveformProcessing : public SubsysReco
   std::vector<std::vector<float>> process_waveform(std::vector<std::vector<float>> waveformvector);
   std::vector<std::vector<float>> calo_processing_ONNX(const std::vector<std::vector<float>> &chnlvector);
 
+  // in place processing of a channels x samples batch, results are stored in the batch.
+  // Unlike the vector based interface, this does no per-event allocation
+  // outside of the fitting itself
+  void process_waveform(CaloWaveformBatch &batch);
+  void calo_processing_ONNX(CaloWaveformBatch &batch);
+
   void initialize_processing();
 
   // onnx options
@@ -85,8 +92,14 @@ class CaloWaveformProcessing : public SubsysReco
   void set_onnx_offset(const int i, const double val) { m_Onnx_offset.at(i) = val; }
 
  private:
+  // single channel onnx processing. result is {amplitude, time, pedestal, chi2, recovered}
+  void onnx_channel(const float *v, int size1, float *result);
+
   CaloWaveformFitting *m_Fitter{nullptr};
 
+  // onnx input buffer
+  std::vector<float> m_onnx_input;
+
   CaloWaveformProcessing::process m_processingtype{CaloWaveformProcessing::TEMPLATE};
   int _nthreads{1};
   int _nzerosuppresssamples{2};
@@ -68,6 +68,7 @@
 #include <iterator>   // for end
 #include <map>        // for _Rb_tree_iterator, map
 #include <memory>     // for allocator_traits<>::va...
+#include <set>
 
 KFParticle_truthAndDetTools toolSet;
 
@@ -513,42 +514,89 @@ std::vector<int> KFParticle_Tools::findAllGoodTracks(const std::vector<KFParticl
   return goodTrackIndex;
 }
 
-std::vector<std::vector<int>> KFParticle_Tools::findTwoProngs(std::vector<KFParticle> daughterParticles, std::vector<int> goodTrackIndex, int nTracks)
+bool KFParticle_Tools::passDCACuts(const std::vector<KFParticle> &daughterParticles, int first, int second, DCACache *dcaCache, bool nanPasses)
+{
+  // bit 0: both DCAs below the cuts, as required by the two-prong search
+  // bit 1: no DCA above the cuts, as required by the N-prong search. Unlike bit 0 this lets NaN DCAs through
+  const signed char mask = nanPasses ? 2 : 1;
+  signed char *cached = nullptr;
+  if (dcaCache)
+  {
+    cached = &(*dcaCache)[first * daughterParticles.size() + second];
+    if (*cached >= 0)
+    {
+      return *cached & mask;
+    }
+  }
+
+  // the XY distance is only needed if the 3D one passes
+  signed char pass = 0;
+  float dca = daughterParticles[first].GetDistanceFromParticle(daughterParticles[second]);
+  if (!(dca > m_comb_DCA))
+  {
+    float dca_xy = abs(daughterParticles[first].GetDistanceFromParticleXY(daughterParticles[second]));
+    if (dca <= m_comb_DCA && dca_xy <= m_comb_DCA_xy)
+    {
+      pass |= 1;
+    }
+    if (!(dca_xy > m_comb_DCA_xy))
+    {
+      pass |= 2;
+    }
+  }
+
+  if (cached)
+  {
+    *cached = pass;
+  }
+  return pass & mask;
+}
+
+std::vector<std::vector<int>> KFParticle_Tools::findAllProngs(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int nRequiredTracks)
+{
+  // each N-prong step tests the new track against every track of the (N-1)-prongs,
+  // the same pairs come back many times so remember the answers
+  DCACache dcaCache(daughterParticles.size() * daughterParticles.size(), -1);
+
+  std::vector<std::vector<int>> goodTracksThatMeet = findTwoProngs(daughterParticles, goodTrackIndex, nRequiredTracks, &dcaCache);
+  for (int p = 3; p <= nRequiredTracks; ++p)
+  {
+    goodTracksThatMeet = findNProngs(daughterParticles, goodTrackIndex, goodTracksThatMeet, nRequiredTracks, p, &dcaCache);
+  }
+
+  return goodTracksThatMeet;
+}
+
+std::vector<std::vector<int>> KFParticle_Tools::findTwoProngs(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int nTracks, DCACache *dcaCache)
 {
   std::vector<std::vector<int>> goodTracksThatMeet;
 
-  for (std::vector<int>::iterator i_it = goodTrackIndex.begin(); i_it != goodTrackIndex.end(); ++i_it)
+  for (std::vector<int>::const_iterator i_it = goodTrackIndex.begin(); i_it != goodTrackIndex.end(); ++i_it)
   {
-    for (std::vector<int>::iterator j_it = goodTrackIndex.begin(); j_it != goodTrackIndex.end(); ++j_it)
+    for (std::vector<int>::const_iterator j_it = i_it + 1; j_it != goodTrackIndex.end(); ++j_it)
     {
-      if (i_it < j_it)
+      if (passDCACuts(daughterParticles, *i_it, *j_it, dcaCache))
       {
-        float dca = daughterParticles[*i_it].GetDistanceFromParticle(daughterParticles[*j_it]);
-        float dca_xy = abs(daughterParticles[*i_it].GetDistanceFromParticleXY(daughterParticles[*j_it]));
-
-        if (dca <= m_comb_DCA && dca_xy <= m_comb_DCA_xy)
+        KFVertex twoParticleVertex;
+        twoParticleVertex += daughterParticles[*i_it];
+        twoParticleVertex += daughterParticles[*j_it];
+        float vertexchi2ndof = twoParticleVertex.GetChi2() / twoParticleVertex.GetNDF();
+        float sv_radial_position = sqrt(pow(twoParticleVertex.GetX(), 2) + pow(twoParticleVertex.GetY(), 2));
+        std::vector<int> combination = {*i_it, *j_it};
+
+        if (nTracks == 2 && vertexchi2ndof > m_vertex_chi2ndof)
+        {
+          continue;
+        }
+        else
         {
-          KFVertex twoParticleVertex;
-          twoParticleVertex += daughterParticles[*i_it];
-          twoParticleVertex += daughterParticles[*j_it];
-          float vertexchi2ndof = twoParticleVertex.GetChi2() / twoParticleVertex.GetNDF();
-          float sv_radial_position = sqrt(pow(twoParticleVertex.GetX(), 2) + pow(twoParticleVertex.GetY(), 2));
-          std::vector<int> combination = {*i_it, *j_it};
-
-          if (nTracks == 2 && vertexchi2ndof > m_vertex_chi2ndof)
+          if (nTracks == 2 && sv_radial_position < m_min_radial_SV)
           {
             continue;
           }
           else
           {
-            if (nTracks == 2 && sv_radial_position < m_min_radial_SV)
-            {
-              continue;
-            }
-            else
-            {
-              goodTracksThatMeet.push_back(combination);
-            }
+            goodTracksThatMeet.push_back(combination);
           }
         }
       }
@@ -558,13 +606,20 @@ std::vector<std::vector<int>> KFParticle_Tools::findTwoProngs(std::vector<KFPart
   return goodTracksThatMeet;
 }
 
-std::vector<std::vector<int>> KFParticle_Tools::findNProngs(std::vector<KFParticle> daughterParticles,
+std::vector<std::vector<int>> KFParticle_Tools::findNProngs(const std::vector<KFParticle> &daughterParticles,
                                                             const std::vector<int> &goodTrackIndex,
                                                             std::vector<std::vector<int>> goodTracksThatMeet,
-                                                            int nRequiredTracks, unsigned int nProngs)
+                                                            int nRequiredTracks, unsigned int nProngs, DCACache *dcaCache)
 {
   unsigned int nGoodProngs = goodTracksThatMeet.size();
 
+  // The same set of tracks is reached from each of its (N-1)-prong subsets.
+  // Only the first accepted ordering is kept, so once a set is accepted the
+  // other orderings do not need to be fitted. Rejected sets are still tried
+  // in the other orderings since the vertex fit depends on the order.
+  std::set<std::vector<int>> acceptedCombinations;
+  std::vector<int> sortedCombination;
+
   for (auto &i_it : goodTrackIndex)
   {
     for (unsigned int i_prongs = 0; i_prongs < nGoodProngs; ++i_prongs)
@@ -579,15 +634,21 @@ std::vector<std::vector<int>> KFParticle_Tools::findNProngs(std::vector<KFPartic
       }
       if (trackNotUsedAlready)
       {
+        sortedCombination.assign(goodTracksThatMeet[i_prongs].begin(), goodTracksThatMeet[i_prongs].begin() + (nProngs - 1));
+        sortedCombination.push_back(i_it);
+        sort(sortedCombination.begin(), sortedCombination.end());
+        if (acceptedCombinations.contains(sortedCombination))
+        {
+          continue;
+        }
+
         bool dcaMet = true;
         for (unsigned int i = 0; i < nProngs - 1; ++i)
         {
-          float dca = daughterParticles[i_it].GetDistanceFromParticle(daughterParticles[goodTracksThatMeet[i_prongs][i]]);
-          float dca_xy = abs(daughterParticles[i_it].GetDistanceFromParticleXY(daughterParticles[goodTracksThatMeet[i_prongs][i]]));
-
-          if (dca > m_comb_DCA || dca_xy > m_comb_DCA_xy)
+          if (!passDCACuts(daughterParticles, i_it, goodTracksThatMeet[i_prongs][i], dcaCache, true))
           {
             dcaMet = false;
+            break;
           }
         }
 
@@ -618,6 +679,7 @@ std::vector<std::vector<int>> KFParticle_Tools::findNProngs(std::vector<KFPartic
             else
             {
               goodTracksThatMeet.push_back(combination);
+              acceptedCombinations.insert(sortedCombination);
             }
           }
         }
@@ -630,7 +692,7 @@ std::vector<std::vector<int>> KFParticle_Tools::findNProngs(std::vector<KFPartic
   {
     sort(i.begin(), i.end());
   }
-  removeDuplicates(goodTracksThatMeet);
+  // no duplicates left to remove, acceptedCombinations kept only the first of each set
 
   return goodTracksThatMeet;
 }
@@ -650,16 +712,7 @@ std::vector<std::vector<int>> KFParticle_Tools::appendTracksToIntermediates(KFPa
       {
         dummyTrackID.push_back(k);
       }
-      dummyTrackList = findTwoProngs(v_intermediateResonances, dummyTrackID, (int) v_intermediateResonances.size());
-      if (v_intermediateResonances.size() > 2)
-      {
-        for (unsigned int p = 3; p <= v_intermediateResonances.size(); ++p)
-        {
-          dummyTrackList = findNProngs(v_intermediateResonances,
-                                       dummyTrackID, dummyTrackList,
-                                       (int) v_intermediateResonances.size(), (int) p);
-        }
-      }
+      dummyTrackList = findAllProngs(v_intermediateResonances, dummyTrackID, (int) v_intermediateResonances.size());
 
       if (dummyTrackList.size() != 0)
       {
@@ -670,12 +723,7 @@ std::vector<std::vector<int>> KFParticle_Tools::appendTracksToIntermediates(KFPa
   }
   else
   {
-    goodTracksThatMeet = findTwoProngs(daughterParticles, goodTrackIndex, num_remaining_tracks);
-
-    for (int p = 3; p <= num_remaining_tracks; ++p)
-    {
-      goodTracksThatMeet = findNProngs(daughterParticles, goodTrackIndex, goodTracksThatMeet, num_remaining_tracks, p);
-    }
+    goodTracksThatMeet = findAllProngs(daughterParticles, goodTrackIndex, num_remaining_tracks);
 
     for (auto &i : goodTracksThatMeet)
     {
@@ -690,11 +738,7 @@ std::vector<std::vector<int>> KFParticle_Tools::appendTracksToIntermediates(KFPa
       {
         dummyTrackID.push_back(k);
       }
-      dummyTrackList = findTwoProngs(v_intermediateResonances, dummyTrackID, (int) v_intermediateResonances.size());
-      for (unsigned int p = 3; p <= v_intermediateResonances.size(); ++p)
-      {
-        dummyTrackList = findNProngs(v_intermediateResonances, dummyTrackID, dummyTrackList, (int) v_intermediateResonances.size(), (int) p);
-      }
+      dummyTrackList = findAllProngs(v_intermediateResonances, dummyTrackID, (int) v_intermediateResonances.size());
 
       if (dummyTrackList.size() != 0)
       {
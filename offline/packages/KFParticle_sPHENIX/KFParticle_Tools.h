@@ -73,12 +73,21 @@ class KFParticle_Tools : protected KFParticle_MVA
 
   std::vector<int> findAllGoodTracks(const std::vector<KFParticle> &daughterParticles, const std::vector<KFParticle> &primaryVertices);
 
-  std::vector<std::vector<int>> findTwoProngs(std::vector<KFParticle> daughterParticles, std::vector<int> goodTrackIndex, int nTracks);
+  /// Cache of the track-track DCA cut decisions, indexed by [first * nParticles + second], -1 if not evaluated yet
+  typedef std::vector<signed char> DCACache;
 
-  std::vector<std::vector<int>> findNProngs(std::vector<KFParticle> daughterParticles,
+  std::vector<std::vector<int>> findTwoProngs(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int nTracks, DCACache *dcaCache = nullptr);
+
+  std::vector<std::vector<int>> findNProngs(const std::vector<KFParticle> &daughterParticles,
                                             const std::vector<int> &goodTrackIndex,
                                             std::vector<std::vector<int>> goodTracksThatMeet,
-                                            int nRequiredTracks, unsigned int nProngs);
+                                            int nRequiredTracks, unsigned int nProngs, DCACache *dcaCache = nullptr);
+
+  /// Two-prong search followed by the N-prong searches up to nRequiredTracks, sharing the DCA decisions between the steps
+  std::vector<std::vector<int>> findAllProngs(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int nRequiredTracks);
+
+  /// Track-track DCA cuts. With nanPasses, pairs are only rejected if a DCA is above its cut, so NaN DCAs pass (N-prong search)
+  bool passDCACuts(const std::vector<KFParticle> &daughterParticles, int first, int second, DCACache *dcaCache, bool nanPasses = false);
 
   std::vector<std::vector<int>> appendTracksToIntermediates(KFParticle intermediateResonances[], const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int num_remaining_tracks);
 
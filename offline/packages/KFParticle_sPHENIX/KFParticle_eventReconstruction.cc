@@ -41,6 +41,7 @@
 #include <memory>   // for allocator_traits<>::value_type
 #include <string>   // for string
 #include <tuple>    // for tie, tuple
+#include <utility>  // for move
 
 #include <iostream>
 
@@ -96,11 +97,7 @@ void KFParticle_eventReconstruction::buildBasicChain(std::vector<KFParticle>& se
                                                      const std::vector<int>& goodTrackIndexBasic,
                                                      const std::vector<KFParticle>& primaryVerticesBasic, PHCompositeNode* topNode)
 {
-  std::vector<std::vector<int>> goodTracksThatMeet = findTwoProngs(daughterParticlesBasic, goodTrackIndexBasic, m_num_tracks);
-  for (int p = 3; p < m_num_tracks + 1; ++p)
-  {
-    goodTracksThatMeet = findNProngs(daughterParticlesBasic, goodTrackIndexBasic, goodTracksThatMeet, m_num_tracks, p);
-  }
+  std::vector<std::vector<int>> goodTracksThatMeet = findAllProngs(daughterParticlesBasic, goodTrackIndexBasic, m_num_tracks);
 
   getCandidateDecay(selectedMotherBasic, selectedVertexBasic, selectedDaughtersBasic, daughterParticlesBasic,
                     goodTracksThatMeet, primaryVerticesBasic, 0, m_num_tracks, false, 0, true, topNode);
@@ -128,14 +125,7 @@ void KFParticle_eventReconstruction::buildChain(std::vector<KFParticle>& selecte
   for (int i = 0; i < m_num_intermediate_states; ++i)
   {
     std::vector<KFParticle> vertices;
-    std::vector<std::vector<int>> goodTracksThatMeet = findTwoProngs(daughterParticlesAdv, goodTrackIndexAdv, m_num_tracks_from_intermediate[i]);
-    for (int p = 3; p <= m_num_tracks_from_intermediate[i]; ++p)
-    {
-      goodTracksThatMeet = findNProngs(daughterParticlesAdv,
-                                       goodTrackIndexAdv,
-                                       goodTracksThatMeet,
-                                       m_num_tracks_from_intermediate[i], p);
-    }
+    std::vector<std::vector<int>> goodTracksThatMeet = findAllProngs(daughterParticlesAdv, goodTrackIndexAdv, m_num_tracks_from_intermediate[i]);
     getCandidateDecay(potentialIntermediates[i], vertices, potentialDaughters[i], daughterParticlesAdv,
                       goodTracksThatMeet, primaryVerticesAdv, track_start, track_stop, true, i, m_constrain_int_mass, topNode);
     track_start += track_stop;
@@ -420,10 +410,6 @@ void KFParticle_eventReconstruction::getCandidateDecay(std::vector<KFParticle>&
 {
   int nTracks = n_track_stop - n_track_start;
   std::vector<std::vector<int>> uniqueCombinations = findUniqueDaughterCombinations(n_track_start, n_track_stop);
-  std::vector<KFParticle> goodCandidates, goodVertex;
-  std::vector<KFParticle> *goodDaughters = new std::vector<KFParticle>[nTracks];
-  KFParticle candidate;
-  bool isGood;
   bool fixToPV = m_constrain_to_vertex && !isIntermediate;
 
   float required_unique_vertexID = 0;
@@ -432,13 +418,33 @@ void KFParticle_eventReconstruction::getCandidateDecay(std::vector<KFParticle>&
     required_unique_vertexID += m_daughter_charge[i] * kfp_Tools_evtReco.getParticleMass(m_daughter_name[i].c_str());
   }
 
-  for (auto& i_comb : goodTracksThatMeetCand)  // Loop over all good track combinations
+  // TDatabasePDG fills its pdg code map on the first lookup by code, do this before any threads are started
+  if (!uniqueCombinations.empty())
+  {
+    kfp_Tools_evtReco.getParticleMass(uniqueCombinations[0][0]);
+  }
+
+  // The track combinations are independent. The best candidate of each combination goes into its own slot
+  // and the slots are merged in combination order, so the output does not depend on the number of threads.
+  // get_dEdx and checkTrackAndVertexMatch update the node pointers of this object, they run single threaded
+  int nCombinations = goodTracksThatMeetCand.size();
+  std::vector<KFParticle> bestMother(nCombinations);
+  std::vector<KFParticle> bestVertex(nCombinations);
+  std::vector<std::vector<KFParticle>> bestDaughters(nCombinations);
+  bool runParallel = m_num_threads > 1 && nCombinations > 1 && !m_use_PID && !m_require_track_and_vertex_match;
+
+#pragma omp parallel for schedule(dynamic) num_threads(m_num_threads) if (runParallel)
+  for (int i_comb = 0; i_comb < nCombinations; ++i_comb)  // Loop over all good track combinations
   {
-    KFParticle *daughterTracks = new KFParticle[nTracks];
+    std::vector<KFParticle> goodCandidates, goodVertex;
+    std::vector<std::vector<KFParticle>> goodDaughters(nTracks);
+    std::vector<KFParticle> daughterTracks(nTracks);
+    KFParticle candidate;
+    bool isGood;
 
     for (int i_track = 0; i_track < nTracks; ++i_track)
     {
-      daughterTracks[i_track] = daughterParticlesCand[i_comb[i_track]];
+      daughterTracks[i_track] = daughterParticlesCand[goodTracksThatMeetCand[i_comb][i_track]];
     }  // Build array of the good tracks in that combination
 
     for (auto& uniqueCombination : uniqueCombinations)  // Loop over unique track PID assignments
@@ -446,7 +452,7 @@ void KFParticle_eventReconstruction::getCandidateDecay(std::vector<KFParticle>&
       for (unsigned int i_pv = 0; i_pv < primaryVerticesCand.size(); ++i_pv)  // Loop over all PVs in the event
       {
         int* PDGIDofFirstParticleInCombination = &uniqueCombination[0];
-        std::tie(candidate, isGood) = getCombination(daughterTracks, PDGIDofFirstParticleInCombination, primaryVerticesCand[i_pv], m_constrain_to_vertex,
+        std::tie(candidate, isGood) = getCombination(daughterTracks.data(), PDGIDofFirstParticleInCombination, primaryVerticesCand[i_pv], m_constrain_to_vertex,
                                                      isIntermediate, intermediateNumber, nTracks, constrainMass, required_unique_vertexID, topNode);
         if (isIntermediate && isGood)
         {
@@ -510,29 +516,30 @@ void KFParticle_eventReconstruction::getCandidateDecay(std::vector<KFParticle>&
     {
       int bestCombinationIndex = selectBestCombination(fixToPV, isIntermediate, goodCandidates, goodVertex);
 
-      selectedMotherCand.push_back(goodCandidates[bestCombinationIndex]);
-      if (fixToPV)
-      {
-        selectedVertexCand.push_back(goodVertex[bestCombinationIndex]);
-      }
-      std::vector<KFParticle> particles;
-      particles.reserve(nTracks);
+      bestMother[i_comb] = goodCandidates[bestCombinationIndex];
+      bestVertex[i_comb] = goodVertex[bestCombinationIndex];
+      bestDaughters[i_comb].reserve(nTracks);
       for (int i = 0; i < nTracks; ++i)
       {
-        particles.push_back(goodDaughters[i][bestCombinationIndex]);
+        bestDaughters[i_comb].push_back(goodDaughters[i][bestCombinationIndex]);
       }
-      selectedDaughtersCand.push_back(particles);
+    }
+  }
 
-      goodCandidates.clear();
-      goodVertex.clear();
-      for (int j = 0; j < nTracks; ++j)
-      {
-        goodDaughters[j].clear();
-      }
+  for (int i_comb = 0; i_comb < nCombinations; ++i_comb)
+  {
+    if (bestDaughters[i_comb].empty())
+    {
+      continue;
     }
-    delete [] daughterTracks;
+
+    selectedMotherCand.push_back(bestMother[i_comb]);
+    if (fixToPV)
+    {
+      selectedVertexCand.push_back(bestVertex[i_comb]);
+    }
+    selectedDaughtersCand.push_back(std::move(bestDaughters[i_comb]));
   }
-  delete [] goodDaughters;
 }
 
 int KFParticle_eventReconstruction::selectBestCombination(bool PVconstraint, bool isAnInterMother,
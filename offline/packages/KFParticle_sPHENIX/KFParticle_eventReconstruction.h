@@ -89,6 +89,7 @@ class KFParticle_eventReconstruction : public KFParticle_Tools
   bool m_constrain_int_mass;
   bool m_use_fake_pv;
   bool m_select_by_mass_error {true};
+  int m_num_threads {1};
 
  //private:
 };
@@ -43,6 +43,7 @@
 
 #include <ffamodules/CDBInterface.h>  // for accessing the field map file from the CDB
 #include <cctype>                     // for toupper
+#include <chrono>
 #include <cmath>                      // for sqrt
 #include <cstdlib>                    // for size_t, exit
 #include <filesystem>
@@ -180,7 +181,9 @@ int KFParticle_sPHENIX::process_event(PHCompositeNode *topNode)
 
   }
   
+  const auto start = std::chrono::steady_clock::now();
   createDecay(topNode, mother, vertex_kfparticle, daughters, intermediates, nPVs);
+  m_createDecay_time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
   if (!m_has_intermediates_sPHENIX)
   {
     intermediates = daughters;
@@ -233,6 +236,11 @@ int KFParticle_sPHENIX::process_event(PHCompositeNode *topNode)
 int KFParticle_sPHENIX::End(PHCompositeNode * /*topNode*/)
 {
   std::cout << "KFParticle_sPHENIX object " << Name() << " finished. Number of candidates: " << getCandidateCounter() << std::endl;
+  if (Verbosity() >= VERBOSITY_SOME && m_createDecay_time > 0)
+  {
+    std::cout << "KFParticle_sPHENIX object " << Name() << " candidate search: " << m_createDecay_time << " ms, "
+              << getCandidateCounter() / (m_createDecay_time * 1e-3) << " candidates/s" << std::endl;
+  }
 
   if (m_save_output && getCandidateCounter() != 0)
   {
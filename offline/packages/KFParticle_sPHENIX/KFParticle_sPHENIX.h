@@ -397,6 +397,9 @@ class KFParticle_sPHENIX : public SubsysReco, public KFParticle_nTuple, public K
  
   void setPIDacceptFraction(float frac = 0.2){ m_dEdx_band_width = frac; }
 
+  /// Fit the track combinations of an event in parallel, the output does not depend on the number of threads
+  void setNumberOfThreads(int nthreads) { m_num_threads = nthreads; }
+
   /// Use alternate vertex and track fitters
   void setVertexMapNodeName(const std::string &vtx_map_node_name) { m_vtx_map_node_name = m_vtx_map_node_name_nTuple = vtx_map_node_name; }
 
@@ -418,6 +421,7 @@ class KFParticle_sPHENIX : public SubsysReco, public KFParticle_nTuple, public K
   bool m_save_dst;
   bool m_save_output;
   int candidateCounter = 0;
+  double m_createDecay_time = 0;  // ms, for the candidates/s printout
   std::string m_outfile_name;
   TFile *m_outfile;
   std::string m_decayDescriptor;
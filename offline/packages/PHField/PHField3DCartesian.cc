@@ -1,5 +1,6 @@
 #include "PHField3DCartesian.h"
 
+#include <phool/fnv1a.h>
 #include <phool/phool.h>
 
 #include <TDirectory.h>  // for TDirectory, gDirectory
@@ -15,14 +16,52 @@
 #include <boost/stacktrace.hpp>
 #pragma GCC diagnostic pop
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
-#include <iterator>
+#include <limits>
 #include <set>
+#include <sstream>
 #include <utility>
 
+namespace
+{
+  // binary grid header, followed by the key (padded to 8 bytes)
+  // and the float arrays of the grid
+  struct BinaryHeader
+  {
+    uint64_t magic;
+    uint64_t version;
+    uint64_t keysize;
+    uint64_t nx;
+    uint64_t ny;
+    uint64_t nz;
+  };
+  constexpr uint64_t binary_magic = 0x5048463344434152ULL;  // "PHF3DCAR"
+  constexpr uint64_t binary_version = 2;
+
+  size_t padded_keysize(const size_t keysize)
+  {
+    return (keysize + 7) & ~static_cast<size_t>(7);
+  }
+
+  size_t grid_floats(const size_t nx, const size_t ny, const size_t nz)
+  {
+    return nx + ny + nz + nx * ny * nz * 3;
+  }
+}  // namespace
+
 PHField3DCartesian::PHField3DCartesian(const std::string &fname, const float magfield_rescale, const float innerradius, const float outerradius, const float size_z)
   : filename(fname)
 {
@@ -46,6 +85,62 @@ PHField3DCartesian::PHField3DCartesian(const std::string &fname, const float mag
             << "\n      Magnetic field Module - Verbosity:"
             << "\n-----------------------------------------------------------";
 
+  // the binary grid name encodes the input file (name, size, modification time)
+  // and the selection, so a changed map or selection never picks up a stale grid
+  std::string binfile;
+  std::string binkey;
+  const char *mmapdir = getenv("PHFIELD_MMAP_DIR");
+  struct stat filestat;
+  if (mmapdir != nullptr && stat(filename.c_str(), &filestat) == 0)
+  {
+    std::ostringstream key;
+    key << filename << " " << filestat.st_size << " " << filestat.st_mtime << " "
+        << magfield_rescale << " " << innerradius << " " << outerradius << " " << size_z;
+    binkey = key.str();
+    std::ostringstream name;
+    name << mmapdir << "/PHField3DCartesian-" << std::hex << fnv1a::hash(binkey) << ".bin";
+    binfile = name.str();
+  }
+
+  if (!binfile.empty() && map_binary(binfile, binkey))
+  {
+    std::cout << "\n ---> "
+                 "Mapped the field grid of "
+              << filename << " from " << binfile << std::endl;
+  }
+  else
+  {
+    read_root_file(magfield_rescale, innerradius, outerradius, size_z);
+    // the first job on the node writes the grid and maps it like the others
+    // so the heap copy can go
+    if (!binfile.empty() && write_binary(binfile, binkey) && map_binary(binfile, binkey))
+    {
+      std::cout << " ---> wrote field grid to " << binfile << std::endl;
+      std::vector<float>().swap(m_Buffer);
+    }
+  }
+
+  std::cout << "\n================= End Construct Mag Field ======================\n"
+            << std::endl;
+}
+
+PHField3DCartesian::~PHField3DCartesian()
+{
+  std::cout << "PHField3DCartesian::~PHField3DCartesian" << std::endl;
+  if (Verbosity() > 0)
+  {
+    std::cout << "PHField3DCartesian: cache hits: " << cache_hits
+              << " cache misses: " << cache_misses
+              << std::endl;
+  }
+  if (m_MappedData)
+  {
+    munmap(m_MappedData, m_MappedSize);
+  }
+}
+
+void PHField3DCartesian::read_root_file(const float magfield_rescale, const float innerradius, const float outerradius, const float size_z)
+{
   // open file
   TFile *rootinput = TFile::Open(filename.c_str());
   if (!rootinput)
@@ -76,26 +171,137 @@ PHField3DCartesian::PHField3DCartesian(const std::string &fname, const float mag
   field_map->SetBranchAddress("bx", &ROOT_BX);
   field_map->SetBranchAddress("by", &ROOT_BY);
   field_map->SetBranchAddress("bz", &ROOT_BZ);
+  // the grid dimensions are only known after reading all entries,
+  // keep the selected points until then
+  std::set<float> xset;
+  std::set<float> yset;
+  std::set<float> zset;
+  std::vector<std::array<float, 6>> points;
   for (int i = 0; i < field_map->GetEntries(); i++)
   {
     field_map->GetEntry(i);
-    trio coord_key(ROOT_X * cm, ROOT_Y * cm, ROOT_Z * cm);
-    trio field_val(ROOT_BX * tesla * magfield_rescale, ROOT_BY * tesla * magfield_rescale, ROOT_BZ * tesla * magfield_rescale);
-    xvals.insert(ROOT_X * cm);
-    yvals.insert(ROOT_Y * cm);
-    zvals.insert(ROOT_Z * cm);
+    xset.insert(ROOT_X * cm);
+    yset.insert(ROOT_Y * cm);
+    zset.insert(ROOT_Z * cm);
     if ((std::sqrt(ROOT_X * cm * ROOT_X * cm + ROOT_Y * cm * ROOT_Y * cm) >= innerradius &&
          std::sqrt(ROOT_X * cm * ROOT_X * cm + ROOT_Y * cm * ROOT_Y * cm) <= outerradius) ||
         std::abs(ROOT_Z * cm) > size_z)
     {
-      fieldmap[coord_key] = field_val;
+      points.push_back({static_cast<float>(ROOT_X * cm), static_cast<float>(ROOT_Y * cm), static_cast<float>(ROOT_Z * cm),
+                        static_cast<float>(ROOT_BX * tesla * magfield_rescale),
+                        static_cast<float>(ROOT_BY * tesla * magfield_rescale),
+                        static_cast<float>(ROOT_BZ * tesla * magfield_rescale)});
     }
   }
-  xmin = *(xvals.begin());
-  xmax = *(xvals.rbegin());
+  delete field_map;
+  delete rootinput;
+
+  m_Buffer.assign(grid_floats(xset.size(), yset.size(), zset.size()), std::numeric_limits<float>::quiet_NaN());
+  float *axis = m_Buffer.data();
+  axis = std::copy(xset.begin(), xset.end(), axis);
+  axis = std::copy(yset.begin(), yset.end(), axis);
+  std::copy(zset.begin(), zset.end(), axis);
+  set_grid(m_Buffer.data(), xset.size(), yset.size(), zset.size());
+
+  float *field = m_Buffer.data() + (nxvals + nyvals + nzvals);
+  for (const auto &point : points)
+  {
+    const size_t ix = std::lower_bound(xvals, xvals + nxvals, point[0]) - xvals;
+    const size_t iy = std::lower_bound(yvals, yvals + nyvals, point[1]) - yvals;
+    const size_t iz = std::lower_bound(zvals, zvals + nzvals, point[2]) - zvals;
+    std::copy(point.begin() + 3, point.end(), field + ((ix * nyvals + iy) * nzvals + iz) * 3);
+  }
+}
+
+bool PHField3DCartesian::map_binary(const std::string &binfile, const std::string &binkey)
+{
+  int fd = open(binfile.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat binstat;
+  BinaryHeader header{};
+  bool valid = fstat(fd, &binstat) == 0 &&
+               read(fd, &header, sizeof(header)) == static_cast<ssize_t>(sizeof(header)) &&
+               header.magic == binary_magic &&
+               header.version == binary_version &&
+               header.keysize == binkey.size() &&
+               static_cast<size_t>(binstat.st_size) == sizeof(header) + padded_keysize(header.keysize) + grid_floats(header.nx, header.ny, header.nz) * sizeof(float);
+  // the file name is only a hash of the key, the full key is stored
+  // in the file so a hash collision or a stale file is never used
+  if (valid)
+  {
+    std::string key(header.keysize, '\0');
+    valid = read(fd, &key[0], key.size()) == static_cast<ssize_t>(key.size()) && key == binkey;
+  }
+  if (!valid)
+  {
+    close(fd);
+    std::cout << PHWHERE << " ignoring invalid field grid " << binfile << std::endl;
+    return false;
+  }
+  void *data = mmap(nullptr, binstat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+  {
+    std::cout << PHWHERE << " could not map " << binfile << std::endl;
+    return false;
+  }
+  if (m_MappedData)
+  {
+    munmap(m_MappedData, m_MappedSize);
+  }
+  m_MappedData = data;
+  m_MappedSize = binstat.st_size;
+  set_grid(reinterpret_cast<const float *>(static_cast<const char *>(data) + sizeof(header) + padded_keysize(header.keysize)), header.nx, header.ny, header.nz);
+  return true;
+}
+
+bool PHField3DCartesian::write_binary(const std::string &binfile, const std::string &binkey) const
+{
+  const std::string tmpfile = binfile + ".tmp" + std::to_string(getpid());
+  {
+    std::ofstream out(tmpfile, std::ios::binary);
+    BinaryHeader header{binary_magic, binary_version, binkey.size(), nxvals, nyvals, nzvals};
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    // pad the key so the float arrays stay aligned in the mapped file
+    std::string paddedkey = binkey;
+    paddedkey.resize(padded_keysize(binkey.size()), '\0');
+    out.write(paddedkey.data(), paddedkey.size());
+    out.write(reinterpret_cast<const char *>(m_Buffer.data()), m_Buffer.size() * sizeof(float));
+    if (!out)
+    {
+      std::cout << PHWHERE << " could not write " << tmpfile << std::endl;
+      std::remove(tmpfile.c_str());
+      return false;
+    }
+  }
+  // if another job was faster the rename replaces an identical grid,
+  // jobs which mapped the old file keep their pages
+  if (std::rename(tmpfile.c_str(), binfile.c_str()) != 0)
+  {
+    std::remove(tmpfile.c_str());
+    return false;
+  }
+  return true;
+}
 
-  ymin = *(yvals.begin());
-  ymax = *(yvals.rbegin());
+void PHField3DCartesian::set_grid(const float *data, const size_t nx, const size_t ny, const size_t nz)
+{
+  nxvals = nx;
+  nyvals = ny;
+  nzvals = nz;
+  xvals = data;
+  yvals = xvals + nxvals;
+  zvals = yvals + nyvals;
+  fieldvals = zvals + nzvals;
+
+  xmin = xvals[0];
+  xmax = xvals[nxvals - 1];
+
+  ymin = yvals[0];
+  ymax = yvals[nyvals - 1];
   if (ymin != xmin || ymax != xmax)
   {
     std::cout << "PHField3DCartesian: Compiler bug!!!!!!!! Do not use inlining!!!!!!" << std::endl;
@@ -103,28 +309,45 @@ PHField3DCartesian::PHField3DCartesian(const std::string &fname, const float mag
     exit(1);
   }
 
-  zmin = *(zvals.begin());
-  zmax = *(zvals.rbegin());
+  zmin = zvals[0];
+  zmax = zvals[nzvals - 1];
 
-  xstepsize = (xmax - xmin) / (xvals.size() - 1);
-  ystepsize = (ymax - ymin) / (yvals.size() - 1);
-  zstepsize = (zmax - zmin) / (zvals.size() - 1);
+  xstepsize = (xmax - xmin) / (nxvals - 1);
+  ystepsize = (ymax - ymin) / (nyvals - 1);
+  zstepsize = (zmax - zmin) / (nzvals - 1);
+}
 
-  delete field_map;
-  delete rootinput;
-  std::cout << "\n================= End Construct Mag Field ======================\n"
-            << std::endl;
+bool PHField3DCartesian::find_bracket(const float *axis, const size_t n, const double v, double key[2], size_t index[2], const char *name) const
+{
+  const float *it = std::lower_bound(axis, axis + n, v);
+  index[0] = it - axis;
+  key[0] = *it;
+  if (it == axis)
+  {
+    index[1] = index[0];
+    key[1] = *it;
+    if (v < key[0])
+    {
+      std::cout << PHWHERE << ": This should not happen! " << name << " too small - outside range: " << v / cm << std::endl;
+      return false;
+    }
+  }
+  else
+  {
+    index[1] = index[0] - 1;
+    key[1] = *(it - 1);
+  }
+  return true;
 }
 
-PHField3DCartesian::~PHField3DCartesian()
+const float *PHField3DCartesian::grid_value(const size_t ix, const size_t iy, const size_t iz) const
 {
-  std::cout << "PHField3DCartesian::~PHField3DCartesian" << std::endl;
-  if (Verbosity() > 0)
+  const float *value = fieldvals + ((ix * nyvals + iy) * nzvals + iz) * 3;
+  if (std::isnan(value[0]))
   {
-    std::cout << "PHField3DCartesian: cache hits: " << cache_hits
-              << " cache misses: " << cache_misses
-              << std::endl;
+    return nullptr;
   }
+  return value;
 }
 
 void PHField3DCartesian::GetFieldValue(const double point[4], double *Bfield) const
@@ -178,56 +401,16 @@ void PHField3DCartesian::GetFieldValue(const double point[4], double *Bfield) co
   }
 
   double xkey[2];
-  std::set<float>::const_iterator it = xvals.lower_bound(x);
-  xkey[0] = *it;
-  if (it == xvals.begin())
-  {
-    xkey[1] = *it;
-    if (x < xkey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! x too small - outside range: " << x / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    xkey[1] = *it;
-  }
-
   double ykey[2];
-  it = yvals.lower_bound(y);
-  ykey[0] = *it;
-  if (it == yvals.begin())
-  {
-    ykey[1] = *it;
-    if (y < ykey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! y too small - outside range: " << y / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    ykey[1] = *it;
-  }
   double zkey[2];
-  it = zvals.lower_bound(z);
-  zkey[0] = *it;
-  if (it == zvals.begin())
+  size_t xindex[2];
+  size_t yindex[2];
+  size_t zindex[2];
+  if (!find_bracket(xvals, nxvals, x, xkey, xindex, "x") ||
+      !find_bracket(yvals, nyvals, y, ykey, yindex, "y") ||
+      !find_bracket(zvals, nzvals, z, zkey, zindex, "z"))
   {
-    zkey[1] = *it;
-    if (z < zkey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! z too small - outside range: " << z / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    zkey[1] = *it;
+    return;
   }
 
   if (xkey_save != xkey[0] ||
@@ -239,17 +422,14 @@ void PHField3DCartesian::GetFieldValue(const double point[4], double *Bfield) co
     ykey_save = ykey[0];
     zkey_save = zkey[0];
 
-    std::map<std::tuple<float, float, float>, std::tuple<float, float, float> >::const_iterator magval;
-    trio key;
     for (int i = 0; i < 2; i++)
     {
       for (int j = 0; j < 2; j++)
       {
         for (int k = 0; k < 2; k++)
         {
-          key = std::make_tuple(xkey[i], ykey[j], zkey[k]);
-          magval = fieldmap.find(key);
-          if (magval == fieldmap.end())
+          const float *magval = grid_value(xindex[i], yindex[j], zindex[k]);
+          if (!magval)
           {
             std::cout << PHWHERE << " could not locate key in " << filename
                       << " value: x: " << xkey[i] / cm
@@ -257,18 +437,14 @@ void PHField3DCartesian::GetFieldValue(const double point[4], double *Bfield) co
                       << ", z: " << zkey[k] / cm << std::endl;
             return;
           }
-          bf[i][j][k][0] = std::get<0>(magval->second);
-          bf[i][j][k][1] = std::get<1>(magval->second);
-          bf[i][j][k][2] = std::get<2>(magval->second);
+          bf[i][j][k][0] = magval[0];
+          bf[i][j][k][1] = magval[1];
+          bf[i][j][k][2] = magval[2];
           if (Verbosity() > 0)
           {
-            const double x_loc = std::get<0>(magval->first);
-            const double y_loc = std::get<1>(magval->first);
-            const double z_loc = std::get<2>(magval->first);
-
-            std::cout << "read x/y/z: " << x_loc / cm << "/"
-              << y_loc / cm << "/"
-              << z_loc / cm << " bx/by/bz: "
+            std::cout << "read x/y/z: " << xkey[i] / cm << "/"
+              << ykey[j] / cm << "/"
+              << zkey[k] / cm << " bx/by/bz: "
               << bf[i][j][k][0] / tesla << "/"
               << bf[i][j][k][1] / tesla << "/"
               << bf[i][j][k][2] / tesla << std::endl;
@@ -344,72 +520,29 @@ void PHField3DCartesian::GetFieldValue_nocache(const double point[4], double *Bf
   { return; }
 
   double xkey[2];
-  std::set<float>::const_iterator it = xvals.lower_bound(x);
-  xkey[0] = *it;
-  if (it == xvals.begin())
-  {
-    xkey[1] = *it;
-    if (x < xkey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! x too small - outside range: " << x / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    xkey[1] = *it;
-  }
-
   double ykey[2];
-  it = yvals.lower_bound(y);
-  ykey[0] = *it;
-  if (it == yvals.begin())
-  {
-    ykey[1] = *it;
-    if (y < ykey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! y too small - outside range: " << y / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    ykey[1] = *it;
-  }
   double zkey[2];
-  it = zvals.lower_bound(z);
-  zkey[0] = *it;
-  if (it == zvals.begin())
+  size_t xindex[2];
+  size_t yindex[2];
+  size_t zindex[2];
+  if (!find_bracket(xvals, nxvals, x, xkey, xindex, "x") ||
+      !find_bracket(yvals, nyvals, y, ykey, yindex, "y") ||
+      !find_bracket(zvals, nzvals, z, zkey, zindex, "z"))
   {
-    zkey[1] = *it;
-    if (z < zkey[0])
-    {
-      std::cout << PHWHERE << ": This should not happen! z too small - outside range: " << z / cm << std::endl;
-      return;
-    }
-  }
-  else
-  {
-    --it;
-    zkey[1] = *it;
+    return;
   }
 
   // local xyz and field
   double bf_loc[2][2][2][3]{};
 
-  std::map<std::tuple<float, float, float>, std::tuple<float, float, float> >::const_iterator magval;
-  trio key;
   for (int i = 0; i < 2; i++)
   {
     for (int j = 0; j < 2; j++)
     {
       for (int k = 0; k < 2; k++)
       {
-        key = std::make_tuple(xkey[i], ykey[j], zkey[k]);
-        magval = fieldmap.find(key);
-        if (magval == fieldmap.end())
+        const float *magval = grid_value(xindex[i], yindex[j], zindex[k]);
+        if (!magval)
         {
           std::cout << PHWHERE << " could not locate key in " << filename
             << " value: x: " << xkey[i] / cm
@@ -418,19 +551,14 @@ void PHField3DCartesian::GetFieldValue_nocache(const double point[4], double *Bf
           return;
         }
 
-        bf_loc[i][j][k][0] = std::get<0>(magval->second);
-        bf_loc[i][j][k][1] = std::get<1>(magval->second);
-        bf_loc[i][j][k][2] = std::get<2>(magval->second);
+        bf_loc[i][j][k][0] = magval[0];
+        bf_loc[i][j][k][1] = magval[1];
+        bf_loc[i][j][k][2] = magval[2];
         if (Verbosity() > 0)
         {
-
-          const double x_loc = std::get<0>(magval->first);
-          const double y_loc = std::get<1>(magval->first);
-          const double z_loc = std::get<2>(magval->first);
-
-          std::cout << "read x/y/z: " << x_loc / cm << "/"
-            << y_loc / cm << "/"
-            << z_loc / cm << " bx/by/bz: "
+          std::cout << "read x/y/z: " << xkey[i] / cm << "/"
+            << ykey[j] / cm << "/"
+            << zkey[k] / cm << " bx/by/bz: "
             << bf_loc[i][j][k][0] / tesla << "/"
             << bf_loc[i][j][k][1] / tesla << "/"
             << bf_loc[i][j][k][2] / tesla << std::endl;
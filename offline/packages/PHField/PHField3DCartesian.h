@@ -4,11 +4,19 @@
 #include "PHField.h"
 
 #include <cmath>
-#include <map>
-#include <set>
+#include <cstddef>
 #include <string>
-#include <tuple>
+#include <vector>
 
+/*!
+ * 3D field map on a Cartesian grid. The grid is kept as dense float arrays
+ * (axis values and bx/by/bz per grid point, NaN for points outside the
+ * selected region).
+ * If the environment variable PHFIELD_MMAP_DIR points to a node local
+ * directory, the first job writes the built grid there in binary form and
+ * all later jobs on the node map it read only instead of reading the root
+ * file, so the pages are shared between processes.
+ */
 class PHField3DCartesian : public PHField
 {
  public:
@@ -19,6 +27,10 @@ class PHField3DCartesian : public PHField
   //! destructor
   ~PHField3DCartesian() override;
 
+  // the grid may point into a mapped file
+  PHField3DCartesian(const PHField3DCartesian &) = delete;
+  PHField3DCartesian &operator=(const PHField3DCartesian &) = delete;
+
   //! access field value
   //! Follow the convention of G4ElectroMagneticField
   //! @param[in]  Point   space time coordinate. x, y, z, t in Geant4/CLHEP units
@@ -28,6 +40,20 @@ class PHField3DCartesian : public PHField
   void GetFieldValue_nocache(const double Point[4], double *Bfield) const override;
 
   private:
+  //! read the root file into m_Buffer
+  void read_root_file(const float magfield_rescale, const float innerradius, const float outerradius, const float size_z);
+  //! map a binary grid written by write_binary, returns false if it does not exist, does not fit or was written for another key
+  bool map_binary(const std::string &binfile, const std::string &binkey);
+  //! write m_Buffer and its key as binary grid, atomic so concurrent jobs never see a partial file
+  bool write_binary(const std::string &binfile, const std::string &binkey) const;
+  //! set the axis and field pointers and the grid limits from the buffer start
+  void set_grid(const float *data, const size_t nx, const size_t ny, const size_t nz);
+
+  //! find the two grid values bracketing v, key[0] is the upper, key[1] the lower one
+  bool find_bracket(const float *axis, const size_t n, const double v, double key[2], size_t index[2], const char *name) const;
+  //! field at grid point, nullptr if the point is outside of the selected region
+  const float *grid_value(const size_t ix, const size_t iy, const size_t iz) const;
+
   std::string filename;
   double xmin = 1000000;
   double xmax = -1000000;
@@ -48,11 +74,19 @@ class PHField3DCartesian : public PHField
   mutable int cache_hits = 0;
   mutable int cache_misses = 0;
 
-  typedef std::tuple<float, float, float> trio;
-  std::map<std::tuple<float, float, float>, std::tuple<float, float, float> > fieldmap;
-  std::set<float> xvals;
-  std::set<float> yvals;
-  std::set<float> zvals;
+  // grid storage, either m_Buffer or the mapped file
+  // layout: nx, ny, nz x/y/z axis values, nx*ny*nz*3 field values (z fastest)
+  std::vector<float> m_Buffer;
+  void *m_MappedData = nullptr;
+  size_t m_MappedSize = 0;
+
+  size_t nxvals = 0;
+  size_t nyvals = 0;
+  size_t nzvals = 0;
+  const float *xvals = nullptr;
+  const float *yvals = nullptr;
+  const float *zvals = nullptr;
+  const float *fieldvals = nullptr;
 };
 
 #endif
@@ -1327,7 +1327,12 @@ std::pair<Acts::Vector3, Acts::Vector3> HelicalFitter::get_helix_tangent(const s
 
 int HelicalFitter::End(PHCompositeNode* /*unused*/)
 {
-  // closes output file in destructor
+  // flush and close output file
+  if (_mille)
+  {
+    _mille->close();
+    _mille->printSummary();
+  }
   delete _mille;
 
   if (make_ntuple)
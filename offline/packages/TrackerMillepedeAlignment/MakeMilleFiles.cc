@@ -236,6 +236,11 @@ int MakeMilleFiles::process_event(PHCompositeNode* /*topNode*/)
 
 int MakeMilleFiles::End(PHCompositeNode* /*unused*/)
 {
+  if (_mille)
+  {
+    _mille->close();
+    _mille->printSummary();
+  }
   delete _mille;
   m_constraintFile.close();
 
@@ -54,6 +54,7 @@ class MakeMilleFiles : public SubsysReco
   void set_track_map_name(const std::string& name) {m_track_map_name = name;}
   void set_state_map_name(const std::string& name) {m_state_map_name = name;}
   void set_constraintfile_name(const std::string& file) { m_constraintFileName = file; }
+  /// mille data file name. Binary output is gzip compressed if name ends with .gz
   void set_datafile_name(const std::string& file) { data_outfilename = file; }
   void set_steeringfile_name(const std::string& file) { steering_outfilename = file; }
   void set_tfile_name(const std::string& file) { m_tfile_name = file; }
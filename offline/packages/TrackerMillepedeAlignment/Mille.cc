@@ -31,6 +31,9 @@
 
 #include "Mille.h"
 
+#include <zlib.h>
+
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 
@@ -38,34 +41,114 @@
 
 /// Opens outFileName (by default as binary file).
 /**
+ * Binary output is gzip compressed if outFileName ends with ".gz".
+ *
  * \param[in] outFileName  file name
  * \param[in] asBinary     flag for binary
  * \param[in] writeZero    flag for keeping of zeros
  */
 Mille::Mille(const char *outFileName, bool asBinary, bool writeZero)
-  : myOutFile(outFileName, (asBinary ? (std::ios::binary | std::ios::out) : std::ios::out))
+  : myFileName(outFileName)
   , myAsBinary(asBinary)
   , myWriteZero(writeZero)
   , myBufferPos(-1)
   , myHasSpecial(false)
+  , myCompress(asBinary && myFileName.size() > 3 && myFileName.compare(myFileName.size() - 3, 3, ".gz") == 0)
 {
   // Instead myBufferPos(-1), myHasSpecial(false) and the following two lines
   // we could call newSet() and kill()...
   myBufferInt[0] = 0;
   myBufferFloat[0] = 0.;
 
-  if (!myOutFile.is_open())
+  bool isOpen = false;
+  if (myCompress)
+  {
+    myGzFile = gzopen(outFileName, "wb");
+    isOpen = (myGzFile != nullptr);
+  }
+  else
+  {
+    myOutFile.open(outFileName, (asBinary ? (std::ios::binary | std::ios::out) : std::ios::out));
+    isOpen = myOutFile.is_open();
+  }
+
+  if (!isOpen)
   {
     std::cerr << "Mille::Mille: Could not open " << outFileName
               << " as output file." << std::endl;
   }
+  else if (myAsBinary)
+  {
+    // binary records are written (and compressed) by a separate thread
+    myBlock.reserve(myBlockSize);
+    myWriterThread = std::thread(&Mille::writerLoop, this);
+  }
 }
 
 //___________________________________________________________________________
 /// Closes file.
 Mille::~Mille()
 {
+  close();
+}
+
+//___________________________________________________________________________
+/// Write pending records, stop writer thread and close file.
+void Mille::close()
+{
+  if (myClosed)
+  {
+    return;
+  }
+  myClosed = true;
+
+  // hand last block to writer thread, and wait for all blocks to be written
+  writeBlock();
+  if (myWriterThread.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(myMutex);
+      myWriterDone = true;
+    }
+    myCondition.notify_all();
+    myWriterThread.join();
+  }
+
+  if (myGzFile)
+  {
+    gzclose(myGzFile);
+    myGzFile = nullptr;
+  }
   myOutFile.close();
+
+  // file size
+  std::error_code error;
+  const auto size = std::filesystem::file_size(myFileName, error);
+  if (!error)
+  {
+    myNBytesOnDisk = size;
+  }
+  if (!myAsBinary)
+  {
+    myNBytes = myNBytesOnDisk;
+  }
+}
+
+//___________________________________________________________________________
+/// Print number of records and bytes written.
+void Mille::printSummary(std::ostream &out) const
+{
+  out << "Mille::printSummary: " << myFileName << " - "
+      << myNRecords << " records, " << myNBytes << " bytes";
+  if (myCompress)
+  {
+    out << ", " << myNBytesOnDisk << " bytes compressed";
+    if (myNBytesOnDisk > 0)
+    {
+      out << " (ratio " << double(myNBytes) / myNBytesOnDisk << ")";
+    }
+  }
+  out << std::endl;
 }
 
 //___________________________________________________________________________
@@ -207,12 +290,19 @@ void Mille::end()
 
     if (myAsBinary)
     {
-      myOutFile.write(reinterpret_cast<const char *>(&numWordsToWrite),
-                      sizeof(numWordsToWrite));
-      myOutFile.write(reinterpret_cast<char *>(myBufferFloat),
-                      (myBufferPos + 1) * sizeof(myBufferFloat[0]));
-      myOutFile.write(reinterpret_cast<char *>(myBufferInt),
-                      (myBufferPos + 1) * sizeof(myBufferInt[0]));
+      // append record to current block, same layout as written directly to file
+      const char *words = reinterpret_cast<const char *>(&numWordsToWrite);
+      const char *floats = reinterpret_cast<const char *>(myBufferFloat);
+      const char *ints = reinterpret_cast<const char *>(myBufferInt);
+      myBlock.insert(myBlock.end(), words, words + sizeof(numWordsToWrite));
+      myBlock.insert(myBlock.end(), floats, floats + (myBufferPos + 1) * sizeof(myBufferFloat[0]));
+      myBlock.insert(myBlock.end(), ints, ints + (myBufferPos + 1) * sizeof(myBufferInt[0]));
+      myNBytes += sizeof(numWordsToWrite) + (myBufferPos + 1) * (sizeof(myBufferFloat[0]) + sizeof(myBufferInt[0]));
+
+      if (myBlock.size() >= static_cast<size_t>(myBlockSize))
+      {
+        writeBlock();
+      }
     }
     else
     {
@@ -229,12 +319,79 @@ void Mille::end()
       }
       myOutFile << "\n";
     }
+    ++myNRecords;
   }
   myBufferPos = -1;  // reset buffer for next set of derivatives
 
   //  std:: cout << " Mille::end() finished with myBufferPos " << myBufferPos << std::endl;
 }
 
+//___________________________________________________________________________
+/// Hand current block of records to writer thread.
+/**
+ * Blocks if too many blocks are already waiting to be written,
+ * to keep memory usage bounded.
+ */
+void Mille::writeBlock()
+{
+  if (myBlock.empty())
+  {
+    return;
+  }
+
+  // no writer, because output file could not be opened
+  if (!myWriterThread.joinable())
+  {
+    myBlock.clear();
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(myMutex);
+    myCondition.wait(lock, [this]
+                     { return myPending.size() < static_cast<size_t>(myMaxPendingBlocks); });
+    myPending.push_back(std::move(myBlock));
+  }
+  myCondition.notify_all();
+
+  myBlock = std::vector<char>();
+  myBlock.reserve(myBlockSize);
+}
+
+//___________________________________________________________________________
+/// Write (and compress) blocks, until close() is called.
+void Mille::writerLoop()
+{
+  while (true)
+  {
+    std::vector<char> block;
+    {
+      std::unique_lock<std::mutex> lock(myMutex);
+      myCondition.wait(lock, [this]
+                       { return !myPending.empty() || myWriterDone; });
+      if (myPending.empty())
+      {
+        return;
+      }
+      block = std::move(myPending.front());
+      myPending.pop_front();
+    }
+    myCondition.notify_all();
+
+    if (myCompress)
+    {
+      if (gzwrite(myGzFile, block.data(), block.size()) != static_cast<int>(block.size()))
+      {
+        std::cerr << "Mille::writerLoop: Error writing to " << myFileName << std::endl;
+      }
+    }
+    else
+    {
+      myOutFile.write(block.data(), block.size());
+    }
+  }
+}
+
 //___________________________________________________________________________
 /// Initialize for new set of locals, e.g. new track.
 void Mille::newSet()
@@ -24,8 +24,18 @@
  */
 
 #include <climits>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <iostream>
 #include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct gzFile_s;
+
 /**
  * \class Mille
  *
@@ -40,6 +50,11 @@
  *  But note that **pede** will not be able to read text output and has not been tested with
  *  derivatives/labels ==0.
  *
+ *  Binary records are collected in memory blocks, which are written to disk by a
+ *  background thread. If the output file name ends with ".gz", blocks are gzip compressed
+ *  by the same thread. **pede** reads such files directly when built with zlib,
+ *  otherwise they can be uncompressed with gunzip beforehand.
+ *
  *  author    : Gero Flucke
  *  date      : October 2006
  *  $Revision: 1.3 $
@@ -60,9 +75,20 @@ class Mille
   void kill();
   void end();
 
+  void close();
+  void printSummary(std::ostream &out = std::cout) const;
+
+  long getNumberOfRecords() const { return myNRecords; }  ///< records written so far
+  long getBytes() const { return myNBytes; }              ///< uncompressed bytes written so far
+  long getBytesOnDisk() const { return myNBytesOnDisk; }  ///< file size, available after close()
+
  private:
   void newSet();
   bool checkBufferSize(int nLocal, int nGlobal);
+  void writeBlock();
+  void writerLoop();
+
+  std::string myFileName;  ///< output file name
 
   std::ofstream myOutFile;  ///< C-binary for output
   bool myAsBinary;          ///< if false output as text
@@ -76,6 +102,25 @@ class Mille
   float myBufferFloat[myBufferSize]{};  ///< to collect derivatives etc.
   int myBufferPos;                      ///< position in buffer
   bool myHasSpecial;                    ///< if true, special(..) already called for this record
+
+  /// size above which a block of records is handed to the writer thread, and max number of pending blocks
+  enum
+  {
+    myBlockSize = 1 << 22,
+    myMaxPendingBlocks = 4
+  };
+  bool myCompress;                          ///< if true, gzip output
+  gzFile_s *myGzFile = nullptr;             ///< gzip output, if compressed
+  std::vector<char> myBlock;                ///< records not yet handed to the writer thread
+  std::deque<std::vector<char>> myPending;  ///< blocks waiting to be written
+  std::mutex myMutex;                       ///< protects myPending and myWriterDone
+  std::condition_variable myCondition;      ///< signals changes to myPending
+  std::thread myWriterThread;               ///< background writer
+  bool myWriterDone = false;                ///< if true, writer thread exits once myPending is empty
+  bool myClosed = false;                    ///< if true, close() already called
+  long myNRecords = 0;                      ///< number of records written
+  long myNBytes = 0;                        ///< number of uncompressed bytes written
+  long myNBytesOnDisk = 0;                  ///< output file size
   /// largest label allowed
   enum
   {
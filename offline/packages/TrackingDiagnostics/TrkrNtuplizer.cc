@@ -62,6 +62,8 @@
 #include <TNtuple.h>
 #include <TVector3.h>
 
+#include <omp.h>
+
 #include <cmath>
 #include <iomanip>
 #include <iostream>
@@ -301,6 +303,39 @@ enum n_cluster  // NOLINT(readability-enum-initial-value, performance-enum-size)
   clusize = ncluniter + 1
 };
 
+namespace
+{
+  //! compute ntuple rows for each chunk in parallel, then fill them in chunk order
+  /**
+   * compute_chunk(ichunk, buffer) appends the rows of chunk ichunk to buffer,
+   * rowsize floats per row. The output is identical to the serial loop.
+   * nthreads only applies to this loop, 0 uses the OpenMP default.
+   */
+  template <class F>
+  void fill_rows_parallel(TNtuple* ntuple, size_t nchunks, size_t rowsize, int nthreads, F&& compute_chunk)
+  {
+    std::vector<std::vector<float>> buffers(nchunks);
+    if (nthreads <= 0)
+    {
+      nthreads = omp_get_max_threads();
+    }
+
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+    for (size_t ichunk = 0; ichunk < nchunks; ++ichunk)
+    {
+      compute_chunk(ichunk, buffers[ichunk]);
+    }
+
+    for (const auto& buffer : buffers)
+    {
+      for (size_t offset = 0; offset + rowsize <= buffer.size(); offset += rowsize)
+      {
+        ntuple->Fill(&buffer[offset]);
+      }
+    }
+  }
+}  // namespace
+
 TrkrNtuplizer::TrkrNtuplizer(const std::string& /*name*/, const std::string& filename, const std::string& trackmapname,
                              unsigned int nlayers_maps,
                              unsigned int nlayers_intt,
@@ -1442,7 +1477,37 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
     // need things off of the DST...
     TrkrHitSetContainer* hitmap = findNode::getClass<TrkrHitSetContainer>(topNode, "TRKR_HITSET");
 
-    if (hitmap)
+    if (hitmap && m_num_threads != 1)
+    {
+      std::vector<std::pair<TrkrDefs::hitsetkey, TrkrHitSet*>> hitsets;
+      TrkrHitSetContainer::ConstRange all_hitsets = hitmap->getHitSets();
+      for (TrkrHitSetContainer::ConstIterator iter = all_hitsets.first;
+           iter != all_hitsets.second;
+           ++iter)
+      {
+        hitsets.emplace_back(iter->first, iter->second);
+      }
+
+      const size_t rowsize = ((int) (n_info::infosize)) + n_event::evsize + n_hit::hitsize;
+      fill_rows_parallel(_ntp_hit, hitsets.size(), rowsize, m_num_threads,
+                         [&](size_t ihitset, std::vector<float>& buffer)
+                         {
+                           const auto& [hitset_key, hitset] = hitsets[ihitset];
+                           TrkrHitSet::ConstRange hitrangei = hitset->getHits();
+                           buffer.reserve(hitset->size() * rowsize);
+                           for (TrkrHitSet::ConstIterator hitr = hitrangei.first;
+                                hitr != hitrangei.second;
+                                ++hitr)
+                           {
+                             float fx_hit_local[((int) (n_hit::hitsize))] = {0};
+                             FillHit(&fx_hit_local[0], hitset_key, hitr->first, hitr->second, m_tGeometry);
+                             buffer.insert(buffer.end(), fx_event, fx_event + n_event::evsize);
+                             buffer.insert(buffer.end(), fx_hit_local, fx_hit_local + n_hit::hitsize);
+                             buffer.insert(buffer.end(), fx_info, fx_info + ((int) (n_info::infosize)));
+                           }
+                         });
+    }
+    else if (hitmap)
     {
       TrkrHitSetContainer::ConstRange all_hitsets = hitmap->getHitSets();
       for (TrkrHitSetContainer::ConstIterator iter = all_hitsets.first;
@@ -1458,66 +1523,7 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
              hitr != hitrangei.second;
              ++hitr)
         {
-          TrkrDefs::hitkey hit_key = hitr->first;
-          TrkrHit* hit = hitr->second;
-
-          fx_hit[n_hit::nhitID] = hit_key;
-          fx_hit[n_hit::nhite] = hit->getEnergy();
-          fx_hit[n_hit::nhitadc] = hit->getAdc();
-          unsigned int layer_local = TrkrDefs::getLayer(hitset_key);
-          fx_hit[n_hit::nhitlayer] = (float) layer_local;
-          fx_hit[n_hit::nhitphielem] = -666;
-          fx_hit[n_hit::nhitzelem] = -666;
-
-          if (layer_local >= 3 && layer_local < 7)
-          {
-            fx_hit[n_hit::nhitphielem] = InttDefs::getLadderPhiId(hitset_key);
-            fx_hit[n_hit::nhitzelem] = InttDefs::getLadderZId(hitset_key);
-          }
-          if (layer_local >= 7 && layer_local < 55)
-          {
-            fx_hit[n_hit::nhitphielem] = TpcDefs::getSectorId(hitset_key);
-            fx_hit[n_hit::nhitzelem] = TpcDefs::getSide(hitset_key);
-          }
-          /*
-          if(layer_local>=55){
-            if(MicromegasDefs::getSegmentationType(hitset_key)==MicromegasDefs::SEGMENTATION_Z){
-              sector = 1;
-              side = MicromegasDefs::getStrip(hit_key);
-            }else{
-              sector =MicromegasDefs::getStrip(hit_key);
-              side =  1;
-            }
-          }
-          */
-          fx_hit[n_hit::nhitphielem] = TpcDefs::getSectorId(hitset_key);
-          fx_hit[n_hit::nhitzelem] = TpcDefs::getSide(hitset_key);
-          fx_hit[n_hit::nhitcellID] = 0;
-          fx_hit[n_hit::nhitecell] = hit->getAdc();
-          fx_hit[n_hit::nhitphibin] = std::numeric_limits<float>::quiet_NaN();
-          fx_hit[n_hit::nhittbin] = std::numeric_limits<float>::quiet_NaN();
-          fx_hit[n_hit::nhitphi] = std::numeric_limits<float>::quiet_NaN();
-          fx_hit[n_hit::nhitr] = std::numeric_limits<float>::quiet_NaN();
-          fx_hit[n_hit::nhitx] = std::numeric_limits<float>::quiet_NaN();
-          fx_hit[n_hit::nhity] = std::numeric_limits<float>::quiet_NaN();
-          fx_hit[n_hit::nhitz] = std::numeric_limits<float>::quiet_NaN();
-
-          if (layer_local >= _nlayers_maps + _nlayers_intt && layer_local < _nlayers_maps + _nlayers_intt + _nlayers_tpc)
-          {
-            PHG4TpcCylinderGeom* GeoLayer_local = _geom_container->GetLayerCellGeom(layer_local);
-            double radius = GeoLayer_local->get_radius();
-            fx_hit[n_hit::nhitphibin] = (float) TpcDefs::getPad(hit_key);
-            fx_hit[n_hit::nhittbin] = (float) TpcDefs::getTBin(hit_key);
-            fx_hit[n_hit::nhitphi] = GeoLayer_local->get_phicenter(fx_hit[n_hit::nhitphibin]);
-            float phi = GeoLayer_local->get_phicenter(TpcDefs::getPad(hit_key));
-            float clockperiod = GeoLayer_local->get_zstep();
-            auto glob = m_tGeometry->getGlobalPositionTpc(hitset_key, hit_key, phi, radius, clockperiod);
-
-            fx_hit[n_hit::nhitz] = glob.z();
-            fx_hit[n_hit::nhitr] = radius;
-            fx_hit[n_hit::nhitx] = glob.x();
-            fx_hit[n_hit::nhity] = glob.y();
-          }
+          FillHit(&fx_hit[0], hitset_key, hitr->first, hitr->second, m_tGeometry);
 
           std::copy(fx_event, fx_event + n_event::evsize, hit_data);
           std::copy(fx_hit, fx_hit + n_hit::hitsize, hit_data + n_event::evsize);
@@ -1527,8 +1533,8 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
           std::copy(fx_hit_0, fx_hit_0 + ((int) (n_info::infosize)) + n_event::evsize + n_hit::hitsize, hit_data);
         }
       }
-      delete[] hit_data;
     }
+    delete[] hit_data;
     if (Verbosity() >= 1)
     {
       _timer->stop();
@@ -1578,7 +1584,37 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
       }
     }
 
-    if (_cluster_map && hitsets)
+    if (_cluster_map && hitsets && m_num_threads != 1)
+    {
+      // getClusters uses a temporary map internally, so the keys are collected serially
+      std::vector<std::vector<TrkrDefs::cluskey>> cluskeys_per_hitset;
+      for (const auto& hitsetkey : _cluster_map->getHitSetKeys())
+      {
+        auto range = _cluster_map->getClusters(hitsetkey);
+        auto& cluskeys = cluskeys_per_hitset.emplace_back();
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+          cluskeys.push_back(iter->first);
+        }
+      }
+
+      const size_t rowsize = ((int) (n_info::infosize)) + n_event::evsize + n_cluster::clusize;
+      fill_rows_parallel(_ntp_cluster, cluskeys_per_hitset.size(), rowsize, m_num_threads,
+                         [&](size_t ihitset, std::vector<float>& buffer)
+                         {
+                           const auto& cluskeys = cluskeys_per_hitset[ihitset];
+                           buffer.reserve(cluskeys.size() * rowsize);
+                           for (const auto& cluster_key : cluskeys)
+                           {
+                             Float_t fx_cluster[n_cluster::clusize] = {0};
+                             FillCluster(&fx_cluster[0], cluster_key);
+                             buffer.insert(buffer.end(), fx_event, fx_event + n_event::evsize);
+                             buffer.insert(buffer.end(), fx_cluster, fx_cluster + n_cluster::clusize);
+                             buffer.insert(buffer.end(), fx_info, fx_info + ((int) (n_info::infosize)));
+                           }
+                         });
+    }
+    else if (_cluster_map && hitsets)
     {
       float* cluster_data = new float[((int) (n_info::infosize)) + n_event::evsize + n_cluster::clusize];
       Float_t fx_cluster_0[((int) (n_info::infosize)) + n_event::evsize + n_cluster::clusize] = {0};
@@ -1588,7 +1624,7 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
         for (auto iter = range.first; iter != range.second; ++iter)
         {
           TrkrDefs::cluskey cluster_key = iter->first;
-          Float_t fx_cluster[n_cluster::clusize];
+          Float_t fx_cluster[n_cluster::clusize] = {0};
           FillCluster(&fx_cluster[0], cluster_key);
 
           std::copy(fx_event, fx_event + n_event::evsize, cluster_data);
@@ -1782,7 +1818,7 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
           float seedR = std::abs(1.0 / tpcseed->get_qOverR());
           float alpha = (resr * resr) / (2 * resr * seedR);
           float beta = std::abs(std::atan(tpcseed->get_slope()));
-          float fx_cluster[n_cluster::clusize];
+          float fx_cluster[n_cluster::clusize] = {0};
           if (layer_local >= 7 && layer_local < 55)
           {
             PHG4TpcCylinderGeom* GeoLayer_local = _geom_container->GetLayerCellGeom(layer_local);
@@ -2114,6 +2150,67 @@ float TrkrNtuplizer::get_n1pix(TrackSeed* tpcseed)
   return n1pix;
 }
 
+void TrkrNtuplizer::FillHit(float fXhit[n_hit::hitsize], TrkrDefs::hitsetkey hitset_key, TrkrDefs::hitkey hit_key, TrkrHit* hit, ActsGeometry* geometry)
+{
+  fXhit[n_hit::nhitID] = hit_key;
+  fXhit[n_hit::nhite] = hit->getEnergy();
+  fXhit[n_hit::nhitadc] = hit->getAdc();
+  unsigned int layer_local = TrkrDefs::getLayer(hitset_key);
+  fXhit[n_hit::nhitlayer] = (float) layer_local;
+  fXhit[n_hit::nhitphielem] = -666;
+  fXhit[n_hit::nhitzelem] = -666;
+
+  if (layer_local >= 3 && layer_local < 7)
+  {
+    fXhit[n_hit::nhitphielem] = InttDefs::getLadderPhiId(hitset_key);
+    fXhit[n_hit::nhitzelem] = InttDefs::getLadderZId(hitset_key);
+  }
+  if (layer_local >= 7 && layer_local < 55)
+  {
+    fXhit[n_hit::nhitphielem] = TpcDefs::getSectorId(hitset_key);
+    fXhit[n_hit::nhitzelem] = TpcDefs::getSide(hitset_key);
+  }
+  /*
+  if(layer_local>=55){
+    if(MicromegasDefs::getSegmentationType(hitset_key)==MicromegasDefs::SEGMENTATION_Z){
+      sector = 1;
+      side = MicromegasDefs::getStrip(hit_key);
+    }else{
+      sector =MicromegasDefs::getStrip(hit_key);
+      side =  1;
+    }
+  }
+  */
+  fXhit[n_hit::nhitphielem] = TpcDefs::getSectorId(hitset_key);
+  fXhit[n_hit::nhitzelem] = TpcDefs::getSide(hitset_key);
+  fXhit[n_hit::nhitcellID] = 0;
+  fXhit[n_hit::nhitecell] = hit->getAdc();
+  fXhit[n_hit::nhitphibin] = std::numeric_limits<float>::quiet_NaN();
+  fXhit[n_hit::nhittbin] = std::numeric_limits<float>::quiet_NaN();
+  fXhit[n_hit::nhitphi] = std::numeric_limits<float>::quiet_NaN();
+  fXhit[n_hit::nhitr] = std::numeric_limits<float>::quiet_NaN();
+  fXhit[n_hit::nhitx] = std::numeric_limits<float>::quiet_NaN();
+  fXhit[n_hit::nhity] = std::numeric_limits<float>::quiet_NaN();
+  fXhit[n_hit::nhitz] = std::numeric_limits<float>::quiet_NaN();
+
+  if (layer_local >= _nlayers_maps + _nlayers_intt && layer_local < _nlayers_maps + _nlayers_intt + _nlayers_tpc)
+  {
+    PHG4TpcCylinderGeom* GeoLayer_local = _geom_container->GetLayerCellGeom(layer_local);
+    double radius = GeoLayer_local->get_radius();
+    fXhit[n_hit::nhitphibin] = (float) TpcDefs::getPad(hit_key);
+    fXhit[n_hit::nhittbin] = (float) TpcDefs::getTBin(hit_key);
+    fXhit[n_hit::nhitphi] = GeoLayer_local->get_phicenter(fXhit[n_hit::nhitphibin]);
+    float phi = GeoLayer_local->get_phicenter(TpcDefs::getPad(hit_key));
+    float clockperiod = GeoLayer_local->get_zstep();
+    auto glob = geometry->getGlobalPositionTpc(hitset_key, hit_key, phi, radius, clockperiod);
+
+    fXhit[n_hit::nhitz] = glob.z();
+    fXhit[n_hit::nhitr] = radius;
+    fXhit[n_hit::nhitx] = glob.x();
+    fXhit[n_hit::nhity] = glob.y();
+  }
+}
+
 void TrkrNtuplizer::FillCluster(float fXcluster[n_cluster::clusize], TrkrDefs::cluskey cluster_key)
 {
   unsigned int layer_local = TrkrDefs::getLayer(cluster_key);
@@ -26,6 +26,7 @@ class CDBTTree;
 class PHCompositeNode;
 class PHTimer;
 class TrkrCluster;
+class TrkrHit;
 class TFile;
 class TNtuple;
 class SvtxTrack;
@@ -88,6 +89,15 @@ class TrkrNtuplizer : public SubsysReco
   void runnumber(const int run) { m_runnumber = run; }
   void job(const int job) { m_job = job; }
 
+  //! number of threads used to compute hit and cluster ntuple rows
+  /**
+   * default is 1, rows are computed and filled serially.
+   * For values other than 1, rows are computed in parallel per hitset into
+   * contiguous buffers and filled afterwards in the serial order.
+   * 0 corresponds to as many threads as available on the host.
+   */
+  void set_num_threads(int value) { m_num_threads = value; }
+
  private:
   struct fee_info
   {
@@ -119,6 +129,7 @@ class TrkrNtuplizer : public SubsysReco
                float &dca3dxysigma, float &dca3dzsigma);
   // TrkrClusterContainer *cluster_map{nullptr};
 
+  void FillHit(Float_t fXhit[15], TrkrDefs::hitsetkey hitset_key, TrkrDefs::hitkey hit_key, TrkrHit *hit, ActsGeometry *geometry);
   void FillCluster(Float_t fXcluster[30], TrkrDefs::cluskey cluster_key);
   void FillTrack(Float_t fXcluster[30], SvtxTrack *track, GlobalVertexMap *vertexmap);
   //----------------------------------
@@ -201,6 +212,9 @@ class TrkrNtuplizer : public SubsysReco
   TFile *_tfile{nullptr};
   PHTimer *_timer{nullptr};
 
+  //! number of threads for row computation, see set_num_threads
+  int m_num_threads{1};
+
   // output subroutines
   void fillOutputNtuples(PHCompositeNode *topNode);  ///< dump the evaluator information into ntuple for external analysis
   void printInputInfo(PHCompositeNode *topNode);     ///< print out the input object information (debugging upstream components)
@@ -231,13 +231,13 @@ void INTTZvtx::Init()
 void INTTZvtx::InitHist()
 {
   // histos for z-vertex calculation
-  evt_possible_z = new TH1F("evt_possible_z", "evt_possible_z", 50, evt_possible_z_range.first, evt_possible_z_range.second);
+  evt_possible_z = new TH1F("evt_possible_z", "evt_possible_z", evt_possible_z_Nbin, evt_possible_z_range.first, evt_possible_z_range.second);
   evt_possible_z->SetLineWidth(1);
   evt_possible_z->GetXaxis()->SetTitle("Z [mm]");
   evt_possible_z->GetYaxis()->SetTitle("Entry");
 
-  int N = 1200;        // note : N bins for each side, regardless the bin at zero
-  double width = 0.5;  // note : bin width with the unit [mm]
+  int N = line_breakdown_Nbin_side;         // note : N bins for each side, regardless the bin at zero
+  double width = line_breakdown_bin_width;  // note : bin width with the unit [mm]
   line_breakdown_hist = new TH1F("line_breakdown_hist", "line_breakdown_hist", 2 * N + 1, -1 * (width * N + width / 2.), width * N + width / 2.);
   line_breakdown_hist->SetLineWidth(1);
   line_breakdown_hist->GetXaxis()->SetTitle("Z [mm]");
@@ -1304,6 +1304,251 @@ bool INTTZvtx::ProcessEvt(
   return true;
 }
 
+bool INTTZvtx::ProcessEvtFast(
+    int event_i,
+    const std::vector<clu_info>& temp_sPH_inner_nocolumn_vec,
+    const std::vector<clu_info>& temp_sPH_outer_nocolumn_vec)
+{
+  if (!m_initialized)
+  {
+    std::cout << "INTTZvtx is not initialized" << std::endl;
+    exit(1);
+  }
+
+  m_zvtxinfo.clear();
+
+  good_zvtx_tag = false;
+  good_zvtx_tag_int = 0;
+
+  loose_offset_peak = -9999;   // note : unit [mm]
+  loose_offset_peakE = -9999;  // note : unit [mm]
+
+  if (event_i % 1000 == 0 && print_message_opt == true)
+  {
+    std::cout << "In INTTZvtx class, running event (fast) : " << event_i << std::endl;
+  }
+
+  long total_NClus = temp_sPH_inner_nocolumn_vec.size() + temp_sPH_outer_nocolumn_vec.size();
+  m_zvtxinfo.nclus = total_NClus;
+
+  if (total_NClus < long(zvtx_cal_require) ||
+      temp_sPH_inner_nocolumn_vec.size() < 2 ||
+      temp_sPH_outer_nocolumn_vec.size() < 2 ||
+      total_NClus > N_clu_cut || total_NClus < N_clu_cutl)
+  {
+    if (print_message_opt == true)
+    {
+      std::cout << (boost::format("In INTTZvtx class, event : %i, return low clu continue, NClus : %ld %lu %lu\n") % event_i % total_NClus % temp_sPH_inner_nocolumn_vec.size() % temp_sPH_outer_nocolumn_vec.size()).str();
+    }
+    return false;
+  }
+
+  //-----------------
+  // note : clusters in phi w.r.t. the beam origin, sorted, so that the outer candidates of each inner cluster are a contiguous window
+  auto to_fast_clu = [this](const clu_info& clu) -> fast_clu
+  {
+    double phi = atan2(clu.y - beam_origin.second, clu.x - beam_origin.first) * (180. / TMath::Pi());
+    if (clu.y - beam_origin.second < 0)
+    {
+      phi += 360;
+    }
+    return {phi, get_radius(clu.x - beam_origin.first, clu.y - beam_origin.second), clu.x, clu.y, clu.z};
+  };
+  auto phi_less = [](const fast_clu& a, const fast_clu& b)
+  { return a.phi < b.phi; };
+
+  fast_inner_vec.clear();
+  for (const auto& inner_i : temp_sPH_inner_nocolumn_vec)
+  {
+    fast_inner_vec.push_back(to_fast_clu(inner_i));
+  }
+  std::sort(fast_inner_vec.begin(), fast_inner_vec.end(), phi_less);
+
+  fast_outer_vec.clear();
+  for (const auto& outer_i : temp_sPH_outer_nocolumn_vec)
+  {
+    fast_outer_vec.push_back(to_fast_clu(outer_i));
+  }
+  std::sort(fast_outer_vec.begin(), fast_outer_vec.end(), phi_less);
+
+  // note : the window can cross 0/360, so the outer clusters close to the boundary are copied to the other end with phi -+ 360
+  // note : a window of 180 degree or wider would see a cluster and its copy, so it is capped
+  double phi_window = std::min(phi_diff_cut, 180.);
+  std::size_t n_outer = fast_outer_vec.size();
+  std::size_t n_head = std::distance(fast_outer_vec.begin(),
+                                     std::lower_bound(fast_outer_vec.begin(), fast_outer_vec.end(), fast_clu{phi_window, 0, 0, 0, 0}, phi_less));
+  std::size_t n_tail = std::distance(std::upper_bound(fast_outer_vec.begin(), fast_outer_vec.end(), fast_clu{360. - phi_window, 0, 0, 0, 0}, phi_less),
+                                     fast_outer_vec.end());
+  fast_outer_vec.resize(n_tail + n_outer + n_head);
+  std::copy_backward(fast_outer_vec.begin(), fast_outer_vec.begin() + n_outer, fast_outer_vec.begin() + n_tail + n_outer);
+  for (std::size_t i = 0; i < n_tail; i++)
+  {
+    fast_outer_vec[i] = fast_outer_vec[n_outer + i];
+    fast_outer_vec[i].phi -= 360;
+  }
+  for (std::size_t i = 0; i < n_head; i++)
+  {
+    fast_outer_vec[n_tail + n_outer + i] = fast_outer_vec[n_tail + i];
+    fast_outer_vec[n_tail + n_outer + i].phi += 360;
+  }
+
+  //-----------------
+  // note : the line breakdown is accumulated as a difference array, +1 at the first bin and -1 after the last bin of each tracklet
+  int LB_Nbin = 2 * line_breakdown_Nbin_side + 1;
+  double LB_xmin = -1 * (line_breakdown_bin_width * line_breakdown_Nbin_side + line_breakdown_bin_width / 2.);
+  double possible_z_bin_width = (evt_possible_z_range.second - evt_possible_z_range.first) / evt_possible_z_Nbin;
+
+  fast_line_breakdown_hist.assign(LB_Nbin + 3, 0);
+  fast_possible_z_hist.assign(evt_possible_z_Nbin, 0);
+
+  // note : same bin convention as line_breakdown(), 0 : underflow, LB_Nbin + 1 : overflow
+  auto LB_bin = [&](double z)
+  {
+    int bin = int((z - LB_xmin) / line_breakdown_bin_width) + 1;
+    return (bin < 1) ? 0 : (bin > LB_Nbin) ? LB_Nbin + 1 : bin;
+  };
+
+  unsigned int good_pair_count = 0;
+  std::size_t window_L = 0;
+  std::size_t window_R = 0;
+  for (const auto& inner : fast_inner_vec)
+  {
+    // note : two pointers, both only move forward since the inner clusters are sorted as well
+    while (window_L < fast_outer_vec.size() && fast_outer_vec[window_L].phi <= inner.phi - phi_window)
+    {
+      window_L++;
+    }
+    window_R = std::max(window_R, window_L);
+    while (window_R < fast_outer_vec.size() && fast_outer_vec[window_R].phi < inner.phi + phi_window)
+    {
+      window_R++;
+    }
+
+    for (std::size_t outer_i = window_L; outer_i < window_R; outer_i++)
+    {
+      const fast_clu& outer = fast_outer_vec[outer_i];
+
+      double DCA_sign = calculateAngleBetweenVectors(outer.x, outer.y, inner.x, inner.y, beam_origin.first, beam_origin.second);
+      if (!(DCA_cut.first < DCA_sign && DCA_sign < DCA_cut.second))
+      {
+        continue;
+      }
+
+      std::pair<double, double> z_range_info = Get_possible_zvtx(0., inner.r, inner.z, outer.r, outer.z);
+      if (!(evt_possible_z_range.first < z_range_info.first && z_range_info.first < evt_possible_z_range.second))
+      {
+        continue;
+      }
+
+      good_pair_count += 1;
+
+      int z_bin = int((z_range_info.first - evt_possible_z_range.first) / possible_z_bin_width);
+      fast_possible_z_hist[std::min(z_bin, evt_possible_z_Nbin - 1)] += 1;
+
+      fast_line_breakdown_hist[LB_bin(z_range_info.first - z_range_info.second)] += 1;
+      fast_line_breakdown_hist[LB_bin(z_range_info.first + z_range_info.second) + 1] -= 1;
+    }
+  }
+
+  m_zvtxinfo.ntracklets = good_pair_count;
+
+  if (print_message_opt == true)
+  {
+    std::cout << "evt : " << event_i << ", good pair count : " << good_pair_count << std::endl;
+  }
+
+  if (good_pair_count <= zvtx_cal_require)
+  {
+    return true;
+  }
+
+  std::partial_sum(fast_line_breakdown_hist.begin(), fast_line_breakdown_hist.end(), fast_line_breakdown_hist.begin());
+  const int* LB_content = fast_line_breakdown_hist.data();
+  auto LB_center = [&](int bin)
+  { return LB_xmin + (bin - 0.5) * line_breakdown_bin_width; };
+
+  int peak_bin = std::distance(LB_content, std::max_element(LB_content + 1, LB_content + LB_Nbin + 1));
+  int peak_content = LB_content[peak_bin];
+  if (peak_content == 0)
+  {
+    return true;
+  }
+
+  //-----------------
+  // note : z-vertex, centroid of the peak group above the half maximum, weighted by the content above the half maximum
+  double half_max = peak_content / 2.;
+  int peak_L = peak_bin;
+  int peak_R = peak_bin;
+  while (peak_L > 1 && LB_content[peak_L - 1] > half_max)
+  {
+    peak_L--;
+  }
+  while (peak_R < LB_Nbin && LB_content[peak_R + 1] > half_max)
+  {
+    peak_R++;
+  }
+
+  double sum_w = 0;
+  double sum_wz = 0;
+  for (int i = peak_L; i <= peak_R; i++)
+  {
+    sum_w += LB_content[i] - half_max;
+    sum_wz += (LB_content[i] - half_max) * LB_center(i);
+  }
+  double peak_z = sum_wz / sum_w;
+
+  // note : width, RMS around peak_z in the same +- 90 mm range as the gaus fit in ProcessEvt, above the lowest bin of that range
+  int range_Nbin = int(90. / line_breakdown_bin_width);
+  int range_L = std::max(1, peak_bin - range_Nbin);
+  int range_R = std::min(LB_Nbin, peak_bin + range_Nbin);
+  int range_floor = *std::min_element(LB_content + range_L, LB_content + range_R + 1);
+
+  double sum_w_range = 0;
+  double sum_wdz2 = 0;
+  for (int i = range_L; i <= range_R; i++)
+  {
+    double dz = LB_center(i) - peak_z;
+    sum_w_range += LB_content[i] - range_floor;
+    sum_wdz2 += (LB_content[i] - range_floor) * dz * dz;
+  }
+  double peak_width = (sum_w_range > 0) ? std::sqrt(sum_wdz2 / sum_w_range) : 0.;
+
+  // note : every tracklet which passes the peak bin contributes 1 to it
+  double peak_zE = peak_width / std::sqrt(double(peak_content));
+
+  //-----------------
+  // note : the same quality check as ProcessEvt
+  N_group_info = find_Ngroup(fast_possible_z_hist.data(), evt_possible_z_Nbin, evt_possible_z_range.first, possible_z_bin_width);
+  N_group_info_detail = find_Ngroup(LB_content + 1, LB_Nbin, LB_xmin, line_breakdown_bin_width);
+
+  tight_offset_peak = peak_z;
+  tight_offset_width = peak_width;
+
+  good_zvtx_tag = (zvtx_QA_width.first < tight_offset_width &&
+                   tight_offset_width < zvtx_QA_width.second &&
+                   100 < fabs(N_group_info_detail[3] - N_group_info_detail[2]) &&
+                   fabs(N_group_info_detail[3] - N_group_info_detail[2]) < 190 &&
+                   N_group_info[0] < 4 &&
+                   N_group_info[1] >= 0.6 &&
+                   N_group_info_detail[0] < 7 &&
+                   N_group_info_detail[1] > 0.9);
+  good_zvtx_tag_int = (good_zvtx_tag == true) ? 1 : 0;
+
+  loose_offset_peak = peak_z;
+  loose_offset_peakE = peak_zE;
+  final_zvtx = peak_z;
+
+  m_zvtxinfo.zvtx = peak_z;
+  m_zvtxinfo.zvtx_err = peak_zE;
+  m_zvtxinfo.width = peak_width;
+  m_zvtxinfo.good = good_zvtx_tag;
+  m_zvtxinfo.ngroup = N_group_info_detail[0];
+  m_zvtxinfo.peakratio = N_group_info_detail[1];
+  m_zvtxinfo.peakwidth = fabs(N_group_info_detail[3] - N_group_info_detail[2]) / 2.;
+
+  return true;
+}
+
 void INTTZvtx::ClearEvt()
 {
   if (!m_initialized)
@@ -1733,11 +1978,16 @@ double INTTZvtx::Get_extrapolation(double given_y, double p0x, double p0y, doubl
 
 std::pair<double, double> INTTZvtx::Get_possible_zvtx(double rvtx, std::vector<double> p0, std::vector<double> p1)  // note : inner p0, outer p1, vector {r,z}, -> {y,x}
 {
-  std::vector<double> p0_z_edge = {(fabs(p0[1]) < 130) ? p0[1] - 8. : p0[1] - 10., (fabs(p0[1]) < 130) ? p0[1] + 8. : p0[1] + 10.};  // note : vector {left edge, right edge}
-  std::vector<double> p1_z_edge = {(fabs(p1[1]) < 130) ? p1[1] - 8. : p1[1] - 10., (fabs(p1[1]) < 130) ? p1[1] + 8. : p1[1] + 10.};  // note : vector {left edge, right edge}
+  return Get_possible_zvtx(rvtx, p0[0], p0[1], p1[0], p1[1]);
+}
+
+std::pair<double, double> INTTZvtx::Get_possible_zvtx(double rvtx, double p0r, double p0z, double p1r, double p1z)  // note : inner p0, outer p1
+{
+  double p0_z_edge[2] = {(fabs(p0z) < 130) ? p0z - 8. : p0z - 10., (fabs(p0z) < 130) ? p0z + 8. : p0z + 10.};  // note : {left edge, right edge}
+  double p1_z_edge[2] = {(fabs(p1z) < 130) ? p1z - 8. : p1z - 10., (fabs(p1z) < 130) ? p1z + 8. : p1z + 10.};  // note : {left edge, right edge}
 
-  double edge_first = Get_extrapolation(rvtx, p0_z_edge[0], p0[0], p1_z_edge[1], p1[0]);
-  double edge_second = Get_extrapolation(rvtx, p0_z_edge[1], p0[0], p1_z_edge[0], p1[0]);
+  double edge_first = Get_extrapolation(rvtx, p0_z_edge[0], p0r, p1_z_edge[1], p1r);
+  double edge_second = Get_extrapolation(rvtx, p0_z_edge[1], p0r, p1_z_edge[0], p1r);
 
   double mid_point = (edge_first + edge_second) / 2.;
   double possible_width = fabs(edge_first - edge_second) / 2.;
@@ -1915,6 +2165,83 @@ std::vector<double> INTTZvtx::find_Ngroup(TH1* hist_in)
   return {double(group_Nbin_vec.size()), peak_group_ratio, group_widthL_vec[peak_group_ID], group_widthR_vec[peak_group_ID]};
 }
 
+// note : same as find_Ngroup(TH1*), for the plain bin array used in ProcessEvtFast
+// note : bin_content[i] covers [xmin + i * bin_width, xmin + (i+1) * bin_width), no under/overflow
+std::vector<double> INTTZvtx::find_Ngroup(const int* bin_content, int Nbin, double xmin, double bin_width)
+{
+  int Highest_bin_index = std::distance(bin_content, std::max_element(bin_content, bin_content + Nbin));
+  double Highest_bin_Content = bin_content[Highest_bin_index];
+  double Highest_bin_Center = xmin + (Highest_bin_index + 0.5) * bin_width;
+
+  int group_Nbin = 0;
+  int peak_group_ID = 0;
+  double group_entry = 0;
+  double peak_group_ratio;
+  std::vector<int> group_Nbin_vec;
+  std::vector<double> group_entry_vec;
+  std::vector<double> group_widthL_vec;
+  std::vector<double> group_widthR_vec;
+
+  for (int i = 0; i < Nbin; i++)
+  {
+    // note : the same background rejection as find_Ngroup(TH1*)
+    double content = (bin_content[i] <= Highest_bin_Content / 2.) ? 0. : (bin_content[i] - Highest_bin_Content / 2.);
+
+    if (content != 0)
+    {
+      if (group_Nbin == 0)
+      {
+        group_widthL_vec.push_back(xmin + i * bin_width);
+      }
+
+      group_Nbin += 1;
+      group_entry += content;
+    }
+    else if (content == 0 && group_Nbin != 0)
+    {
+      group_widthR_vec.push_back(xmin + i * bin_width);
+      group_Nbin_vec.push_back(group_Nbin);
+      group_entry_vec.push_back(group_entry);
+      group_Nbin = 0;
+      group_entry = 0;
+    }
+  }
+  if (group_Nbin != 0)
+  {
+    group_Nbin_vec.push_back(group_Nbin);
+    group_entry_vec.push_back(group_entry);
+    group_widthR_vec.push_back(xmin + Nbin * bin_width);
+  }  // note : the last group at the edge
+
+  // note : find the peak group
+  for (unsigned int i = 0; i < group_Nbin_vec.size(); i++)
+  {
+    if (group_widthL_vec[i] < Highest_bin_Center && Highest_bin_Center < group_widthR_vec[i])
+    {
+      peak_group_ID = i;
+      break;
+    }
+  }
+
+  if (group_entry_vec.size() > 0)
+  {
+    peak_group_ratio = group_entry_vec[peak_group_ID] / (accumulate(group_entry_vec.begin(), group_entry_vec.end(), 0.0));
+  }
+  else
+  {
+    peak_group_ratio = 0.0;
+  }
+
+  // for the case that all bin content is 0
+  if (int(group_widthL_vec.size()) <= peak_group_ID || int(group_widthR_vec.size()) <= peak_group_ID)
+  {
+    return {double(group_Nbin_vec.size()), peak_group_ratio, -9999, -9999};
+  }
+
+  // note : {N_group, ratio (if two), peak widthL, peak widthR}
+  return {double(group_Nbin_vec.size()), peak_group_ratio, group_widthL_vec[peak_group_ID], group_widthR_vec[peak_group_ID]};
+}
+
 double INTTZvtx::get_delta_phi(double angle_1, double angle_2)
 {
   std::vector<double> vec_abs = {fabs(angle_1 - angle_2), fabs(angle_1 - angle_2 + 360), fabs(angle_1 - angle_2 - 360)};
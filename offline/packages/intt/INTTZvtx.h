@@ -97,6 +97,12 @@ class INTTZvtx
                   uint64_t bco_full,
                   int centrality_bin);
 
+  // note : histogram-free version of ProcessEvt for production, no TH1/TF1 and no QA output
+  // note : same pair selection, z from the peak of an integer line-breakdown histogram
+  bool ProcessEvtFast(int event_i,
+                      const std::vector<clu_info>& temp_sPH_inner_nocolumn_vec,
+                      const std::vector<clu_info>& temp_sPH_outer_nocolumn_vec);
+
   void ClearEvt();
   void PrintPlots();
   void EndRun();
@@ -131,6 +137,9 @@ class INTTZvtx
   bool print_message_opt;
 
   std::pair<double, double> evt_possible_z_range = {-700, 700};
+  int evt_possible_z_Nbin = 50;           // note : N bins of evt_possible_z
+  int line_breakdown_Nbin_side = 1200;    // note : N bins for each side of line_breakdown_hist, regardless the bin at zero
+  double line_breakdown_bin_width = 0.5;  // note : bin width of line_breakdown_hist, unit [mm]
 
   std::vector<std::string> conversion_mode_BD = {"ideal", "survey_1_XYAlpha_Peek", "full_survey_3.32"};
   double Integrate_portion_final = 0.68;  // cut in effSig, PrintPlots
@@ -256,9 +265,25 @@ class INTTZvtx
   std::vector<float> z_mid{};        // tracklet
   std::vector<float> z_range{};      // tracklet
 
+  // note : for ProcessEvtFast, kept as members to avoid per-event allocations
+  struct fast_clu
+  {
+    double phi;  // note : w.r.t. beam_origin, unit degree [0, 360)
+    double r;    // note : w.r.t. beam_origin, unit mm
+    double x;
+    double y;
+    double z;
+  };
+  std::vector<fast_clu> fast_inner_vec{};       // note : sorted in phi
+  std::vector<fast_clu> fast_outer_vec{};       // note : sorted in phi, with the copies across 0/360 at both ends
+  std::vector<int> fast_line_breakdown_hist{};  // note : same binning as line_breakdown_hist, [0] and [N+1] are under/overflow
+  std::vector<int> fast_possible_z_hist{};      // note : same binning as evt_possible_z
+
   // function for analysis
   std::pair<double, double> Get_possible_zvtx(double rvtx, std::vector<double> p0, std::vector<double> p1);
+  std::pair<double, double> Get_possible_zvtx(double rvtx, double p0r, double p0z, double p1r, double p1z);
   std::vector<double> find_Ngroup(TH1* hist_in);
+  std::vector<double> find_Ngroup(const int* bin_content, int Nbin, double xmin, double bin_width);
   double get_radius(double x, double y);
   double calculateAngleBetweenVectors(double x1, double y1, double x2, double y2, double targetX, double targetY);
   double Get_extrapolation(double given_y, double p0x, double p0y, double p1x, double p1y);
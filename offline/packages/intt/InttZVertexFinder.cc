@@ -15,6 +15,7 @@
 #include <fun4all/Fun4AllReturnCodes.h>
 
 #include <phool/PHCompositeNode.h>
+#include <phool/PHTimer.h>
 #include <phool/getClass.h>
 
 #include <cmath>
@@ -93,6 +94,7 @@ InttZVertexFinder::InttZVertexFinder(const std::string& name)
                             zvtx_QA_width,
                             draw_event_display,
                             enable_qa))
+  , m_timer(new PHTimer("InttZVertexFinder"))
 {
   std::cout << "InttZVertexFinder::InttZVertexFinder(const std::string &name) Calling ctor" << std::endl;
 }
@@ -102,6 +104,7 @@ InttZVertexFinder::~InttZVertexFinder()
 {
   std::cout << "InttZVertexFinder::~InttZVertexFinder() Calling dtor" << std::endl;
   delete m_inttzvtx;
+  delete m_timer;
 }
 
 //____________________________________________________________________________..
@@ -260,18 +263,25 @@ int InttZVertexFinder::process_event(PHCompositeNode* topNode)
   double TrigZvtxMC = 0.;
   Long64_t bcofull = 0;
 
-  bool status = m_inttzvtx->ProcessEvt(
-      event_i,
-      temp_sPH_inner_nocolumn_vec,
-      temp_sPH_outer_nocolumn_vec,
-      temp_sPH_nocolumn_vec,
-      temp_sPH_nocolumn_rz_vec,
-      NvtxMC,
-      TrigZvtxMC,
-      true,  // GetPhiCheckTag(temp_sPH_inner_nocolumn_vec, temp_sPH_outer_nocolumn_vec),
-      bcofull,
-      5  // centrality bin, note : no bco_full for MC
-  );
+  m_timer->restart();
+  bool status = (m_fast_mode)
+                    ? m_inttzvtx->ProcessEvtFast(
+                          event_i,
+                          temp_sPH_inner_nocolumn_vec,
+                          temp_sPH_outer_nocolumn_vec)
+                    : m_inttzvtx->ProcessEvt(
+                          event_i,
+                          temp_sPH_inner_nocolumn_vec,
+                          temp_sPH_outer_nocolumn_vec,
+                          temp_sPH_nocolumn_vec,
+                          temp_sPH_nocolumn_rz_vec,
+                          NvtxMC,
+                          TrigZvtxMC,
+                          true,  // GetPhiCheckTag(temp_sPH_inner_nocolumn_vec, temp_sPH_outer_nocolumn_vec),
+                          bcofull,
+                          5  // centrality bin, note : no bco_full for MC
+                      );
+  m_timer->stop();
 
   std::cout << "InttZVertex:process_evt status = " << (status ? "good" : "failed") << std::endl;
 
@@ -334,6 +344,7 @@ int InttZVertexFinder::End(PHCompositeNode* /*topNode*/)
   if (Verbosity())
   {
     std::cout << "InttZVertexFinder::End(PHCompositeNode *topNode) " << std::endl;
+    m_timer->print_stat();
   }
 
   m_inttzvtx->PrintPlots();
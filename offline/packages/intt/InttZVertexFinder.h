@@ -8,6 +8,7 @@
 #include <string>
 
 class PHCompositeNode;
+class PHTimer;
 class InttVertexMap;
 
 class INTTZvtx;
@@ -36,12 +37,17 @@ class InttZVertexFinder : public SubsysReco
   void EnableQA(const bool enableQA);
   void EnableEventDisplay(const bool enableEvtDisp);
 
+  //! use INTTZvtx::ProcessEvtFast, no histograms/fits and no QA/event display output
+  void SetFastMode(const bool fastMode) { m_fast_mode = fastMode; }
+
  private:
   int createNodes(PHCompositeNode *topNode);
 
  private:
   INTTZvtx *m_inttzvtx{nullptr};
   InttVertexMap *m_inttvertexmap{nullptr};
+  PHTimer *m_timer{nullptr};
+  bool m_fast_mode{false};
 };
 
 #endif  // INTT_INTTZVERTEXFINDER_H
@@ -35,11 +35,13 @@
 
 // standard includes
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <utility>
 #include <vector>
 #include <set>
@@ -133,6 +135,8 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
     exit(1);
   }
 
+  const auto start = std::chrono::steady_clock::now();
+
   // clear seed eta/phi positions
   _seed_eta.resize(0);
   _seed_phi.resize(0);
@@ -146,19 +150,42 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
     // resize UE density and energy vectors
     _UE.resize(3 , std::vector<float>(_HCAL_NETA, 0));
 
-    _EMCAL_E.resize(_HCAL_NETA, std::vector<float>(_HCAL_NPHI, 0));
-    _IHCAL_E.resize(_HCAL_NETA, std::vector<float>(_HCAL_NPHI, 0));
-    _OHCAL_E.resize(_HCAL_NETA, std::vector<float>(_HCAL_NPHI, 0));
+    const int ntowers = _HCAL_NETA * _HCAL_NPHI;
+    _EMCAL_E.resize(ntowers, 0);
+    _IHCAL_E.resize(ntowers, 0);
+    _OHCAL_E.resize(ntowers, 0);
+
+    _EMCAL_ISBAD.resize(ntowers, 0);
+    _IHCAL_ISBAD.resize(ntowers, 0);
+    _OHCAL_ISBAD.resize(ntowers, 0);
 
-    _EMCAL_ISBAD.resize(_HCAL_NETA, std::vector<int>(_HCAL_NPHI, 0));
-    _IHCAL_ISBAD.resize(_HCAL_NETA, std::vector<int>(_HCAL_NPHI, 0));
-    _OHCAL_ISBAD.resize(_HCAL_NETA, std::vector<int>(_HCAL_NPHI, 0));
+    _SEED_EXCLUDED.resize(ntowers, 0);
+
+    // tower centers do not change, evaluate them (and the trig
+    // functions needed for the Q vector) only once
+    _ETA_CENTER.resize(_HCAL_NETA, 0);
+    for (int eta = 0; eta < _HCAL_NETA; eta++)
+    {
+      _ETA_CENTER[eta] = geomIH->get_etacenter(eta);
+    }
+    _PHI_CENTER.resize(_HCAL_NPHI, 0);
+    _COS2PHI.resize(_HCAL_NPHI, 0);
+    _SIN2PHI.resize(_HCAL_NPHI, 0);
+    for (int phi = 0; phi < _HCAL_NPHI; phi++)
+    {
+      _PHI_CENTER[phi] = geomIH->get_phicenter(phi);
+      _COS2PHI[phi] = cos(2 * _PHI_CENTER[phi]);
+      _SIN2PHI[phi] = sin(2 * _PHI_CENTER[phi]);
+    }
+
+    _FLOW_MODULATION.resize(_HCAL_NPHI, 1);
+    _STRIP_E.resize(_HCAL_NPHI, 0);
 
     // for flow determination, build up a 1-D phi distribution of
     // energies from all layers summed together, populated only from eta
     // strips which do not have any excluded phi towers
     _FULLCALOFLOW_PHI_E.resize(_HCAL_NPHI, 0);
-    _FULLCALOFLOW_PHI_VAL.resize(_HCAL_NPHI, 0);
+    _FULLCALOFLOW_PHI_VAL = _PHI_CENTER;
 
     // defualt set weights to 1.0 for all phi bins
     _EMCAL_PHI_WEIGHTS.resize(_HCAL_NPHI, 1.0);
@@ -172,17 +199,20 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
   }
 
   // reset all maps map
-  _UE.assign(3, std::vector<float>(_HCAL_NETA, 0));
+  for (auto &ue : _UE)
+  {
+    std::fill(ue.begin(), ue.end(), 0);
+  }
 
-  // reset all energy vectors
-  _EMCAL_E.assign(_HCAL_NETA, std::vector<float>(_HCAL_NPHI, 0));
-  _IHCAL_E.assign(_HCAL_NETA, std::vector<float>(_HCAL_NPHI, 0));
-  _OHCAL_E.assign(_HCAL_NETA, std::vector<float>(_HCAL_NPHI, 0));
+  // reset all energy vectors (keeping their storage)
+  std::fill(_EMCAL_E.begin(), _EMCAL_E.end(), 0);
+  std::fill(_IHCAL_E.begin(), _IHCAL_E.end(), 0);
+  std::fill(_OHCAL_E.begin(), _OHCAL_E.end(), 0);
 
   // reset bad tower masks
-  _EMCAL_ISBAD.assign(_HCAL_NETA, std::vector<int>(_HCAL_NPHI, 0));
-  _IHCAL_ISBAD.assign(_HCAL_NETA, std::vector<int>(_HCAL_NPHI, 0));
-  _OHCAL_ISBAD.assign(_HCAL_NETA, std::vector<int>(_HCAL_NPHI, 0));
+  std::fill(_EMCAL_ISBAD.begin(), _EMCAL_ISBAD.end(), 0);
+  std::fill(_IHCAL_ISBAD.begin(), _IHCAL_ISBAD.end(), 0);
+  std::fill(_OHCAL_ISBAD.begin(), _OHCAL_ISBAD.end(), 0);
 
   // create a set for all eta strips to be updated
   std::set<int> EtaStripsAvailbleForFlow = {};
@@ -475,10 +505,11 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
       TowerInfo *tower = towerinfosEM3->get_tower_at_channel(channel);
       float this_E = tower->get_energy();
       int this_isBad = tower->get_isHot() || tower->get_isNoCalib() || tower->get_isNotInstr() || tower->get_isBadChi2();
-      _EMCAL_ISBAD[this_etabin][this_phibin] = this_isBad;
+      const int index = (this_etabin * _HCAL_NPHI) + this_phibin;
+      _EMCAL_ISBAD[index] = this_isBad;
       if (!this_isBad)
       { // just in case since all energy is summed
-        _EMCAL_E[this_etabin][this_phibin] += this_E;
+        _EMCAL_E[index] += this_E;
       }
       
     }
@@ -493,10 +524,11 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
       TowerInfo *tower = towerinfosIH3->get_tower_at_channel(channel);
       float this_E = tower->get_energy();
       int this_isBad = tower->get_isHot() || tower->get_isNoCalib() || tower->get_isNotInstr() || tower->get_isBadChi2();
-      _IHCAL_ISBAD[this_etabin][this_phibin] = this_isBad;
+      const int index = (this_etabin * _HCAL_NPHI) + this_phibin;
+      _IHCAL_ISBAD[index] = this_isBad;
       if (!this_isBad)
       { // just in case since all energy is summed
-        _IHCAL_E[this_etabin][this_phibin] += this_E;
+        _IHCAL_E[index] += this_E;
       }
      
     }
@@ -511,10 +543,11 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
       TowerInfo *tower = towerinfosOH3->get_tower_at_channel(channel);
       float this_E = tower->get_energy();
       int this_isBad = tower->get_isHot() || tower->get_isNoCalib() || tower->get_isNotInstr() || tower->get_isBadChi2();
-      _OHCAL_ISBAD[this_etabin][this_phibin] = this_isBad;
+      const int index = (this_etabin * _HCAL_NPHI) + this_phibin;
+      _OHCAL_ISBAD[index] = this_isBad;
       if (!this_isBad)
       { // just in case since all energy is summed
-        _OHCAL_E[this_etabin][this_phibin] += this_E;
+        _OHCAL_E[index] += this_E;
       }
       
     }
@@ -535,7 +568,7 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
       int this_phibin = geomIH->get_phibin(this_phi);
       float this_E = tower->get_energy();
 
-      _EMCAL_E[this_etabin][this_phibin] += this_E;
+      _EMCAL_E[(this_etabin * _HCAL_NPHI) + this_phibin] += this_E;
 
       if (Verbosity() > 2 && tower->get_energy() > 1)
       {
@@ -556,7 +589,7 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
       int this_phibin = geomIH->get_phibin(this_phi);
       float this_E = tower->get_energy();
 
-      _IHCAL_E[this_etabin][this_phibin] += this_E;
+      _IHCAL_E[(this_etabin * _HCAL_NPHI) + this_phibin] += this_E;
 
       if (Verbosity() > 2 && tower->get_energy() > 1)
       {
@@ -577,7 +610,7 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
       int this_phibin = geomOH->get_phibin(this_phi);
       float this_E = tower->get_energy();
 
-      _OHCAL_E[this_etabin][this_phibin] += this_E;
+      _OHCAL_E[(this_etabin * _HCAL_NPHI) + this_phibin] += this_E;
 
       if (Verbosity() > 2 && tower->get_energy() > 1)
       {
@@ -653,20 +686,20 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
         for ( const auto &eta : EtaStripsAvailbleForFlow )
         {
  
-          EMCAL_MAX_TOWERS_THIS_PHI-= _EMCAL_ISBAD[eta][phi]; // decrement the possible count for this phi bin
-          IHCAL_MAX_TOWERS_THIS_PHI-= _IHCAL_ISBAD[eta][phi]; // decrement the possible count for this phi bin
-          OHCAL_MAX_TOWERS_THIS_PHI-= _OHCAL_ISBAD[eta][phi]; // decrement the possible count for this phi bin        
+          EMCAL_MAX_TOWERS_THIS_PHI-= _EMCAL_ISBAD[(eta * _HCAL_NPHI) + phi]; // decrement the possible count for this phi bin
+          IHCAL_MAX_TOWERS_THIS_PHI-= _IHCAL_ISBAD[(eta * _HCAL_NPHI) + phi]; // decrement the possible count for this phi bin
+          OHCAL_MAX_TOWERS_THIS_PHI-= _OHCAL_ISBAD[(eta * _HCAL_NPHI) + phi]; // decrement the possible count for this phi bin        
           if ( Verbosity() > 10 )
           {
-            if ( _EMCAL_ISBAD[eta][phi] )
+            if ( _EMCAL_ISBAD[(eta * _HCAL_NPHI) + phi] )
             {
               std::cout << "DetermineTowerBackground::process_event: --> found bad tower in EMCAL at ieta / iphi = " << eta << " / " << phi << std::endl;
             }
-            if ( _IHCAL_ISBAD[eta][phi] )
+            if ( _IHCAL_ISBAD[(eta * _HCAL_NPHI) + phi] )
             {
               std::cout << "DetermineTowerBackground::process_event: --> found bad tower in IHCAL at ieta / iphi = " << eta << " / " << phi << std::endl;
             }
-            if ( _OHCAL_ISBAD[eta][phi] )
+            if ( _OHCAL_ISBAD[(eta * _HCAL_NPHI) + phi] )
             {
               std::cout << "DetermineTowerBackground::process_event: --> found bad tower in OHCAL at ieta / iphi = " << eta << " / " << phi << std::endl;
             }
@@ -761,9 +794,9 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
         // get the number of bad phi towers within this eta strip
         // only look at the eta strips which are still available for flow determination which are in the
         // set EtaStripsAvailbleForFlow
-        int bad_phis_int_this_eta_EMCAL = std::count(_EMCAL_ISBAD[eta].begin(), _EMCAL_ISBAD[eta].end(), 1); // count bad towers in this eta strip
-        int bad_phis_int_this_eta_IHCAL = std::count(_IHCAL_ISBAD[eta].begin(), _IHCAL_ISBAD[eta].end(), 1); // count bad towers in this eta strip
-        int bad_phis_int_this_eta_OHCAL = std::count(_OHCAL_ISBAD[eta].begin(), _OHCAL_ISBAD[eta].end(), 1); // count bad towers in this eta strip
+        int bad_phis_int_this_eta_EMCAL = std::count(_EMCAL_ISBAD.begin() + (eta * _HCAL_NPHI), _EMCAL_ISBAD.begin() + ((eta + 1) * _HCAL_NPHI), 1); // count bad towers in this eta strip
+        int bad_phis_int_this_eta_IHCAL = std::count(_IHCAL_ISBAD.begin() + (eta * _HCAL_NPHI), _IHCAL_ISBAD.begin() + ((eta + 1) * _HCAL_NPHI), 1); // count bad towers in this eta strip
+        int bad_phis_int_this_eta_OHCAL = std::count(_OHCAL_ISBAD.begin() + (eta * _HCAL_NPHI), _OHCAL_ISBAD.begin() + ((eta + 1) * _HCAL_NPHI), 1); // count bad towers in this eta strip
         if (Verbosity() > 3)
         {
           std::cout << "DetermineTowerBackground::process_event: --> found " << bad_phis_int_this_eta_EMCAL << " bad towers in EMCAL, " 
@@ -844,8 +877,26 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
       _nStrips = nStripsAvailableForFlow;
       
       // update the full calorimeter flow vectors
-      _FULLCALOFLOW_PHI_E.assign(_HCAL_NPHI, 0.0);
-      _FULLCALOFLOW_PHI_VAL.assign(_HCAL_NPHI, 0.0);
+      std::fill(_FULLCALOFLOW_PHI_E.begin(), _FULLCALOFLOW_PHI_E.end(), 0);
+
+      // add up the available eta strips for each layer, one full phi row at a time.
+      // For every phi bin the strips are still added in the same order
+      // (CEMC, IHCAL, OHCAL, ascending eta), the inner loop just runs over phi
+      // if reweighting is enabled, the weights are applied, if not, they are 1.0
+      auto add_strips = [this](const std::set<int> &strips, const std::vector<float> &energies, const std::vector<float> &weights)
+      {
+        for (const auto &eta : strips)
+        {
+          const float *row = &energies[eta * _HCAL_NPHI];
+          for (int phi = 0; phi < _HCAL_NPHI; phi++)
+          {
+            _FULLCALOFLOW_PHI_E[phi] += row[phi] * weights[phi];
+          }
+        }
+      };
+      add_strips(AVAILIBLE_ETA_STRIPS_CEMC, _EMCAL_E, _EMCAL_PHI_WEIGHTS);
+      add_strips(AVAILIBLE_ETA_STRIPS_IHCAL, _IHCAL_E, _IHCAL_PHI_WEIGHTS);
+      add_strips(AVAILIBLE_ETA_STRIPS_OHCAL, _OHCAL_E, _OHCAL_PHI_WEIGHTS);
 
       // flow determination
       float Q_x = 0;
@@ -853,27 +904,10 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
       float sum_E = 0;
       for (int phi = 0; phi < _HCAL_NPHI; phi++)
       {
-        _FULLCALOFLOW_PHI_VAL[phi] = geomIH->get_phicenter(phi);
-        // loop over the available eta strips for each layer
-      
-        for (const auto &eta : AVAILIBLE_ETA_STRIPS_CEMC)
-        {
-          _FULLCALOFLOW_PHI_E[phi] += _EMCAL_E[eta][phi] * _EMCAL_PHI_WEIGHTS[phi]; // if reweighting is enabled, the weights are applied, if not, they are 1.0
-        }
-        for (const auto &eta : AVAILIBLE_ETA_STRIPS_IHCAL)
-        {
-          _FULLCALOFLOW_PHI_E[phi] += _IHCAL_E[eta][phi] * _IHCAL_PHI_WEIGHTS[phi]; // if reweighting is enabled, the weights are applied, if not, they are 1.0
-        }
-        for (const auto &eta : AVAILIBLE_ETA_STRIPS_OHCAL)
-        {
-          _FULLCALOFLOW_PHI_E[phi] += _OHCAL_E[eta][phi] * _OHCAL_PHI_WEIGHTS[phi]; // if reweighting is enabled, the weights are applied, if not, they are 1.0
-        }
-
         // sum up the energy in this phi bin
-        Q_x += _FULLCALOFLOW_PHI_E[phi] * cos(2 * _FULLCALOFLOW_PHI_VAL[phi]);
-        Q_y += _FULLCALOFLOW_PHI_E[phi] * sin(2 * _FULLCALOFLOW_PHI_VAL[phi]);
+        Q_x += _FULLCALOFLOW_PHI_E[phi] * _COS2PHI[phi];
+        Q_y += _FULLCALOFLOW_PHI_E[phi] * _SIN2PHI[phi];
         sum_E += _FULLCALOFLOW_PHI_E[phi];
-
       } 
 
       if (_do_flow == 1)
@@ -1034,54 +1068,17 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
   // now calculate energy densities...
   _nTowers = 0;  // store how many towers were used to determine bkg
 
-  // starting with the EMCal first...
-  for (int layer = 0; layer < 3; layer++)
+  // the seed exclusion and the flow modulation only depend on the tower
+  // position, evaluate them once per event rather than for each layer
+  std::fill(_SEED_EXCLUDED.begin(), _SEED_EXCLUDED.end(), 0);
+  if (!_seed_eta.empty())
   {
-    int local_max_eta = _HCAL_NETA;
-    int local_max_phi = _HCAL_NPHI;
-
-    for (int eta = 0; eta < local_max_eta; eta++)
+    for (int eta = 0; eta < _HCAL_NETA; eta++)
     {
-      float total_E = 0;
-      int total_tower = 0;
-
-      for (int phi = 0; phi < local_max_phi; phi++)
+      float this_eta = _ETA_CENTER[eta];
+      for (int phi = 0; phi < _HCAL_NPHI; phi++)
       {
-        float this_eta = geomIH->get_etacenter(eta);
-        float this_phi = geomIH->get_phicenter(phi);
-
-        bool isExcluded = false;
-
-        // nobody can understand these nested ?s, which just makes this error prone and a maintenance headache
-        //        float my_E = (layer == 0 ? _EMCAL_E[eta][phi] : (layer == 1 ? _IHCAL_E[eta][phi] : _OHCAL_E[eta][phi]));
-        //        int this_isBad = (layer == 0 ? _EMCAL_ISBAD[eta][phi] : (layer == 1 ? _IHCAL_ISBAD[eta][phi] : _OHCAL_ISBAD[eta][phi]));
-        //	please use the following if/else if/else
-        float my_E;
-        int this_isBad;
-        if (layer == 0)
-        {
-          my_E = _EMCAL_E[eta][phi];
-          this_isBad = _EMCAL_ISBAD[eta][phi];
-        }
-        else if (layer == 1)
-        {
-          my_E = _IHCAL_E[eta][phi];
-          this_isBad = _IHCAL_ISBAD[eta][phi];
-        }
-        else
-        {
-          my_E = _OHCAL_E[eta][phi];
-          this_isBad = _OHCAL_ISBAD[eta][phi];
-        }
-        // if the tower is masked (energy identically zero), exclude it
-        if (this_isBad)
-        {
-          isExcluded = true;
-          if (Verbosity() > 10)
-          {
-            std::cout << " tower in layer " << layer << " at eta / phi = " << this_eta << " / " << this_phi << " with E = " << my_E << " excluded due to masking" << std::endl;
-          }
-        }
+        float this_phi = _PHI_CENTER[phi];
         for (unsigned int iseed = 0; iseed < _seed_eta.size(); iseed++)
         {
           float deta = this_eta - _seed_eta[iseed];
@@ -1097,39 +1094,57 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
           float dR = sqrt(pow(deta, 2) + pow(dphi, 2));
           if (dR < 0.4)
           {
-            isExcluded = true;
+            _SEED_EXCLUDED[(eta * _HCAL_NPHI) + phi] = 1;
             if (Verbosity() > 10)
             {
-              std::cout << " setting excluded mark from seed at eta / phi = " << _seed_eta[iseed] << " / " << _seed_phi[iseed] << std::endl;
+              std::cout << " tower at eta / phi = " << this_eta << " / " << this_phi << " excluded by seed at eta / phi = " << _seed_eta[iseed] << " / " << _seed_phi[iseed] << std::endl;
             }
           }
         }
+      }
+    }
+  }
+  for (int phi = 0; phi < _HCAL_NPHI; phi++)
+  {
+    _FLOW_MODULATION[phi] = 1 + 2 * _v2 * std::cos(2 * (_PHI_CENTER[phi] - _Psi2));
+  }
 
-        if (!isExcluded)
-        {
-          if (layer == 0)
-          {
-            total_E += _EMCAL_E[eta][phi] / (1 + 2 * _v2 * std::cos(2 * (this_phi - _Psi2)));
-          }
-          if (layer == 1)
-          {
-            total_E += _IHCAL_E[eta][phi] / (1 + 2 * _v2 * std::cos(2 * (this_phi - _Psi2)));
-          }
-          if (layer == 2)
-          {
-            total_E += _OHCAL_E[eta][phi] / (1 + 2 * _v2 * std::cos(2 * (this_phi - _Psi2)));
-          }
-          total_tower++;  // towers in this eta range & layer
-          _nTowers++;     // towers in entire calorimeter
-        }
-        else
+  // starting with the EMCal first...
+  for (int layer = 0; layer < 3; layer++)
+  {
+    const std::vector<float> &layer_E = (layer == 0 ? _EMCAL_E : (layer == 1 ? _IHCAL_E : _OHCAL_E));
+    const std::vector<int> &layer_isBad = (layer == 0 ? _EMCAL_ISBAD : (layer == 1 ? _IHCAL_ISBAD : _OHCAL_ISBAD));
+
+    for (int eta = 0; eta < _HCAL_NETA; eta++)
+    {
+      const float *strip_E = &layer_E[eta * _HCAL_NPHI];
+      const int *strip_isBad = &layer_isBad[eta * _HCAL_NPHI];
+      const char *strip_excluded = &_SEED_EXCLUDED[eta * _HCAL_NPHI];
+
+      // flow corrected energies of the whole strip, no branches so this vectorizes
+      for (int phi = 0; phi < _HCAL_NPHI; phi++)
+      {
+        _STRIP_E[phi] = strip_E[phi] / _FLOW_MODULATION[phi];
+      }
+
+      // the sum itself is kept in phi order so the UE is unchanged
+      float total_E = 0;
+      int total_tower = 0;
+      for (int phi = 0; phi < _HCAL_NPHI; phi++)
+      {
+        // if the tower is masked (energy identically zero), exclude it
+        if (strip_isBad[phi] || strip_excluded[phi])
         {
           if (Verbosity() > 10)
           {
-            std::cout << " tower at eta / phi = " << this_eta << " / " << this_phi << " with E = " << total_E << " excluded due to seed " << std::endl;
+            std::cout << " tower in layer " << layer << " at eta / phi = " << _ETA_CENTER[eta] << " / " << _PHI_CENTER[phi] << " with E = " << strip_E[phi] << " excluded due to " << (strip_isBad[phi] ? "masking" : "seed") << std::endl;
           }
+          continue;
         }
+        total_E += _STRIP_E[phi];
+        total_tower++;  // towers in this eta range & layer
       }
+      _nTowers += total_tower;  // towers in entire calorimeter
 
       std::pair<float, float> etabounds = geomIH->get_etabounds(eta);
       std::pair<float, float> phibounds = geomIH->get_phibounds(0);
@@ -1174,14 +1189,42 @@ int DetermineTowerBackground::process_event(PHCompositeNode *topNode)
 
   FillNode(topNode);
 
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  float event_E = 0;
+  for (const auto *layer_E : {&_EMCAL_E, &_IHCAL_E, &_OHCAL_E})
+  {
+    event_E = std::accumulate(layer_E->begin(), layer_E->end(), event_E);
+  }
+  _timing_nevents++;
+  _timing_total_ms += elapsed.count();
+  if (event_E > _timing_central_E)
+  {
+    _timing_ncentral++;
+    _timing_central_ms += elapsed.count();
+  }
+
   if (Verbosity() > 0)
   {
+    std::cout << "DetermineTowerBackground::process_event: tower E = " << event_E << ", UE determination took " << elapsed.count() << " ms" << std::endl;
     std::cout << "DetermineTowerBackground::process_event: exiting" << std::endl;
   }
 
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
+int DetermineTowerBackground::End(PHCompositeNode * /*topNode*/)
+{
+  if (Verbosity() > 0 && _timing_nevents > 0)
+  {
+    std::cout << "DetermineTowerBackground::End: " << _timing_nevents << " events, < time > = " << _timing_total_ms / _timing_nevents << " ms" << std::endl;
+    if (_timing_ncentral > 0)
+    {
+      std::cout << "DetermineTowerBackground::End: " << _timing_ncentral << " central events ( tower E > " << _timing_central_E << " ), < time > = " << _timing_central_ms / _timing_ncentral << " ms" << std::endl;
+    }
+  }
+  return Fun4AllReturnCodes::EVENT_OK;
+}
+
 int DetermineTowerBackground::CreateNode(PHCompositeNode *topNode)
 {
   PHNodeIterator iter(topNode);
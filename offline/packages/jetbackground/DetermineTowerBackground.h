@@ -33,6 +33,7 @@ class DetermineTowerBackground : public SubsysReco
 
   int InitRun(PHCompositeNode *topNode) override;
   int process_event(PHCompositeNode *topNode) override;
+  int End(PHCompositeNode *topNode) override;
 
   void SetBackgroundOutputName(const std::string &name) { _backgroundName = name; }
   void SetSeedType(int seed_type) { _seed_type = seed_type; }
@@ -44,6 +45,10 @@ class DetermineTowerBackground : public SubsysReco
 
   void UseReweighting(bool do_reweight ) {  _do_reweight = do_reweight; }
 
+  // events with more (unmasked) tower energy than this are counted as
+  // central in the timing summary printed at End()
+  void SetTimingCentralE(float E) { _timing_central_E = E; }
+
   void set_towerinfo(bool use_towerinfo)
   {
     m_use_towerinfo = use_towerinfo;
@@ -70,13 +75,30 @@ class DetermineTowerBackground : public SubsysReco
   int _HCAL_NPHI{-1};
 
   
-  std::vector<std::vector<float> > _EMCAL_E;
-  std::vector<std::vector<float> > _IHCAL_E;
-  std::vector<std::vector<float> > _OHCAL_E;
+  // tower energies and bad tower flags, flattened as [eta * _HCAL_NPHI + phi]
+  // allocated on the first event and reused afterwards
+  std::vector<float> _EMCAL_E;
+  std::vector<float> _IHCAL_E;
+  std::vector<float> _OHCAL_E;
+
+  std::vector<int> _EMCAL_ISBAD;
+  std::vector<int> _IHCAL_ISBAD;
+  std::vector<int> _OHCAL_ISBAD;
+
+  // towers within dR < 0.4 of a seed, same layout, shared by all layers
+  std::vector<char> _SEED_EXCLUDED;
 
-  std::vector<std::vector<int> > _EMCAL_ISBAD;
-  std::vector<std::vector<int> > _IHCAL_ISBAD;
-  std::vector<std::vector<int> > _OHCAL_ISBAD;
+  // tower eta / phi centers and cos / sin(2 phi) per phi bin, from the geometry
+  std::vector<float> _ETA_CENTER;
+  std::vector<float> _PHI_CENTER;
+  std::vector<double> _COS2PHI;
+  std::vector<double> _SIN2PHI;
+
+  // per event flow modulation 1 + 2 v2 cos(2 (phi - Psi2)) per phi bin
+  std::vector<float> _FLOW_MODULATION;
+
+  // flow corrected energies of the eta strip being summed
+  std::vector<float> _STRIP_E;
 
   // 1-D energies vs. phi (integrated over eta strips with complete
   // phi coverage, and all layers)
@@ -106,6 +128,12 @@ class DetermineTowerBackground : public SubsysReco
   bool _reweight_failed{false};
 
   std::string m_towerNodePrefix{"TOWERINFO_CALIB"};
+  float _timing_central_E{1000.};
+  int _timing_nevents{0};
+  int _timing_ncentral{0};
+  double _timing_total_ms{0};
+  double _timing_central_ms{0};
+
   std::string EMTowerName;
   std::string IHTowerName;
   std::string OHTowerName;
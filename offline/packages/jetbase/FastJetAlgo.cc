@@ -174,32 +174,77 @@ FastJetAlgo::jets_to_pseudojets(std::vector<Jet*>& particles) const
     {
       continue;
     }
-    if (!std::isfinite(particles[ipart]->get_px()) ||
-        !std::isfinite(particles[ipart]->get_py()) ||
-        !std::isfinite(particles[ipart]->get_pz()) ||
-        !std::isfinite(particles[ipart]->get_e()))
+    check_kinematics(particles[ipart]);
+    fastjet::PseudoJet pseudojet(particles[ipart]->get_px(),
+                                 particles[ipart]->get_py(),
+                                 particles[ipart]->get_pz(),
+                                 particles[ipart]->get_e());
+    if (m_opt.use_constituent_min_pt && pseudojet.perp() < m_opt.constituent_min_pt)
     {
-      std::cout << PHWHERE << " invalid particle kinematics:"
-                << " px: " << particles[ipart]->get_px()
-                << " py: " << particles[ipart]->get_py()
-                << " pz: " << particles[ipart]->get_pz()
-                << " e: " << particles[ipart]->get_e() << std::endl;
-      gSystem->Exit(1);
+      continue;
     }
+    pseudojet.set_user_index(ipart);
+    pseudojets.push_back(pseudojet);
+  }
+  return pseudojets;
+}
+
+std::vector<fastjet::PseudoJet>
+FastJetAlgo::particles_to_pseudojets(const std::vector<Jet*>& particles)
+{
+  std::vector<fastjet::PseudoJet> pseudojets;
+  pseudojets.reserve(particles.size());
+  for (unsigned int ipart = 0; ipart < particles.size(); ++ipart)
+  {
     fastjet::PseudoJet pseudojet(particles[ipart]->get_px(),
                                  particles[ipart]->get_py(),
                                  particles[ipart]->get_pz(),
                                  particles[ipart]->get_e());
+    pseudojet.set_user_index(ipart);
+    pseudojets.push_back(pseudojet);
+  }
+  return pseudojets;
+}
+
+std::vector<fastjet::PseudoJet>
+FastJetAlgo::select_pseudojets(const std::vector<Jet*>& particles, const std::vector<fastjet::PseudoJet>& all_pseudojets) const
+{
+  // same cuts as jets_to_pseudojets, on the already converted input
+  std::vector<fastjet::PseudoJet> pseudojets;
+  pseudojets.reserve(all_pseudojets.size());
+  for (const auto& pseudojet : all_pseudojets)
+  {
+    const Jet* particle = particles[pseudojet.user_index()];
+    if (particle->get_e() < m_opt.constituent_min_E)
+    {
+      continue;
+    }
+    check_kinematics(particle);
     if (m_opt.use_constituent_min_pt && pseudojet.perp() < m_opt.constituent_min_pt)
     {
       continue;
     }
-    pseudojet.set_user_index(ipart);
     pseudojets.push_back(pseudojet);
   }
   return pseudojets;
 }
 
+void FastJetAlgo::check_kinematics(const Jet* particle) const
+{
+  if (!std::isfinite(particle->get_px()) ||
+      !std::isfinite(particle->get_py()) ||
+      !std::isfinite(particle->get_pz()) ||
+      !std::isfinite(particle->get_e()))
+  {
+    std::cout << PHWHERE << " invalid particle kinematics:"
+              << " px: " << particle->get_px()
+              << " py: " << particle->get_py()
+              << " pz: " << particle->get_pz()
+              << " e: " << particle->get_e() << std::endl;
+    gSystem->Exit(1);
+  }
+}
+
 void FastJetAlgo::first_call_init(JetContainer* jetcont)
 {
   m_first_cluster_call = false;
@@ -252,11 +297,8 @@ void FastJetAlgo::first_call_init(JetContainer* jetcont)
 
 void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* jetcont)
 {
-  if (m_first_cluster_call)
-  {
-    first_call_init(jetcont);
-  }
   // initalize the properties in JetContainer
+  initialize_container(jetcont);
 
   if (m_opt.verbosity > 1)
   {
@@ -270,6 +312,31 @@ void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* j
   // translate input jets to input fastjets
   auto pseudojets = jets_to_pseudojets(particles);
 
+  run_clustering(pseudojets);
+  fill(particles, jetcont);
+}
+
+void FastJetAlgo::initialize_container(JetContainer* jetcont)
+{
+  if (m_first_cluster_call)
+  {
+    first_call_init(jetcont);
+  }
+}
+
+void FastJetAlgo::cluster(const std::vector<Jet*>& particles, const std::vector<fastjet::PseudoJet>& all_pseudojets)
+{
+  if (m_opt.verbosity > 1)
+  {
+    std::cout << "   Verbosity>1 FastJetAlgo::cluster -- entered" << std::endl;
+  }
+
+  auto pseudojets = select_pseudojets(particles, all_pseudojets);
+  run_clustering(pseudojets);
+}
+
+void FastJetAlgo::run_clustering(std::vector<fastjet::PseudoJet>& pseudojets)
+{
   // if using constituent subtraction, oberve maximum eta and subtract the constituents
   if (m_opt.cs_calc_constsub)
   {
@@ -319,10 +386,20 @@ void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* j
 
   if (m_opt.calc_jetmedbkgdens)
   {
-    jetcont->set_rho_median(calc_rhomeddens(pseudojets));
+    m_rho_median = calc_rhomeddens(pseudojets);
+  }
+
+  m_fastjets = (m_opt.calc_area ? cluster_area_jets(pseudojets) : cluster_jets(pseudojets));
+}
+
+void FastJetAlgo::fill(const std::vector<Jet*>& particles, JetContainer* jetcont)
+{
+  if (m_opt.calc_jetmedbkgdens)
+  {
+    jetcont->set_rho_median(m_rho_median);
   }
 
-  auto fastjets = (m_opt.calc_area ? cluster_area_jets(pseudojets) : cluster_jets(pseudojets));
+  auto& fastjets = m_fastjets;
 
   if (m_opt.verbosity > 8)
   {
@@ -410,6 +487,7 @@ void FastJetAlgo::cluster_and_fill(std::vector<Jet*>& particles, JetContainer* j
   {
     std::cout << "FastJetAlgo::process_event -- exited" << std::endl;
   }
+  fastjets.clear();
   delete (m_opt.calc_area ? m_cluseqarea : m_cluseq);  // if (m_cluseq) delete m_cluseq;
 }
 
@@ -49,6 +49,25 @@ class FastJetAlgo : public JetAlgo
   std::vector<Jet*> get_jets(std::vector<Jet*> particles) override;
   void cluster_and_fill(std::vector<Jet*>& particles, JetContainer* jetcont) override;
 
+  //----------------------------------------------------------------------
+  //  cluster_and_fill split in steps, used by JetReco to run several
+  //  algorithms on the same input concurrently:
+  //  - particles_to_pseudojets converts the input once for all algorithms
+  //    (no constituent cuts applied, user index = position in particles)
+  //  - initialize_container on the calling thread, after the container Reset
+  //  - cluster only touches this object and can run on any thread, provided
+  //    FastJet is built with --enable-limited-thread-safety (ClusterSequence
+  //    warnings go through static LimitedWarning counters)
+  //  - fill writes the jets into the container, on the calling thread
+  //----------------------------------------------------------------------
+  static std::vector<fastjet::PseudoJet> particles_to_pseudojets(const std::vector<Jet*>& particles);
+  void initialize_container(JetContainer* jetcont);
+  void cluster(const std::vector<Jet*>& particles, const std::vector<fastjet::PseudoJet>& all_pseudojets);
+  void fill(const std::vector<Jet*>& particles, JetContainer* jetcont);
+
+  // ghosts are placed with FastJet's shared random generator
+  bool uses_ghosts() const { return m_opt.calc_area || m_opt.calc_jetmedbkgdens; }
+
  private:
   FastJetOptions m_opt{};
   bool m_first_cluster_call{true};
@@ -61,6 +80,9 @@ class FastJetAlgo : public JetAlgo
 
   // Internal processes
   std::vector<fastjet::PseudoJet> jets_to_pseudojets(std::vector<Jet*>& particles) const;
+  std::vector<fastjet::PseudoJet> select_pseudojets(const std::vector<Jet*>& particles, const std::vector<fastjet::PseudoJet>& all_pseudojets) const;
+  void check_kinematics(const Jet* particle) const;
+  void run_clustering(std::vector<fastjet::PseudoJet>& pseudojets);
   std::vector<fastjet::PseudoJet> cluster_jets(std::vector<fastjet::PseudoJet>& pseudojets);
   std::vector<fastjet::PseudoJet> cluster_area_jets(std::vector<fastjet::PseudoJet>& pseudojets);
   float calc_rhomeddens(std::vector<fastjet::PseudoJet>& constituents) const;
@@ -75,6 +97,10 @@ class FastJetAlgo : public JetAlgo
 
   fastjet::ClusterSequence* m_cluseq{nullptr};
   fastjet::ClusterSequence* m_cluseqarea{nullptr};
+
+  // results of run_clustering, kept until fill
+  std::vector<fastjet::PseudoJet> m_fastjets;
+  float m_rho_median{0};
 };
 
 #endif
@@ -1,6 +1,7 @@
 
 #include "JetReco.h"
 
+#include "FastJetAlgo.h"
 #include "Jet.h"
 #include "JetAlgo.h"
 #include "JetContainer.h"
@@ -22,15 +23,34 @@
 #include <phool/getClass.h>
 #include <phool/phool.h>  // for PHWHERE
 
+#include <fastjet/config.h>
+
 #include <boost/format.hpp>
 
 // standard includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>  // for exit
+#include <exception>
 #include <fstream>
 #include <iostream>
 #include <memory>  // for allocator_traits<>::value_type
+#include <thread>
 #include <vector>
 
+namespace
+{
+  // FastJet's LimitedWarning counters (and error/warning bookkeeping) are static members shared by all
+  // ClusterSequences. They are only safe to update from several threads when FastJet is built with
+  // --enable-limited-thread-safety (or --enable-thread-safety). Otherwise algorithms are clustered one at a time
+#if defined(FASTJET_HAVE_LIMITED_THREAD_SAFETY) || defined(FASTJET_HAVE_THREAD_SAFETY)
+  constexpr bool fastjet_thread_safe = true;
+#else
+  constexpr bool fastjet_thread_safe = false;
+#endif
+}  // namespace
+
 JetReco::JetReco(const std::string &name, TRANSITION _which)
   : SubsysReco(name)
   , which_fill{_which}
@@ -79,6 +99,12 @@ int JetReco::InitRun(PHCompositeNode *topNode)
     std::cout << "===========================================================================" << std::endl;
   }
 
+  if (m_nthreads > 1 && !fastjet_thread_safe)
+  {
+    std::cout << PHWHERE << " WARNING: FastJet was not built with --enable-limited-thread-safety, "
+              << m_nthreads << " threads requested, algorithms will run one at a time" << std::endl;
+  }
+
   return CreateNodes(topNode);
 }
 
@@ -108,11 +134,16 @@ int JetReco::process_event(PHCompositeNode *topNode)
   //---------------------------
   // Run the jet reconstruction
   //---------------------------
+  const bool concurrent = (fastjet_thread_safe && use_jetcon && m_nthreads > 1 && _algos.size() > 1);
+  if (concurrent)
+  {
+    FillJetContainers(topNode, inputs);
+  }
   for (unsigned int ialgo = 0; ialgo < _algos.size(); ++ialgo)
   {
     // send the output somewhere on the DST
     /* if (_fill_JetContainer) { */
-    if (use_jetcon)
+    if (use_jetcon && !concurrent)
     {
       if (Verbosity() > 5)
       {
@@ -307,6 +338,120 @@ void JetReco::FillJetContainer(PHCompositeNode *topNode, int ipos, std::vector<J
   return;
 }
 
+void JetReco::FillJetContainers(PHCompositeNode *topNode, std::vector<Jet *> &inputs)
+{
+  const auto start = std::chrono::steady_clock::now();
+
+  std::vector<JetContainer *> jetconns(_algos.size(), nullptr);
+  std::vector<FastJetAlgo *> fastjetalgos(_algos.size(), nullptr);
+  std::vector<unsigned int> local_algos;   // clustered on this thread
+  std::vector<unsigned int> worker_algos;  // clustered on the worker threads
+  for (unsigned int ialgo = 0; ialgo < _algos.size(); ++ialgo)
+  {
+    jetconns[ialgo] = findNode::getClass<JetContainer>(topNode, JC_name(_outputs[ialgo]));
+    if (!jetconns[ialgo])
+    {
+      std::cout << PHWHERE << " ERROR: Can't find JetContainer: " << _outputs[ialgo] << std::endl;
+      exit(-1);
+    }
+    fastjetalgos[ialgo] = dynamic_cast<FastJetAlgo *>(_algos[ialgo]);
+    if (!fastjetalgos[ialgo])
+    {
+      // not splittable, run it as before
+      FillJetContainer(topNode, ialgo, inputs);
+      continue;
+    }
+    jetconns[ialgo]->Reset();
+    fastjetalgos[ialgo]->initialize_container(jetconns[ialgo]);
+    if (fastjetalgos[ialgo]->uses_ghosts())
+    {
+      local_algos.push_back(ialgo);
+    }
+    else
+    {
+      worker_algos.push_back(ialgo);
+    }
+  }
+
+  // the conversion to PseudoJets is shared by all algorithms
+  const std::vector<fastjet::PseudoJet> pseudojets = FastJetAlgo::particles_to_pseudojets(inputs);
+
+  // exceptions (fastjet::Error) are passed back to this thread
+  std::vector<std::exception_ptr> errors(_algos.size());
+  auto run = [&](unsigned int ialgo)
+  {
+    try
+    {
+      fastjetalgos[ialgo]->cluster(inputs, pseudojets);
+    }
+    catch (...)
+    {
+      errors[ialgo] = std::current_exception();
+    }
+  };
+
+  std::atomic<unsigned int> next{0};
+  auto worker = [&]()
+  {
+    for (unsigned int i = next++; i < worker_algos.size(); i = next++)
+    {
+      run(worker_algos[i]);
+    }
+  };
+
+  const unsigned int nworkers = std::min<unsigned int>(m_nthreads - 1, worker_algos.size());
+  std::vector<std::thread> threads;
+  threads.reserve(nworkers);
+  for (unsigned int i = 0; i < nworkers; ++i)
+  {
+    threads.emplace_back(worker);
+  }
+  for (const auto &ialgo : local_algos)
+  {
+    run(ialgo);
+  }
+  // then help with what is left
+  worker();
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  for (const auto &error : errors)
+  {
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+
+  // filling the containers (TClonesArrays) stays on this thread, in the algorithm order
+  for (unsigned int ialgo = 0; ialgo < _algos.size(); ++ialgo)
+  {
+    if (!fastjetalgos[ialgo])
+    {
+      continue;
+    }
+    fastjetalgos[ialgo]->fill(inputs, jetconns[ialgo]);
+    for (auto &_input : _inputs)
+    {
+      jetconns[ialgo]->insert_src(_input->get_src());
+    }
+
+    if (Verbosity() > 7)
+    {
+      std::cout << " Verbosity()>7:: jets in container " << _outputs[ialgo] << std::endl;
+      jetconns[ialgo]->print_jets();
+    }
+  }
+
+  if (Verbosity() > 1)
+  {
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "JetReco::FillJetContainers - " << _algos.size() << " algorithms ( " << worker_algos.size() << " on " << nworkers + 1 << " threads ) took " << elapsed.count() << " ms" << std::endl;
+  }
+}
+
 JetAlgo *JetReco::get_algo(unsigned int which_algo)
 {
   if (_algos.empty())
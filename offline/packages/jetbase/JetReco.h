@@ -54,6 +54,14 @@ class JetReco : public SubsysReco
 
   void set_algo_node(const std::string &algonode) { _algonode = algonode; }
   void set_input_node(const std::string &inputnode) { _inputnode = inputnode; }
+
+  // cluster the JetContainer outputs of all FastJetAlgos with up to nthreads
+  // threads, converting the input to PseudoJets only once. Algorithms using
+  // ghosts (areas, rho) stay on the calling thread so their output does not
+  // depend on the scheduling. The default (1) runs the algorithms one by one.
+  // Requires FastJet built with --enable-limited-thread-safety, since its
+  // LimitedWarning counters are static; otherwise the algorithms run one by one
+  void set_nthreads(unsigned int nthreads) { m_nthreads = nthreads; }
   /* void set_fill_JetContainer(bool b) { _fill_JetContainer = b; } */
 
   JetAlgo *get_algo(unsigned int which_algo = 0);
@@ -62,12 +70,14 @@ class JetReco : public SubsysReco
   int CreateNodes(PHCompositeNode *topNode);
   void FillJetNode(PHCompositeNode *topNode, int ipos, const std::vector<Jet *> &jets);
   void FillJetContainer(PHCompositeNode *topNode, int ipos, std::vector<Jet *> &inputs);
+  void FillJetContainers(PHCompositeNode *topNode, std::vector<Jet *> &inputs);
 
   std::vector<JetInput *> _inputs;
   std::vector<JetAlgo *> _algos;
   std::string _algonode;
   std::string _inputnode;
   std::vector<std::string> _outputs;
+  unsigned int m_nthreads{1};
 
   // transition functions, while moving from JetMap to JetContainer.
   // May be removed after transition is made, depending on state of
@@ -15,6 +15,7 @@
 #include <phool/getClass.h>
 #include <g4main/PHG4TruthInfoContainer.h>
 #include <g4main/PHG4VtxPoint.h>
+#include <phool/PHTimer.h>
 #endif
 
 #include <Event/Event.h>
@@ -53,6 +54,10 @@ MbdEvent::MbdEvent(const int cal_pass, const bool proc_charge) :
   {
     do_templatefit = 1;
   }
+  if (rc->FlagExist("MBD_FASTFIT"))
+  {
+    _fastfit = rc->get_IntFlag("MBD_FASTFIT");
+  }
 #else
   do_templatefit = 0;
   _is_online = 1;
@@ -62,8 +67,13 @@ MbdEvent::MbdEvent(const int cal_pass, const bool proc_charge) :
   {
     // std::cout << PHWHERE << "Creating _mbdsig " << ifeech << std::endl;
     _mbdsig.emplace_back(ifeech, _nsamples);
+    _mbdsig.back().SetFastFit( _fastfit == 1 );
   }
 
+#ifndef ONLINE
+  _fit_timer = new PHTimer("MbdEvent channel fits");
+#endif
+
   std::string name;
   std::string title;
   for (int iarm = 0; iarm < 2; iarm++)
@@ -108,6 +118,9 @@ MbdEvent::~MbdEvent()
   delete _mbdgeom;
   delete _mbdcal;
   delete _syncttree;
+#ifndef ONLINE
+  delete _fit_timer;
+#endif
 }
 
 int MbdEvent::InitRun()
@@ -313,6 +326,24 @@ int MbdEvent::InitRun()
 int MbdEvent::End()
 {
   //std::cout << "MbdEvent::End()" << std::endl;
+#ifndef ONLINE
+  // waveform processing time, only of interest when comparing the fit methods
+  if ( _fastfit != 0 )
+  {
+    _fit_timer->print_stat();
+  }
+#endif
+  if ( _fastfit == 2 && _fastfit_ncomp > 0 )
+  {
+    double n = _fastfit_ncomp;
+    double mdt = _fastfit_sumdt / n;
+    double mdampl = _fastfit_sumdampl / n;
+    std::cout << "MbdEvent fast fit - TF1 fit, " << _fastfit_ncomp << " fits" << std::endl;
+    std::cout << "  time (samples): mean " << mdt << ", rms " << std::sqrt(std::max(_fastfit_sumdt2 / n - mdt * mdt, 0.))
+              << ", max " << _fastfit_maxdt << std::endl;
+    std::cout << "  ampl (relative): mean " << mdampl << ", rms " << std::sqrt(std::max(_fastfit_sumdampl2 / n - mdampl * mdampl, 0.)) << std::endl;
+  }
+
   if ( _calpass == 1 )
   {
     CalcSampMaxCalib();
@@ -360,6 +391,38 @@ int MbdEvent::End()
   return 1;
 }
 
+// Template fit of a channel with both the fast and the TF1 fit, keeps the TF1 values
+// and the differences between the two
+void MbdEvent::CompareFastFit(const int ifeech)
+{
+  MbdSig &sig = _mbdsig[ifeech];
+  sig.FitTemplateFast( _mbdcal->get_sampmax(ifeech) );
+  Double_t fast_ampl = sig.GetAmpl();
+  Double_t fast_time = sig.GetTime();
+
+  sig.FitTemplate( _mbdcal->get_sampmax(ifeech) );
+  Double_t ampl = sig.GetAmpl();
+  Double_t time = sig.GetTime();
+  if ( ampl == 0. || std::isnan(time) || std::isnan(fast_time) )
+  {
+    return;
+  }
+
+  double dt = fast_time - time;
+  double dampl = (fast_ampl - ampl) / ampl;
+
+  _fastfit_ncomp++;
+  _fastfit_sumdt += dt;
+  _fastfit_sumdt2 += dt * dt;
+  _fastfit_sumdampl += dampl;
+  _fastfit_sumdampl2 += dampl * dampl;
+  _fastfit_maxdt = std::max(_fastfit_maxdt, std::fabs(dt));
+  if ( _verbose && std::fabs(dt) > 0.1 )
+  {
+    std::cout << "fastfit " << m_evt << "\t" << ifeech << "\t" << time << "\t" << dt << "\t" << ampl << "\t" << dampl << std::endl;
+  }
+}
+
 ///
 void MbdEvent::Clear()
 {
@@ -644,6 +707,10 @@ int MbdEvent::ProcessRawPackets(MbdPmtContainer *bbcpmts)
   std::array<Double_t,MbdDefs::MBD_N_FEECH> tdc{0.};
   tdc.fill( 0. );
 
+#ifndef ONLINE
+  _fit_timer->restart();
+#endif
+
   for (int ifeech = 0; ifeech < MbdDefs::BBC_N_FEECH; ifeech++)
   {
     int pmtch = _mbdgeom->get_pmt(ifeech);
@@ -682,7 +749,18 @@ int MbdEvent::ProcessRawPackets(MbdPmtContainer *bbcpmts)
       if (do_templatefit)
       {
         //std::cout << "fittemplate" << std::endl;
-        _mbdsig[ifeech].FitTemplate( _mbdcal->get_sampmax(ifeech) );
+        if ( _fastfit == 1 )
+        {
+          _mbdsig[ifeech].FitTemplateFast( _mbdcal->get_sampmax(ifeech) );
+        }
+        else if ( _fastfit == 2 )
+        {
+          CompareFastFit( ifeech );  // TF1 fit values are used
+        }
+        else
+        {
+          _mbdsig[ifeech].FitTemplate( _mbdcal->get_sampmax(ifeech) );
+        }
 
         if ( _verbose )
         {
@@ -749,6 +827,10 @@ int MbdEvent::ProcessRawPackets(MbdPmtContainer *bbcpmts)
 
   }
 
+#ifndef ONLINE
+  _fit_timer->stop();
+#endif
+
   // bbcpmts->Reset();
   //std::cout << "q10 " << bbcpmts->get_tower_at_channel(10)->get_q() << std::endl;
 
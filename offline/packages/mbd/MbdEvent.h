@@ -30,6 +30,7 @@ class CaloPacketContainer;
 class Gl1Packet;
 class PHG4TruthInfoContainer;
 class PHG4VtxPoint;
+class PHTimer;
 #endif
 
 class MbdEvent
@@ -95,6 +96,7 @@ class MbdEvent
   //int DoQuickClockOffsetCalib();
 
   bool isbadtch(const int ipmtch);
+  void CompareFastFit(const int ifeech);
 
   // Debugging variables
   int _debug{0};
@@ -143,6 +145,18 @@ class MbdEvent
   Float_t m_pmttq[MbdDefs::MBD_N_PMT]{};  // time in each arm
 
   int do_templatefit{1};
+  int _fastfit{0};  // 0 = TF1 template fit, 1 = fast fit, 2 = TF1 fit and compare with fast fit
+
+  // fast fit agreement with the TF1 fit, and waveform processing time
+  unsigned int _fastfit_ncomp{0};
+  double _fastfit_sumdt{0.};
+  double _fastfit_sumdt2{0.};
+  double _fastfit_sumdampl{0.};
+  double _fastfit_sumdampl2{0.};
+  double _fastfit_maxdt{0.};
+#ifndef ONLINE
+  PHTimer *_fit_timer{nullptr};
+#endif
 
   // output data
   Short_t m_bbcn[2]{};                                            // num hits for each arm (north and south)
@@ -175,8 +175,11 @@ void MbdSig::SetY(const Float_t* y, const int invert)
   f_ampl = -9999.;
   f_time = -9999.;
 
+  _x.resize(_nsamples);
+  _rawy.assign(y, y + _nsamples);
   for (int isamp = 0; isamp < _nsamples; isamp++)
   {
+    _x[isamp] = isamp;
     hRawPulse->SetBinContent(isamp + 1, y[isamp]);
     gRawPulse->SetPoint(isamp, Double_t(isamp), y[isamp]);
   }
@@ -203,13 +206,12 @@ void MbdSig::SetY(const Float_t* y, const int invert)
       ispileup = CalcEventPed0_PreSamp(ped_presamp, ped_presamp_nsamps);
     }
 
+    _suby.resize(_nsamples);
     for (int isamp = 0; isamp < _nsamples; isamp++)
     {
-      hSubPulse->SetBinContent(isamp + 1, invert * (y[isamp] - ped0));
-      hSubPulse->SetBinError(isamp + 1, ped0rms);
-      gSubPulse->SetPoint(isamp, (Double_t) isamp, invert * (y[isamp] - ped0));
-      gSubPulse->SetPointError(isamp, 0., ped0rms);
+      _suby[isamp] = invert * (y[isamp] - ped0);
     }
+    FillSubGraph();
 
     if ( ispileup==1 && !std::isnan(_pileup_p0) )
     {
@@ -228,8 +230,6 @@ void MbdSig::SetXY(const Float_t* x, const Float_t* y, const int invert)
     Init();
   }
 
-  hRawPulse->Reset();
-  hSubPulse->Reset();
   _status = 0;
 
   f_ampl = -9999.;
@@ -238,19 +238,24 @@ void MbdSig::SetXY(const Float_t* x, const Float_t* y, const int invert)
   // std::cout << "_nsamples " << _nsamples << std::endl;
   // std::cout << "use_ped0 " << use_ped0 << "\t" << ped0 << std::endl;
 
-  for (int isamp = 0; isamp < _nsamples; isamp++)
-  {
-    // std::cout << "aaa\t" << isamp << "\t" << x[isamp] << "\t" << y[isamp] << std::endl;
-    hRawPulse->SetBinContent(isamp + 1, y[isamp]);
-    gRawPulse->SetPoint(isamp, x[isamp], y[isamp]);
-    gRawPulse->SetPointError(isamp, 0, 4.0);
-  }
-  if ( _verbose && _ch==9 )
+  _x.assign(x, x + _nsamples);
+  _rawy.assign(y, y + _nsamples);
+
+  // in fast fit mode the waveform is only kept in the sample arrays,
+  // the hists and graphs are filled when they are asked for
+  if ( _fastfit == 0 )
   {
-    gRawPulse->Draw("ap");
-    gRawPulse->GetHistogram()->SetTitle(gRawPulse->GetName());
-    gPad->SetGridy(1);
-    PadUpdate();
+    hRawPulse->Reset();
+    hSubPulse->Reset();
+    FillRawGraph();
+
+    if ( _verbose && _ch==9 )
+    {
+      gRawPulse->Draw("ap");
+      gRawPulse->GetHistogram()->SetTitle(gRawPulse->GetName());
+      gPad->SetGridy(1);
+      PadUpdate();
+    }
   }
 
   if (use_ped0 != 0 || minped0samp >= 0 || minped0x != maxped0x || ped_presamp != 0)
@@ -272,16 +277,18 @@ void MbdSig::SetXY(const Float_t* x, const Float_t* y, const int invert)
       ispileup = CalcEventPed0_PreSamp(ped_presamp, ped_presamp_nsamps);
     }
 
+    _suby.resize(_nsamples);
     for (int isamp = 0; isamp < _nsamples; isamp++)
     {
       if ( _verbose && isamp==(_nsamples-1) )
       {
         std::cout << "bbb ch " << _ch << "\t" << isamp << "\t" << x[isamp] << "\t" << invert*(y[isamp]-ped0) << std::endl;
       }
-      hSubPulse->SetBinContent(isamp + 1, invert * (y[isamp] - ped0));
-      hSubPulse->SetBinError(isamp + 1, ped0rms);
-      gSubPulse->SetPoint(isamp, x[isamp], invert * (y[isamp] - ped0));
-      gSubPulse->SetPointError(isamp, 0., ped0rms);
+      _suby[isamp] = invert * (y[isamp] - ped0);
+    }
+    if ( _fastfit == 0 )
+    {
+      FillSubGraph();
     }
 
     if ( ispileup==1 )
@@ -300,6 +307,41 @@ void MbdSig::SetXY(const Float_t* x, const Float_t* y, const int invert)
   _verbose = 0;
 }
 
+void MbdSig::FillRawGraph()
+{
+  for (size_t isamp = 0; isamp < _rawy.size(); isamp++)
+  {
+    hRawPulse->SetBinContent(isamp + 1, _rawy[isamp]);
+    gRawPulse->SetPoint(isamp, _x[isamp], _rawy[isamp]);
+    gRawPulse->SetPointError(isamp, 0, 4.0);
+  }
+}
+
+void MbdSig::FillSubGraph()
+{
+  for (size_t isamp = 0; isamp < _suby.size(); isamp++)
+  {
+    hSubPulse->SetBinContent(isamp + 1, _suby[isamp]);
+    hSubPulse->SetBinError(isamp + 1, ped0rms);
+    gSubPulse->SetPoint(isamp, _x[isamp], _suby[isamp]);
+    gSubPulse->SetPointError(isamp, 0., ped0rms);
+  }
+}
+
+void MbdSig::FillGraphs()
+{
+  // only needed in fast fit mode, otherwise they are filled in SetXY()
+  if ( _fastfit == 0 || hRawPulse == nullptr )
+  {
+    return;
+  }
+
+  hRawPulse->Reset();
+  hSubPulse->Reset();
+  FillRawGraph();
+  FillSubGraph();
+}
+
 void MbdSig::Remove_Pileup()
 {
   //_verbose = 100;
@@ -307,15 +349,11 @@ void MbdSig::Remove_Pileup()
 
   if ( (_ch/8)%2 == 0 )   // time ch
   {
-    float offset = _pileup_p0*gSubPulse->GetPointY(0);
+    float offset = _pileup_p0*_suby[0];
 
     for (int isamp = 0; isamp < _nsamples; isamp++)
     {
-      double x = gSubPulse->GetPointX(isamp);
-      double y = gSubPulse->GetPointY(isamp);
-
-      hSubPulse->SetBinContent( isamp + 1, y - offset );
-      gSubPulse->SetPoint( isamp, x, y - offset );
+      _suby[isamp] -= offset;
     }
   }
   else
@@ -328,7 +366,13 @@ void MbdSig::Remove_Pileup()
     }
 
     fit_pileup->SetRange(-0.1,4.1);
-    fit_pileup->SetParameters( _pileup_p0*gSubPulse->GetPointY(0), _pileup_p1, _pileup_p2 );
+    fit_pileup->SetParameters( _pileup_p0*_suby[0], _pileup_p1, _pileup_p2 );
+
+    // the tail fit needs the graph, even in fast fit mode
+    if ( _fastfit != 0 )
+    {
+      FillSubGraph();
+    }
     
     if ( _verbose )
     {
@@ -344,16 +388,15 @@ void MbdSig::Remove_Pileup()
 
       double bkg = fit_pileup->Eval(isamp);
 
-      double x = gSubPulse->GetPointX(isamp);
-      double y = gSubPulse->GetPointY(isamp);
-
-      float newval = static_cast<float>( y - bkg );
-
-      hSubPulse->SetBinContent( isamp + 1, newval );
-      gSubPulse->SetPoint( isamp, x, newval );
+      _suby[isamp] = static_cast<float>( _suby[isamp] - bkg );
     }
   }
 
+  if ( _fastfit == 0 )
+  {
+    FillSubGraph();
+  }
+
   if ( _verbose )
   {
     gSubPulse->Draw("ap");
@@ -365,13 +408,13 @@ void MbdSig::Remove_Pileup()
 
 Double_t MbdSig::GetSplineAmpl()
 {
-  if (gSubPulse == nullptr)
+  if (_suby.empty())
   {
-    std::cout << "gsub bad " << (uint64_t) gSubPulse << std::endl;
+    std::cout << "gsub bad, no samples" << std::endl;
     return 0.;
   }
 
-  TSpline3 s3("s3", gSubPulse);
+  TSpline3 s3("s3", _x.data(), _suby.data(), _suby.size());
 
   // First find maximum, to rescale
   f_ampl = -999999.;
@@ -393,11 +436,9 @@ void MbdSig::WritePedHist()
 
 void MbdSig::FillPed0(const Int_t sampmin, const Int_t sampmax)
 {
-  Double_t x;
-  Double_t y;
   for (int isamp = sampmin; isamp <= sampmax; isamp++)
   {
-    gRawPulse->GetPoint(isamp, x, y);
+    Double_t y = _rawy[isamp];
     // gRawPulse->Print("all");
     hPed0->Fill(y);
 
@@ -415,12 +456,11 @@ void MbdSig::FillPed0(const Int_t sampmin, const Int_t sampmax)
 
 void MbdSig::FillPed0(const Double_t begin, const Double_t end)
 {
-  Double_t x;
-  Double_t y;
-  Int_t n = gRawPulse->GetN();
+  Int_t n = _rawy.size();
   for (int isamp = 0; isamp < n; isamp++)
   {
-    gRawPulse->GetPoint(isamp, x, y);
+    Double_t x = _x[isamp];
+    Double_t y = _rawy[isamp];
     if (x >= begin && x <= end)
     {
       hPed0->Fill(y);
@@ -458,11 +498,9 @@ void MbdSig::CalcEventPed0(const Int_t minpedsamp, const Int_t maxpedsamp)
   // if (_ch==8) std::cout << "In MbdSig::CalcEventPed0(int,int)" << std::endl;
   hPedEvt->Reset();
 
-  Double_t x;
-  Double_t y;
   for (int isamp = minpedsamp; isamp <= maxpedsamp; isamp++)
   {
-    gRawPulse->GetPoint(isamp, x, y);
+    Double_t y = _rawy[isamp];
 
     hPed0->Fill(y);
     hPedEvt->Fill(y);
@@ -484,13 +522,12 @@ void MbdSig::CalcEventPed0(const Double_t minpedx, const Double_t maxpedx)
 {
   hPedEvt->Reset();
 
-  Double_t x;
-  Double_t y;
-  Int_t n = gRawPulse->GetN();
+  Int_t n = _rawy.size();
 
   for (int isamp = 0; isamp < n; isamp++)
   {
-    gRawPulse->GetPoint(isamp, x, y);
+    Double_t x = _x[isamp];
+    Double_t y = _rawy[isamp];
 
     if (x >= minpedx && x <= maxpedx)
     {
@@ -522,7 +559,7 @@ int MbdSig::CalcEventPed0_PreSamp(const int presample, const int nsamps)
   Long64_t max = ped_presamp_maxsamp;
 
   // actual max from event
-  Long64_t actual_max = TMath::LocMax(gRawPulse->GetN(), gRawPulse->GetY());
+  Long64_t actual_max = TMath::LocMax(_rawy.size(), _rawy.data());
 
   if ( ped_presamp_maxsamp == -1 ) // if there is no maxsamp set, use the max found in this event
   {
@@ -568,56 +605,81 @@ int MbdSig::CalcEventPed0_PreSamp(const int presample, const int nsamps)
     rms = 5.0;
   }
 
-  ped_fcn->SetRange(minsamp-0.1,maxsamp+0.1);
-  ped_fcn->SetParameter(0,1500.);
-
-  if ( gRawPulse->GetN()==0 )//chiu
+  if ( _rawy.empty() )//chiu
   {
     std::cout << PHWHERE << " gRawPulse 0" << std::endl;
   }
 
-  if ( _verbose )
-  {
-    gRawPulse->Fit( ped_fcn, "RQ" );
+  double pedmean = 0.;
+  double chi2 = 0.;
+  double ndf = 0.;
 
-    double chi2ndf = ped_fcn->GetChisquare()/ped_fcn->GetNDF();
-    if ( chi2ndf > 4.0 )
+  if ( _fastfit != 0 )
+  {
+    // the constant fit below is just the mean of the samples (all errors are 4.0)
+    int npts = 0;
+    for (int isamp = minsamp; isamp <= maxsamp && isamp < static_cast<int>(_rawy.size()); isamp++)
     {
-      gRawPulse->Draw("ap");
-      ped_fcn->Draw("same");
-      PadUpdate();
+      pedmean += _rawy[isamp];
+      npts++;
+    }
+    if ( npts > 0 )
+    {
+      pedmean /= npts;
+    }
+    for (int isamp = minsamp; isamp < minsamp + npts; isamp++)
+    {
+      chi2 += (_rawy[isamp] - pedmean) * (_rawy[isamp] - pedmean) / 16.;
     }
+    ndf = std::max(npts - 1, 0);
   }
   else
   {
-    //std::cout << PHWHERE << std::endl;
-    gRawPulse->Fit( ped_fcn, "RNQ" );
+    ped_fcn->SetRange(minsamp-0.1,maxsamp+0.1);
+    ped_fcn->SetParameter(0,1500.);
 
-    double chi2ndf = ped_fcn->GetChisquare()/ped_fcn->GetNDF();
-    if ( _pileupfile != nullptr && chi2ndf > 4.0 )
+    if ( _verbose )
     {
-      *_pileupfile << "ped " << _ch << " mean " << mean << "\t";
-      for ( int i=0; i<gRawPulse->GetN(); i++)
+      gRawPulse->Fit( ped_fcn, "RQ" );
+
+      double chi2ndf = ped_fcn->GetChisquare()/ped_fcn->GetNDF();
+      if ( chi2ndf > 4.0 )
       {
-        *_pileupfile << std::setw(6) << gRawPulse->GetPointY(i);
+        gRawPulse->Draw("ap");
+        ped_fcn->Draw("same");
+        PadUpdate();
       }
-      *_pileupfile << std::endl;
     }
-  }
+    else
+    {
+      //std::cout << PHWHERE << std::endl;
+      gRawPulse->Fit( ped_fcn, "RNQ" );
 
-  double chi2 = ped_fcn->GetChisquare();
-  double ndf = ped_fcn->GetNDF();
+      double chi2ndf = ped_fcn->GetChisquare()/ped_fcn->GetNDF();
+      if ( _pileupfile != nullptr && chi2ndf > 4.0 )
+      {
+        *_pileupfile << "ped " << _ch << " mean " << mean << "\t";
+        for ( int i=0; i<gRawPulse->GetN(); i++)
+        {
+          *_pileupfile << std::setw(6) << gRawPulse->GetPointY(i);
+        }
+        *_pileupfile << std::endl;
+      }
+    }
+
+    pedmean = ped_fcn->GetParameter(0);
+    chi2 = ped_fcn->GetChisquare();
+    ndf = ped_fcn->GetNDF();
+  }
 
   if ( chi2/ndf < 4.0 )
   {
-    mean = ped_fcn->GetParameter(0);
-
-    Double_t x;
-    Double_t y;
+    mean = pedmean;
 
     for (int isamp = minsamp; isamp <= maxsamp; isamp++)
     {
-      gRawPulse->GetPoint(isamp, x, y);
+      Double_t x = _x[isamp];
+      Double_t y = _rawy[isamp];
 
       // exclude outliers
       if ( fabs(y-mean) < 4.0*rms )
@@ -686,9 +748,9 @@ Double_t MbdSig::LeadingEdge(const Double_t threshold)
   // Find first point above threshold
   // We also make sure the next point is above threshold
   // to get rid of a high fluctuation
-  int n = gSubPulse->GetN();
-  Double_t* x = gSubPulse->GetX();
-  Double_t* y = gSubPulse->GetY();
+  int n = _suby.size();
+  const Double_t* x = _x.data();
+  const Double_t* y = _suby.data();
 
   int sample = -1;
   for (int isamp = 0; isamp < n; isamp++)
@@ -722,9 +784,9 @@ Double_t MbdSig::dCFD(const Double_t fraction_threshold)
   // Find first point above threshold
   // We also make sure the next point is above threshold
   // to get rid of a high fluctuation
-  int n = gSubPulse->GetN();
-  Double_t* x = gSubPulse->GetX();
-  Double_t* y = gSubPulse->GetY();
+  int n = _suby.size();
+  const Double_t* x = _x.data();
+  const Double_t* y = _suby.data();
 
   // Get max amplitude
   Double_t ymax = TMath::MaxElement(n, y);
@@ -767,17 +829,15 @@ Double_t MbdSig::MBDTDC(const Int_t max_samp)
 {
   // Get the amplitude of a fixed sample (max_samp) to get time
   // Used in MBD Time Channels
-  Double_t* y = gSubPulse->GetY();
-
-  if (y == nullptr)
+  if (_suby.empty())
   {
     std::cout << "ERROR y == 0" << std::endl;
     return std::numeric_limits<Double_t>::quiet_NaN();
   }
 
-  f_time = y[max_samp];
+  f_time = _suby[max_samp];
 
-  if ( y[2]>100. )
+  if ( _suby[2]>100. )
   {
     f_time = 0.;
   }
@@ -795,9 +855,9 @@ Double_t MbdSig::MBDTDC(const Int_t max_samp)
 
 Double_t MbdSig::Integral(const Double_t xmin, const Double_t xmax)
 {
-  Int_t n = gSubPulse->GetN();
-  Double_t* x = gSubPulse->GetX();
-  Double_t* y = gSubPulse->GetY();
+  Int_t n = _suby.size();
+  const Double_t* x = _x.data();
+  const Double_t* y = _suby.data();
 
   f_integral = 0.;
   for (int ix = 0; ix < n; ix++)
@@ -824,9 +884,9 @@ void MbdSig::LocMax(Double_t& x_at_max, Double_t& ymax, Double_t xminrange, Doub
   }
 
   // Find index of maximum peak
-  Int_t n = gSubPulse->GetN();
-  Double_t* x = gSubPulse->GetX();
-  Double_t* y = gSubPulse->GetY();
+  Int_t n = _suby.size();
+  const Double_t* x = _x.data();
+  const Double_t* y = _suby.data();
 
   // if flipped or equal, we search the whole range
   if (xmaxrange <= xminrange)
@@ -869,9 +929,9 @@ void MbdSig::LocMax(Double_t& x_at_max, Double_t& ymax, Double_t xminrange, Doub
 void MbdSig::LocMin(Double_t& x_at_min, Double_t& ymin, Double_t xminrange, Double_t xmaxrange)
 {
   // Find index of minimum peak (for neg signals)
-  Int_t n = gSubPulse->GetN();
-  Double_t* x = gSubPulse->GetX();
-  Double_t* y = gSubPulse->GetY();
+  Int_t n = _suby.size();
+  const Double_t* x = _x.data();
+  const Double_t* y = _suby.data();
 
   // if flipped or equal, we search the whole range
   if (xmaxrange <= xminrange)
@@ -907,6 +967,8 @@ void MbdSig::LocMin(Double_t& x_at_min, Double_t& ymin, Double_t xminrange, Doub
 
 void MbdSig::Print()
 {
+  FillGraphs();
+
   Double_t x;
   Double_t y;
   std::cout << "CH " << _ch << std::endl;
@@ -925,6 +987,7 @@ void MbdSig::DrawWaveform()
     _verbose = 6;
   }
 
+  FillGraphs();
   gSubPulse->Draw("ap");
   gSubPulse->GetHistogram()->SetTitle(gSubPulse->GetName());
   gPad->SetGridy(1);
@@ -1263,6 +1326,220 @@ int MbdSig::FitTemplate( const Int_t sampmax )
   return 1;
 }
 
+bool MbdSig::TemplateValue(const Double_t xx, Double_t& val, Double_t& slope) const
+{
+  // the same table lookup and point rejection as TemplateFcn
+  if (xx < template_begintime || xx > template_endtime || std::isnan(xx))
+  {
+    return false;
+  }
+
+  Double_t step = (template_endtime - template_begintime) / (template_npointsx - 1);
+  Double_t index = (xx - template_begintime) / step;
+  int ilow = TMath::FloorNint(index);
+  int ihigh = TMath::CeilNint(index);
+  if (ilow < 0)
+  {
+    ilow = 0;
+  }
+  else if (ihigh >= template_npointsx)
+  {
+    ihigh = template_npointsx - 1;
+  }
+
+  if (template_yrms[ilow] >= 1.0 || template_yrms[ihigh] >= 1.0)
+  {
+    return false;
+  }
+
+  int islope = std::min(ilow, static_cast<int>(template_slope.size()) - 1);
+  slope = template_slope[islope];
+  if (ilow == ihigh)
+  {
+    val = template_y[ilow];
+  }
+  else
+  {
+    Double_t x0 = template_begintime + ilow * step;
+    val = template_y[ilow] + slope * (xx - x0);
+  }
+
+  return true;
+}
+
+void MbdSig::FastFit(const Double_t* x, const Double_t* y, const std::vector<char>& use, const Double_t xmin, const Double_t xmax,
+                     Double_t& ampl, Double_t& time) const
+{
+  const int maxiter = 20;
+  const int n = use.size();
+
+  // chi2 (all errors are the same) and the normal equations of the linearized model at (a, t)
+  auto linearize = [&](const Double_t a, const Double_t t, Double_t* sums) -> Double_t
+  {
+    std::fill(sums, sums + 5, 0.);
+    Double_t chi2 = 0.;
+    int npts = 0;
+    for (int i = 0; i < n; i++)
+    {
+      Double_t val;
+      Double_t slope;
+      if (!use[i] || x[i] < xmin || x[i] > xmax || !TemplateValue(x[i] - t, val, slope))
+      {
+        continue;
+      }
+      Double_t dfdt = -a * slope;
+      Double_t resid = y[i] - a * val;
+      sums[0] += val * val;
+      sums[1] += val * dfdt;
+      sums[2] += dfdt * dfdt;
+      sums[3] += resid * val;
+      sums[4] += resid * dfdt;
+      chi2 += resid * resid;
+      npts++;
+    }
+    return npts >= 2 ? chi2 : std::numeric_limits<Double_t>::infinity();
+  };
+
+  Double_t sums[5];
+  Double_t chi2 = linearize(ampl, time, sums);
+  if (std::isinf(chi2))
+  {
+    return;
+  }
+
+  for (int iter = 0; iter < maxiter; iter++)
+  {
+    Double_t det = sums[0] * sums[2] - sums[1] * sums[1];
+    if (det <= 0.)
+    {
+      break;
+    }
+    Double_t da = (sums[2] * sums[3] - sums[1] * sums[4]) / det;
+    Double_t dt = (sums[0] * sums[4] - sums[1] * sums[3]) / det;
+
+    // halve the step until chi2 goes down
+    Double_t newsums[5];
+    Double_t newchi2 = std::numeric_limits<Double_t>::infinity();
+    for (int ihalf = 0; ihalf < 6; ihalf++)
+    {
+      newchi2 = linearize(ampl + da, time + dt, newsums);
+      if (newchi2 <= chi2)
+      {
+        break;
+      }
+      da *= 0.5;
+      dt *= 0.5;
+    }
+    if (newchi2 > chi2)
+    {
+      break;
+    }
+
+    ampl += da;
+    time += dt;
+    chi2 = newchi2;
+    std::copy(newsums, newsums + 5, sums);
+
+    if (std::fabs(dt) < 1e-5 && std::fabs(da) <= 1e-6 * std::fabs(ampl))
+    {
+      break;
+    }
+  }
+}
+
+// sampmax>0 means fit to the peak near sampmax
+int MbdSig::FitTemplateFast(const Int_t sampmax)
+{
+  Int_t n = _suby.size();
+  if (n == 0)
+  {
+    f_ampl = 0.;
+    f_time = std::numeric_limits<Float_t>::quiet_NaN();
+    std::cout << "ERROR, no samples" << std::endl;
+    return 1;
+  }
+
+  const Double_t* x = _x.data();
+  const Double_t* y = _suby.data();
+
+  // Determine if channel is saturated, saturated samples are not used in the fit
+  const Double_t* rawsamps = _rawy.data();
+  Int_t nrawsamps = _rawy.size();
+  int nsaturated = 0;
+  for (int ipt = 0; ipt < nrawsamps; ipt++)
+  {
+    if (rawsamps[ipt] > 16370.)
+    {
+      nsaturated++;
+    }
+  }
+
+  std::vector<char> use(n, 1);
+  for (int ipt = 0; ipt < n; ipt++)
+  {
+    int samp_point = static_cast<int>(x[ipt]);
+    if (samp_point >= 0 && samp_point < nrawsamps && rawsamps[samp_point] > 16370.)
+    {
+      use[ipt] = 0;
+    }
+  }
+
+  // Get x and y of maximum
+  Double_t x_at_max{-1.};
+  Double_t ymax{0.};
+  if (sampmax >= 0)
+  {
+    if (sampmax < n)
+    {
+      x_at_max = x[sampmax];
+      ymax = y[sampmax];
+    }
+    if (nsaturated <= 3)
+    {
+      x_at_max -= 2.0;
+    }
+    else
+    {
+      x_at_max -= 1.5;
+      ymax = 16370. + nsaturated * 2000.;
+    }
+  }
+  else
+  {
+    ymax = TMath::MaxElement(n, y);
+    x_at_max = TMath::LocMax(n, y);
+  }
+
+  // Threshold cut
+  if (ymax < 20.)
+  {
+    f_ampl = 0.;
+    f_time = std::numeric_limits<Float_t>::quiet_NaN();
+    return 1;
+  }
+
+  Double_t ampl = ymax;
+  Double_t time = x_at_max;
+  FastFit(x, y, use, 0., (nsaturated <= 3 ? _nsamples : sampmax + nsaturated - 0.5), ampl, time);
+  if (time < 0. || time > _nsamples)
+  {
+    time = _nsamples * 0.5;  // bad fit last time
+  }
+
+  // refit with new range to exclude after-pulses
+  FastFit(x, y, use, 0., (nsaturated <= 3 ? time + 4.0 : time + nsaturated + 0.8), ampl, time);
+
+  f_ampl = ampl;
+  f_time = time;
+
+  if (_verbose > 0)
+  {
+    std::cout << "FitTemplateFast " << _ch << "\t" << f_ampl << "\t" << f_time << std::endl;
+  }
+
+  return 1;
+}
+
 int MbdSig::SetTemplate(const std::vector<float>& shape, const std::vector<float>& sherr)
 {
   template_y = shape;
@@ -1303,5 +1580,13 @@ int MbdSig::SetTemplate(const std::vector<float>& shape, const std::vector<float
     }
   }
 
+  // slopes of the linear interpolation, used by the fast fit
+  template_slope.resize(std::max(template_npointsx - 1, 1), 0.f);
+  Double_t step = (template_endtime - template_begintime) / (template_npointsx - 1);
+  for (int i = 0; i < template_npointsx - 1 && i + 1 < static_cast<int>(template_y.size()); i++)
+  {
+    template_slope[i] = (template_y[i + 1] - template_y[i]) / step;
+  }
+
   return 1;
 }
@@ -34,8 +34,20 @@ class MbdSig
 
   void SetCalib(MbdCalib *mcal);
 
-  TH1 *GetHist() { return hpulse; }
-  TGraphErrors *GetGraph() { return gpulse; }
+  /** Fast fit mode, the waveform is only kept in the sample arrays and the
+      hists and graphs are filled when they are asked for */
+  void SetFastFit(const int f) { _fastfit = f; }
+
+  TH1 *GetHist()
+  {
+    FillGraphs();
+    return hpulse;
+  }
+  TGraphErrors *GetGraph()
+  {
+    FillGraphs();
+    return gpulse;
+  }
   Double_t GetAmpl() { return f_ampl; }
   Double_t GetTime() { return f_time; }
   Double_t GetIntegral() { return f_integral; }
@@ -99,6 +111,10 @@ class MbdSig
 
   /** Use template fit to get ampl and time */
   Int_t FitTemplate(const Int_t sampmax = -1);
+
+  /** Same fit as FitTemplate, but done directly on the sample arrays with a Gauss-Newton
+      solve on the template table instead of a TF1 fit */
+  Int_t FitTemplateFast(const Int_t sampmax = -1);
   // Double_t Ampl() { return f_ampl; }
   // Double_t Time() { return f_time; }
 
@@ -122,6 +138,18 @@ class MbdSig
  private:
   void Init();
 
+  /** fill the hists and graphs from the sample arrays */
+  void FillRawGraph();
+  void FillSubGraph();
+  void FillGraphs();
+
+  /** template value and slope at xx (time relative to pulse start), false if the point is rejected as in TemplateFcn */
+  bool TemplateValue(const Double_t xx, Double_t &val, Double_t &slope) const;
+
+  /** least squares fit of ampl*template(x-time) to the unrejected points with xmin <= x <= xmax */
+  void FastFit(const Double_t *x, const Double_t *y, const std::vector<char> &use, const Double_t xmin, const Double_t xmax,
+               Double_t &ampl, Double_t &time) const;
+
   int _ch;
   int _nsamples;
   int _status{0};
@@ -149,6 +177,12 @@ class MbdSig
   TGraphErrors *gSubPulse{nullptr};  //!
   TGraphErrors *gpulse{nullptr};     //!
 
+  /** the waveform, as the sample arrays */
+  std::vector<Double_t> _x;          //! sample x
+  std::vector<Double_t> _rawy;       //! raw adc
+  std::vector<Double_t> _suby;       //! pedestal subtracted adc
+  int _fastfit{0};                   //! only the sample arrays are filled in SetXY()
+
   /** for CalcPed0 */
   //std::unique_ptr<MbdRunningStats> ped0stats{nullptr};    //!
   MbdRunningStats *ped0stats{nullptr};    //!
@@ -186,6 +220,7 @@ class MbdSig
   // Double_t template_max_xrange{0.};             //! for template, in original units of waveform data
   std::vector<float> template_y;
   std::vector<float> template_yrms;
+  std::vector<float> template_slope;  // slope between neighbouring template points, for the fast fit
   TF1 *template_fcn{nullptr};
   Double_t fit_min_time{};  //! min time for fit, in original units of waveform data
   Double_t fit_max_time{};  //! max time for fit, in original units of waveform data
@@ -0,0 +1,218 @@
+#include "Fun4AllRNTupleInputManager.h"
+
+#include "Fun4AllRNTupleOutputManager.h"
+#include "RNTupleNodeMapper.h"
+
+#include <fun4all/Fun4AllServer.h>
+
+#include <frog/FROG.h>
+
+#include <phool/PHCompositeNode.h>
+#include <phool/PHTimer.h>
+#include <phool/phool.h>  // for PHWHERE
+
+#include <ROOT/RNTupleReader.hxx>
+
+#include <TFile.h>
+#include <TNamed.h>
+
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+Fun4AllRNTupleInputManager::Fun4AllRNTupleInputManager(const std::string &name, const std::string &nodename, const std::string &topnodename)
+  : Fun4AllInputManager(name, nodename, topnodename)
+  , m_Timer(new PHTimer("RNTupleInput"))
+{
+  return;
+}
+
+Fun4AllRNTupleInputManager::~Fun4AllRNTupleInputManager()
+{
+  if (IsOpen())
+  {
+    fileclose();
+  }
+  delete m_Timer;
+}
+
+int Fun4AllRNTupleInputManager::fileopen(const std::string &filenam)
+{
+  if (IsOpen())
+  {
+    std::cout << "Closing currently open file "
+              << FileName()
+              << " and opening " << filenam << std::endl;
+    fileclose();
+  }
+  FileName(filenam);
+  FROG frog;
+  std::string fullfilename = frog.location(FileName());
+  if (Verbosity() > 0)
+  {
+    std::cout << Name() << ": opening file " << fullfilename << std::endl;
+  }
+  m_File.reset(TFile::Open(fullfilename.c_str(), "READ"));
+  if (!m_File || m_File->IsZombie())
+  {
+    std::cout << PHWHERE << ": " << Name() << " Could not open file "
+              << FileName() << std::endl;
+    m_File.reset();
+    return -1;
+  }
+  TNamed *nodelist = m_File->Get<TNamed>(Fun4AllRNTupleOutputManager::NodeListName);
+  if (!nodelist)
+  {
+    std::cout << PHWHERE << ": " << Name() << " no node list in "
+              << FileName() << ", not an RNTuple DST" << std::endl;
+    m_File.reset();
+    return -1;
+  }
+
+  m_Reader = ROOT::Experimental::RNTupleReader::Open(Fun4AllRNTupleOutputManager::NTupleName, fullfilename);
+  m_NEntries = m_Reader->GetNEntries();
+  m_Entry = 0;
+
+  Fun4AllServer *se = Fun4AllServer::instance();
+  dstNode = se->getNode(InputNode(), TopNodeName());
+  m_Mappers.clear();
+  std::istringstream nodes(nodelist->GetTitle());
+  std::string line;
+  while (std::getline(nodes, line))
+  {
+    std::istringstream fields(line);
+    std::string nodename;
+    std::string type;
+    if (!(fields >> nodename >> type))
+    {
+      continue;
+    }
+    std::string config;
+    std::getline(fields >> std::ws, config);
+    auto mapper = RNTupleNodeMapper::Create(type, nodename);
+    if (!mapper)
+    {
+      std::cout << PHWHERE << Name() << ": Node " << nodename
+                << " of unknown type " << type << " is skipped" << std::endl;
+      continue;
+    }
+    mapper->Config(config);
+    mapper->ConnectFields(*m_Reader);
+    mapper->CreateNode(dstNode);
+    m_Mappers.push_back(std::move(mapper));
+  }
+  delete nodelist;
+  IsOpen(1);
+  AddToFileOpened(FileName());  // add file to the list of files which were opened
+  return 0;
+}
+
+int Fun4AllRNTupleInputManager::run(const int nevents)
+{
+  if (!IsOpen())
+  {
+    if (FileListEmpty())
+    {
+      if (Verbosity() > 0)
+      {
+        std::cout << Name() << ": No Input file open" << std::endl;
+      }
+      return -1;
+    }
+
+    if (OpenNextFile())
+    {
+      std::cout << Name() << ": No Input file from filelist opened" << std::endl;
+      return -1;
+    }
+  }
+  if (Verbosity() > 3)
+  {
+    std::cout << "Getting Event from " << Name() << std::endl;
+  }
+  // skip nevents-1 entries like the dst input manager does
+  const std::uint64_t nread = (nevents > 0) ? nevents : 1;
+  while (m_Entry + nread > m_NEntries)
+  {
+    fileclose();
+    if (OpenNextFile())
+    {
+      return -1;
+    }
+  }
+  m_Entry += nread - 1;
+  m_Timer->restart();
+  for (auto &mapper : m_Mappers)
+  {
+    mapper->Read(dstNode, m_Entry);
+  }
+  m_Timer->stop();
+  m_ReadTime += m_Timer->elapsed();
+  m_Entry++;
+  events_total += nread;
+  // check if the local SubsysReco discards this event
+  if (RejectEvent() != Fun4AllReturnCodes::EVENT_OK)
+  {
+    return run(nevents);
+  }
+  return 0;
+}
+
+int Fun4AllRNTupleInputManager::fileclose()
+{
+  if (!IsOpen())
+  {
+    std::cout << Name() << ": fileclose: No Input file open" << std::endl;
+    return -1;
+  }
+  if (Verbosity() > 0)
+  {
+    std::cout << Name() << ": read " << m_Entry << " of " << m_NEntries << " entries from " << FileName();
+    if (m_Entry > 0)
+    {
+      std::cout << ", " << m_ReadTime / m_Entry << " ms/event";
+    }
+    std::cout << std::endl;
+  }
+  m_Reader.reset();
+  m_File.reset();
+  m_Mappers.clear();
+  m_ReadTime = 0;
+  IsOpen(0);
+  UpdateFileList();
+  return 0;
+}
+
+int Fun4AllRNTupleInputManager::PushBackEvents(const int i)
+{
+  if (!IsOpen())
+  {
+    return -1;
+  }
+  // positive i: go back i entries, negative i: skip -i entries
+  if (i > 0 && static_cast<std::uint64_t>(i) > m_Entry)
+  {
+    std::cout << PHWHERE << Name() << ": cannot push back " << i
+              << " events, only " << m_Entry << " read from this file" << std::endl;
+    return -1;
+  }
+  m_Entry -= i;
+  if (m_Entry > m_NEntries)
+  {
+    m_Entry = m_NEntries;
+  }
+  return 0;
+}
+
+void Fun4AllRNTupleInputManager::Print(const std::string &what) const
+{
+  if (what == "ALL" || what == "NODES")
+  {
+    std::cout << Name() << ": " << m_Mappers.size() << " nodes read from " << FileName() << std::endl;
+    for (const auto &mapper : m_Mappers)
+    {
+      std::cout << Name() << ": Node " << mapper->NodeName() << " (" << mapper->Type() << ")" << std::endl;
+    }
+  }
+  Fun4AllInputManager::Print(what);
+}
@@ -0,0 +1,61 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef RNTUPLEIO_FUN4ALLRNTUPLEINPUTMANAGER_H
+#define RNTUPLEIO_FUN4ALLRNTUPLEINPUTMANAGER_H
+
+#include <fun4all/Fun4AllInputManager.h>
+#include <fun4all/Fun4AllReturnCodes.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class PHCompositeNode;
+class PHTimer;
+class RNTupleNodeMapper;
+class SyncObject;
+class TFile;
+
+namespace ROOT::Experimental
+{
+  class RNTupleReader;
+}
+
+/*!
+ * Reads files written by Fun4AllRNTupleOutputManager. The nodes listed in the
+ * file are created below the input node and filled entry by entry.
+ * The files carry no sync object, events are taken as they come.
+ */
+class Fun4AllRNTupleInputManager : public Fun4AllInputManager
+{
+ public:
+  Fun4AllRNTupleInputManager(const std::string &name = "RNTUPLEIN", const std::string &nodename = "DST", const std::string &topnodename = "TOP");
+  ~Fun4AllRNTupleInputManager() override;
+  Fun4AllRNTupleInputManager(const Fun4AllRNTupleInputManager &) = delete;
+  Fun4AllRNTupleInputManager &operator=(Fun4AllRNTupleInputManager const &) = delete;
+
+  int fileopen(const std::string &filenam) override;
+  int fileclose() override;
+  int run(const int nevents = 0) override;
+  void Print(const std::string &what = "ALL") const override;
+  int PushBackEvents(const int i) override;
+
+  int SyncIt(const SyncObject * /*mastersync*/) override { return Fun4AllReturnCodes::SYNC_OK; }
+  int GetSyncObject(SyncObject ** /*mastersync*/) override { return Fun4AllReturnCodes::SYNC_NOOBJECT; }
+  int NoSyncPushBackEvents(const int nevt) override { return PushBackEvents(nevt); }
+
+ private:
+  PHCompositeNode *dstNode{nullptr};
+  std::unique_ptr<TFile> m_File;
+  std::unique_ptr<ROOT::Experimental::RNTupleReader> m_Reader;
+  std::vector<std::unique_ptr<RNTupleNodeMapper>> m_Mappers;
+  PHTimer *m_Timer{nullptr};
+  //! time spent reading entries into the nodes (ms)
+  double m_ReadTime{0};
+  std::uint64_t m_Entry{0};
+  std::uint64_t m_NEntries{0};
+  int events_total{0};
+};
+
+#endif
@@ -0,0 +1,205 @@
+#include "Fun4AllRNTupleOutputManager.h"
+
+#include "RNTupleNodeMapper.h"
+
+#include <phool/PHCompositeNode.h>
+#include <phool/PHIODataNode.h>
+#include <phool/PHNodeIterator.h>
+#include <phool/PHObject.h>
+#include <phool/PHTimer.h>
+#include <phool/phool.h>  // for PHWHERE
+#include <phool/recoConsts.h>
+
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleWriteOptions.hxx>
+#include <ROOT/RNTupleWriter.hxx>
+
+#include <TFile.h>
+#include <TNamed.h>
+
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+Fun4AllRNTupleOutputManager::Fun4AllRNTupleOutputManager(const std::string &myname, const std::string &filename)
+  : Fun4AllOutputManager(myname, filename)
+  , m_Timer(new PHTimer("RNTupleOutput"))
+{
+  return;
+}
+
+Fun4AllRNTupleOutputManager::~Fun4AllRNTupleOutputManager()
+{
+  outfile_close();
+  delete m_Timer;
+}
+
+int Fun4AllRNTupleOutputManager::AddNode(const std::string &nodename)
+{
+  savenodes.insert(nodename);
+  return 0;
+}
+
+int Fun4AllRNTupleOutputManager::outfileopen(const std::string &fname)
+{
+  OutFileName(fname);
+  return 0;
+}
+
+void Fun4AllRNTupleOutputManager::Print(const std::string &what) const
+{
+  if (what == "ALL" || what == "WRITENODES")
+  {
+    std::cout << Name() << " writes " << OutFileName() << " as RNTuple" << std::endl;
+    for (const auto &nodename : savenodes)
+    {
+      std::cout << Name() << ": Node " << nodename << " is written out" << std::endl;
+    }
+  }
+  Fun4AllOutputManager::Print(what);
+}
+
+int Fun4AllRNTupleOutputManager::Write(PHCompositeNode *startNode)
+{
+  if (!m_Writer)
+  {
+    if (outfile_open_first_write(startNode))
+    {
+      return -1;
+    }
+  }
+  m_Timer->restart();
+  for (auto &mapper : m_Mappers)
+  {
+    if (mapper->Fill(startNode) && Verbosity() > 0)
+    {
+      std::cout << PHWHERE << Name() << ": Node " << mapper->NodeName()
+                << " does not exist, writing empty entry" << std::endl;
+    }
+  }
+  m_Writer->Fill();
+  m_Timer->stop();
+  m_FillTime += m_Timer->elapsed();
+  m_EventsThisFile++;
+  return 0;
+}
+
+// there is no run node in the RNTuple output, the framework calls this
+// when the output file has to be closed
+int Fun4AllRNTupleOutputManager::WriteNode(PHCompositeNode * /*thisNode*/)
+{
+  outfile_close();
+  return 0;
+}
+
+int Fun4AllRNTupleOutputManager::outfile_open_first_write(PHCompositeNode *startNode)
+{
+  if (savenodes.empty())
+  {
+    std::cout << PHWHERE << Name() << ": no nodes selected, use AddNode()" << std::endl;
+    return -1;
+  }
+  SetEventsWritten(1);  // this is the first event we write, need to set the number to 1
+  std::filesystem::path p = OutFileName();
+  if (m_FileNameStem.empty())
+  {
+    m_FileNameStem = p.stem();
+  }
+  if (ApplyFileRule())
+  {
+    recoConsts *rc = recoConsts::instance();
+    int runnumber = 0;
+    if (rc->FlagExist("RUNNUMBER"))
+    {
+      runnumber = rc->get_IntFlag("RUNNUMBER");
+    }
+    std::string fullpath = ".";
+    if (p.has_parent_path())
+    {
+      fullpath = p.parent_path();
+    }
+    std::string runseg = std::format("-{:08}-{:05}", runnumber, m_CurrentSegment);
+    std::string newfile = fullpath + std::string("/") + m_FileNameStem + runseg + std::string(p.extension());
+    OutFileName(newfile);
+    m_CurrentSegment++;
+  }
+
+  m_Mappers.clear();
+  auto model = ROOT::Experimental::RNTupleModel::Create();
+  PHNodeIterator nodeiter(startNode);
+  for (const auto &nodename : savenodes)
+  {
+    PHIODataNode<PHObject> *node = dynamic_cast<PHIODataNode<PHObject> *>(nodeiter.findFirst("PHIODataNode", nodename));
+    if (!node)
+    {
+      std::cout << PHWHERE << Name() << ": Node " << nodename
+                << " does not exist, not written" << std::endl;
+      continue;
+    }
+    auto mapper = RNTupleNodeMapper::Create(node->getData(), nodename);
+    if (!mapper)
+    {
+      std::cout << PHWHERE << Name() << ": Node " << nodename
+                << " has no RNTuple mapping, not written" << std::endl;
+      continue;
+    }
+    mapper->MakeFields(*model);
+    m_Mappers.push_back(std::move(mapper));
+  }
+  if (m_Mappers.empty())
+  {
+    std::cout << PHWHERE << Name() << ": none of the selected nodes can be written" << std::endl;
+    return -1;
+  }
+
+  m_File.reset(TFile::Open(OutFileName().c_str(), "RECREATE"));
+  if (!m_File || m_File->IsZombie())
+  {
+    std::cout << PHWHERE << " Could not open " << OutFileName() << std::endl;
+    m_File.reset();
+    return -1;
+  }
+  ROOT::Experimental::RNTupleWriteOptions options;
+  options.SetCompression(m_CompressionSetting);
+  m_Writer = ROOT::Experimental::RNTupleWriter::Append(std::move(model), NTupleName, *m_File, options);
+  m_EventsThisFile = 0;
+  m_FillTime = 0;
+  return 0;
+}
+
+void Fun4AllRNTupleOutputManager::outfile_close()
+{
+  if (!m_File)
+  {
+    return;
+  }
+  // the writer commits the remaining clusters and the footer on destruction,
+  // it has to go before the node list is added and the file is closed
+  m_Writer.reset();
+
+  std::ostringstream nodelist;
+  for (const auto &mapper : m_Mappers)
+  {
+    nodelist << mapper->NodeName() << " " << mapper->Type() << " " << mapper->Config() << "\n";
+  }
+  m_File->cd();
+  TNamed(NodeListName, nodelist.str().c_str()).Write();
+  m_File->Close();
+
+  if (Verbosity() > 0)
+  {
+    double bytes = m_File->GetBytesWritten();
+    std::cout << Name() << ": wrote " << m_EventsThisFile << " events to " << OutFileName()
+              << ", " << bytes / 1024. / 1024. << " MB";
+    if (m_EventsThisFile > 0)
+    {
+      std::cout << ", " << bytes / m_EventsThisFile / 1024. << " kB/event, "
+                << m_FillTime / m_EventsThisFile << " ms/event";
+    }
+    std::cout << std::endl;
+  }
+  m_File.reset();
+  m_Mappers.clear();
+}
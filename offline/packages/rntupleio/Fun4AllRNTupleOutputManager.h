@@ -0,0 +1,67 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef RNTUPLEIO_FUN4ALLRNTUPLEOUTPUTMANAGER_H
+#define RNTUPLEIO_FUN4ALLRNTUPLEOUTPUTMANAGER_H
+
+#include <fun4all/Fun4AllOutputManager.h>
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+class PHCompositeNode;
+class PHTimer;
+class RNTupleNodeMapper;
+class TFile;
+
+namespace ROOT::Experimental
+{
+  class RNTupleWriter;
+}
+
+/*!
+ * Writes the selected flat nodes (TowerInfoContainer, TrkrClusterContainer,
+ * SvtxTrackMap, GlobalVertexMap) as columns of an RNTuple instead of
+ * streaming the objects into the node tree TTree. Nodes have to be selected
+ * with AddNode, nodes of unsupported types are reported and skipped.
+ * The node names, types and versions are stored next to the RNTuple so
+ * Fun4AllRNTupleInputManager can rebuild the nodes.
+ */
+class Fun4AllRNTupleOutputManager : public Fun4AllOutputManager
+{
+ public:
+  //! name of the RNTuple and of the node list inside the output file
+  static constexpr const char *NTupleName = "DST";
+  static constexpr const char *NodeListName = "RNTupleNodes";
+
+  Fun4AllRNTupleOutputManager(const std::string &myname = "RNTUPLEOUT", const std::string &filename = "dstout.root");
+  ~Fun4AllRNTupleOutputManager() override;
+  Fun4AllRNTupleOutputManager(const Fun4AllRNTupleOutputManager &) = delete;
+  Fun4AllRNTupleOutputManager &operator=(Fun4AllRNTupleOutputManager const &) = delete;
+
+  int AddNode(const std::string &nodename) override;
+  int outfileopen(const std::string &fname) override;
+  void Print(const std::string &what = "ALL") const override;
+  int Write(PHCompositeNode *startNode) override;
+  //! called when the file is closed (segment rollover or end of job)
+  int WriteNode(PHCompositeNode *thisNode) override;
+  void CompressionSetting(const int i) override { m_CompressionSetting = i; }
+
+ private:
+  int outfile_open_first_write(PHCompositeNode *startNode);
+  void outfile_close();
+
+  std::unique_ptr<TFile> m_File;
+  std::unique_ptr<ROOT::Experimental::RNTupleWriter> m_Writer;
+  std::vector<std::unique_ptr<RNTupleNodeMapper>> m_Mappers;
+  PHTimer *m_Timer{nullptr};
+  //! time spent filling the RNTuple for the current file (ms)
+  double m_FillTime{0};
+  int m_CompressionSetting{505};
+  unsigned int m_EventsThisFile{0};
+  std::string m_FileNameStem;
+  std::set<std::string> savenodes;
+};
+
+#endif
@@ -0,0 +1,141 @@
+#include "RNTupleGlobalVertexMapMapper.h"
+
+#include <globalvertex/GlobalVertex.h>
+#include <globalvertex/GlobalVertexMap.h>
+#include <globalvertex/GlobalVertexMapv1.h>
+#include <globalvertex/GlobalVertexv1.h>
+
+#include <phool/getClass.h>
+
+#include <string>
+
+namespace
+{
+  // upper triangle of the symmetric 3x3 position covariance
+  constexpr unsigned int ErrorRow[] = {0, 0, 0, 1, 1, 2};
+  constexpr unsigned int ErrorCol[] = {0, 1, 2, 1, 2, 2};
+
+  std::string ErrorField(unsigned int index)
+  {
+    return "err" + std::to_string(ErrorRow[index]) + std::to_string(ErrorCol[index]);
+  }
+}  // namespace
+
+void RNTupleGlobalVertexMapMapper::MakeFields(ROOT::Experimental::RNTupleModel &model)
+{
+  m_Id = MakeField<std::vector<std::uint32_t>>(model, "id");
+  m_X = MakeField<std::vector<float>>(model, "x");
+  m_Y = MakeField<std::vector<float>>(model, "y");
+  m_Z = MakeField<std::vector<float>>(model, "z");
+  m_T = MakeField<std::vector<float>>(model, "t");
+  m_TErr = MakeField<std::vector<float>>(model, "t_err");
+  m_Chisq = MakeField<std::vector<float>>(model, "chisq");
+  m_Ndof = MakeField<std::vector<std::uint32_t>>(model, "ndof");
+  for (unsigned int i = 0; i < NErrors; ++i)
+  {
+    m_Error[i] = MakeField<std::vector<float>>(model, ErrorField(i));
+  }
+}
+
+int RNTupleGlobalVertexMapMapper::Fill(PHCompositeNode *topNode)
+{
+  m_Id->clear();
+  m_X->clear();
+  m_Y->clear();
+  m_Z->clear();
+  m_T->clear();
+  m_TErr->clear();
+  m_Chisq->clear();
+  m_Ndof->clear();
+  for (auto &column : m_Error)
+  {
+    column->clear();
+  }
+
+  GlobalVertexMap *vertexmap = findNode::getClass<GlobalVertexMap>(topNode, NodeName());
+  if (!vertexmap)
+  {
+    return -1;
+  }
+
+  for (const auto &[key, vertex] : *vertexmap)
+  {
+    m_Id->push_back(key);
+    m_X->push_back(vertex->get_x());
+    m_Y->push_back(vertex->get_y());
+    m_Z->push_back(vertex->get_z());
+    m_T->push_back(vertex->get_t());
+    m_TErr->push_back(vertex->get_t_err());
+    m_Chisq->push_back(vertex->get_chisq());
+    m_Ndof->push_back(vertex->get_ndof());
+    for (unsigned int i = 0; i < NErrors; ++i)
+    {
+      m_Error[i]->push_back(vertex->get_error(ErrorRow[i], ErrorCol[i]));
+    }
+  }
+  return 0;
+}
+
+void RNTupleGlobalVertexMapMapper::ConnectFields(ROOT::Experimental::RNTupleReader &reader)
+{
+  m_IdView = GetView<std::vector<std::uint32_t>>(reader, "id");
+  m_XView = GetView<std::vector<float>>(reader, "x");
+  m_YView = GetView<std::vector<float>>(reader, "y");
+  m_ZView = GetView<std::vector<float>>(reader, "z");
+  m_TView = GetView<std::vector<float>>(reader, "t");
+  m_TErrView = GetView<std::vector<float>>(reader, "t_err");
+  m_ChisqView = GetView<std::vector<float>>(reader, "chisq");
+  m_NdofView = GetView<std::vector<std::uint32_t>>(reader, "ndof");
+  for (unsigned int i = 0; i < NErrors; ++i)
+  {
+    m_ErrorView[i] = GetView<std::vector<float>>(reader, ErrorField(i));
+  }
+}
+
+int RNTupleGlobalVertexMapMapper::CreateNode(PHCompositeNode *dstNode)
+{
+  if (!findNode::getClass<GlobalVertexMap>(dstNode, NodeName()))
+  {
+    AddNode(dstNode, NodeName(), new GlobalVertexMapv1);
+  }
+  return 0;
+}
+
+int RNTupleGlobalVertexMapMapper::Read(PHCompositeNode *dstNode, const std::uint64_t entry)
+{
+  GlobalVertexMap *vertexmap = findNode::getClass<GlobalVertexMap>(dstNode, NodeName());
+  if (!vertexmap)
+  {
+    return -1;
+  }
+  vertexmap->Reset();
+
+  const auto &id = (*m_IdView)(entry);
+  const auto &x = (*m_XView)(entry);
+  const auto &y = (*m_YView)(entry);
+  const auto &z = (*m_ZView)(entry);
+  const auto &t = (*m_TView)(entry);
+  const auto &t_err = (*m_TErrView)(entry);
+  const auto &chisq = (*m_ChisqView)(entry);
+  const auto &ndof = (*m_NdofView)(entry);
+
+  for (size_t i = 0; i < id.size(); ++i)
+  {
+    // the map takes ownership
+    auto *vertex = new GlobalVertexv1;
+    vertex->set_id(id[i]);
+    vertex->set_x(x[i]);
+    vertex->set_y(y[i]);
+    vertex->set_z(z[i]);
+    vertex->set_t(t[i]);
+    vertex->set_t_err(t_err[i]);
+    vertex->set_chisq(chisq[i]);
+    vertex->set_ndof(ndof[i]);
+    for (unsigned int j = 0; j < NErrors; ++j)
+    {
+      vertex->set_error(ErrorRow[j], ErrorCol[j], (*m_ErrorView[j])(entry)[i]);
+    }
+    vertexmap->insert(vertex);
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef RNTUPLEIO_RNTUPLEGLOBALVERTEXMAPMAPPER_H
+#define RNTUPLEIO_RNTUPLEGLOBALVERTEXMAPMAPPER_H
+
+#include "RNTupleNodeMapper.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*!
+ * GlobalVertexMap: one entry per vertex with the combined position, time,
+ * fit quality and the upper triangle of the covariance matrix.
+ * The associated detector vertices are not stored, vertices are read back
+ * as GlobalVertexv1 in a GlobalVertexMapv1.
+ */
+class RNTupleGlobalVertexMapMapper : public RNTupleNodeMapper
+{
+ public:
+  static constexpr const char *TypeName = "GlobalVertexMap";
+
+  explicit RNTupleGlobalVertexMapMapper(const std::string &nodename)
+    : RNTupleNodeMapper(nodename)
+  {
+  }
+  ~RNTupleGlobalVertexMapMapper() override = default;
+
+  std::string Type() const override { return TypeName; }
+
+  void MakeFields(ROOT::Experimental::RNTupleModel &model) override;
+  int Fill(PHCompositeNode *topNode) override;
+
+  void ConnectFields(ROOT::Experimental::RNTupleReader &reader) override;
+  int CreateNode(PHCompositeNode *dstNode) override;
+  int Read(PHCompositeNode *dstNode, const std::uint64_t entry) override;
+
+ private:
+  static constexpr unsigned int NErrors = 6;
+
+  template <class T>
+  using Column = std::shared_ptr<std::vector<T>>;
+
+  template <class T>
+  using View = std::unique_ptr<ROOT::Experimental::RNTupleView<std::vector<T>>>;
+
+  Column<std::uint32_t> m_Id;
+  Column<float> m_X;
+  Column<float> m_Y;
+  Column<float> m_Z;
+  Column<float> m_T;
+  Column<float> m_TErr;
+  Column<float> m_Chisq;
+  Column<std::uint32_t> m_Ndof;
+  std::array<Column<float>, NErrors> m_Error;
+
+  View<std::uint32_t> m_IdView;
+  View<float> m_XView;
+  View<float> m_YView;
+  View<float> m_ZView;
+  View<float> m_TView;
+  View<float> m_TErrView;
+  View<float> m_ChisqView;
+  View<std::uint32_t> m_NdofView;
+  std::array<View<float>, NErrors> m_ErrorView;
+};
+
+#endif
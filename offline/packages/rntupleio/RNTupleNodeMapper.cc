@@ -0,0 +1,68 @@
+#include "RNTupleNodeMapper.h"
+
+#include "RNTupleGlobalVertexMapMapper.h"
+#include "RNTupleSvtxTrackMapMapper.h"
+#include "RNTupleTowerInfoMapper.h"
+#include "RNTupleTrkrClusterMapper.h"
+
+#include <calobase/TowerInfoContainer.h>
+
+#include <globalvertex/GlobalVertexMap.h>
+
+#include <trackbase/TrkrClusterContainer.h>
+
+#include <trackbase_historic/SvtxTrackMap.h>
+
+#include <phool/PHCompositeNode.h>
+#include <phool/PHIODataNode.h>
+#include <phool/PHObject.h>
+
+std::unique_ptr<RNTupleNodeMapper> RNTupleNodeMapper::Create(PHObject *object, const std::string &nodename)
+{
+  std::unique_ptr<RNTupleNodeMapper> mapper;
+  if (auto *towers = dynamic_cast<TowerInfoContainer *>(object))
+  {
+    mapper = std::make_unique<RNTupleTowerInfoMapper>(nodename, towers);
+  }
+  else if (dynamic_cast<TrkrClusterContainer *>(object))
+  {
+    mapper = std::make_unique<RNTupleTrkrClusterMapper>(nodename);
+  }
+  else if (dynamic_cast<SvtxTrackMap *>(object))
+  {
+    mapper = std::make_unique<RNTupleSvtxTrackMapMapper>(nodename);
+  }
+  else if (dynamic_cast<GlobalVertexMap *>(object))
+  {
+    mapper = std::make_unique<RNTupleGlobalVertexMapMapper>(nodename);
+  }
+  return mapper;
+}
+
+std::unique_ptr<RNTupleNodeMapper> RNTupleNodeMapper::Create(const std::string &type, const std::string &nodename)
+{
+  std::unique_ptr<RNTupleNodeMapper> mapper;
+  if (type == RNTupleTowerInfoMapper::TypeName)
+  {
+    mapper = std::make_unique<RNTupleTowerInfoMapper>(nodename);
+  }
+  else if (type == RNTupleTrkrClusterMapper::TypeName)
+  {
+    mapper = std::make_unique<RNTupleTrkrClusterMapper>(nodename);
+  }
+  else if (type == RNTupleSvtxTrackMapMapper::TypeName)
+  {
+    mapper = std::make_unique<RNTupleSvtxTrackMapMapper>(nodename);
+  }
+  else if (type == RNTupleGlobalVertexMapMapper::TypeName)
+  {
+    mapper = std::make_unique<RNTupleGlobalVertexMapMapper>(nodename);
+  }
+  return mapper;
+}
+
+void RNTupleNodeMapper::AddNode(PHCompositeNode *dstNode, const std::string &nodename, PHObject *object)
+{
+  PHIODataNode<PHObject> *newnode = new PHIODataNode<PHObject>(object, nodename, "PHObject");
+  dstNode->addNode(newnode);
+}
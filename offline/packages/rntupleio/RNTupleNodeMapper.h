@@ -0,0 +1,86 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef RNTUPLEIO_RNTUPLENODEMAPPER_H
+#define RNTUPLEIO_RNTUPLENODEMAPPER_H
+
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleReader.hxx>
+#include <ROOT/RNTupleView.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class PHCompositeNode;
+class PHObject;
+
+/*!
+ * Maps the content of one flat node (TowerInfoContainer, TrkrClusterContainer, ...)
+ * to a set of RNTuple fields and back. Field names are prefixed with the node name
+ * so several nodes of the same type can live in the same RNTuple.
+ * The type and configuration strings are stored in the file so that the input
+ * manager can recreate the matching mapper and node.
+ */
+class RNTupleNodeMapper
+{
+ public:
+  explicit RNTupleNodeMapper(const std::string &nodename)
+    : m_NodeName(nodename)
+  {
+  }
+  virtual ~RNTupleNodeMapper() = default;
+
+  const std::string &NodeName() const { return m_NodeName; }
+
+  //! type tag stored in the output file
+  virtual std::string Type() const = 0;
+
+  //! additional configuration (object version, detector...) stored in the output file
+  virtual std::string Config() const { return ""; }
+  virtual void Config(const std::string & /*config*/) {}
+
+  //! output: declare the fields of this node in the model
+  virtual void MakeFields(ROOT::Experimental::RNTupleModel &model) = 0;
+
+  //! output: copy the node content into the field buffers, returns non zero if the node is missing
+  virtual int Fill(PHCompositeNode *topNode) = 0;
+
+  //! input: connect to the fields of this node
+  virtual void ConnectFields(ROOT::Experimental::RNTupleReader &reader) = 0;
+
+  //! input: create the node below dstNode if it does not exist yet
+  virtual int CreateNode(PHCompositeNode *dstNode) = 0;
+
+  //! input: load one entry into the node
+  virtual int Read(PHCompositeNode *dstNode, const std::uint64_t entry) = 0;
+
+  //! create mapper from the object stored in a node, nullptr if the type is not supported
+  static std::unique_ptr<RNTupleNodeMapper> Create(PHObject *object, const std::string &nodename);
+
+  //! create mapper from the type tag stored in the file, nullptr if the type is not supported
+  static std::unique_ptr<RNTupleNodeMapper> Create(const std::string &type, const std::string &nodename);
+
+ protected:
+  //! field name for this node, RNTuple field names cannot contain dots
+  std::string FieldName(const std::string &field) const { return m_NodeName + "_" + field; }
+
+  template <class T>
+  std::shared_ptr<T> MakeField(ROOT::Experimental::RNTupleModel &model, const std::string &field) const
+  {
+    return model.MakeField<T>(FieldName(field));
+  }
+
+  template <class T>
+  std::unique_ptr<ROOT::Experimental::RNTupleView<T>> GetView(ROOT::Experimental::RNTupleReader &reader, const std::string &field) const
+  {
+    return std::make_unique<ROOT::Experimental::RNTupleView<T>>(reader.GetView<T>(FieldName(field)));
+  }
+
+  //! add object to the node tree below dstNode, the node tree takes ownership
+  static void AddNode(PHCompositeNode *dstNode, const std::string &nodename, PHObject *object);
+
+ private:
+  std::string m_NodeName;
+};
+
+#endif
@@ -0,0 +1,124 @@
+#include "RNTupleSvtxTrackMapMapper.h"
+
+#include <trackbase_historic/SvtxTrack.h>
+#include <trackbase_historic/SvtxTrackMap.h>
+#include <trackbase_historic/SvtxTrackMap_v2.h>
+#include <trackbase_historic/SvtxTrack_v4.h>
+
+#include <phool/getClass.h>
+
+void RNTupleSvtxTrackMapMapper::MakeFields(ROOT::Experimental::RNTupleModel &model)
+{
+  m_Id = MakeField<std::vector<std::uint32_t>>(model, "id");
+  m_Px = MakeField<std::vector<float>>(model, "px");
+  m_Py = MakeField<std::vector<float>>(model, "py");
+  m_Pz = MakeField<std::vector<float>>(model, "pz");
+  m_X = MakeField<std::vector<float>>(model, "x");
+  m_Y = MakeField<std::vector<float>>(model, "y");
+  m_Z = MakeField<std::vector<float>>(model, "z");
+  m_Chisq = MakeField<std::vector<float>>(model, "chisq");
+  m_Ndf = MakeField<std::vector<std::uint32_t>>(model, "ndf");
+  m_Crossing = MakeField<std::vector<std::int16_t>>(model, "crossing");
+  m_Charge = MakeField<std::vector<std::int8_t>>(model, "charge");
+}
+
+int RNTupleSvtxTrackMapMapper::Fill(PHCompositeNode *topNode)
+{
+  m_Id->clear();
+  m_Px->clear();
+  m_Py->clear();
+  m_Pz->clear();
+  m_X->clear();
+  m_Y->clear();
+  m_Z->clear();
+  m_Chisq->clear();
+  m_Ndf->clear();
+  m_Crossing->clear();
+  m_Charge->clear();
+
+  SvtxTrackMap *trackmap = findNode::getClass<SvtxTrackMap>(topNode, NodeName());
+  if (!trackmap)
+  {
+    return -1;
+  }
+
+  for (const auto &[key, track] : *trackmap)
+  {
+    m_Id->push_back(key);
+    m_Px->push_back(track->get_px());
+    m_Py->push_back(track->get_py());
+    m_Pz->push_back(track->get_pz());
+    m_X->push_back(track->get_x());
+    m_Y->push_back(track->get_y());
+    m_Z->push_back(track->get_z());
+    m_Chisq->push_back(track->get_chisq());
+    m_Ndf->push_back(track->get_ndf());
+    m_Crossing->push_back(track->get_crossing());
+    m_Charge->push_back(static_cast<std::int8_t>(track->get_charge()));
+  }
+  return 0;
+}
+
+void RNTupleSvtxTrackMapMapper::ConnectFields(ROOT::Experimental::RNTupleReader &reader)
+{
+  m_IdView = GetView<std::vector<std::uint32_t>>(reader, "id");
+  m_PxView = GetView<std::vector<float>>(reader, "px");
+  m_PyView = GetView<std::vector<float>>(reader, "py");
+  m_PzView = GetView<std::vector<float>>(reader, "pz");
+  m_XView = GetView<std::vector<float>>(reader, "x");
+  m_YView = GetView<std::vector<float>>(reader, "y");
+  m_ZView = GetView<std::vector<float>>(reader, "z");
+  m_ChisqView = GetView<std::vector<float>>(reader, "chisq");
+  m_NdfView = GetView<std::vector<std::uint32_t>>(reader, "ndf");
+  m_CrossingView = GetView<std::vector<std::int16_t>>(reader, "crossing");
+  m_ChargeView = GetView<std::vector<std::int8_t>>(reader, "charge");
+}
+
+int RNTupleSvtxTrackMapMapper::CreateNode(PHCompositeNode *dstNode)
+{
+  if (!findNode::getClass<SvtxTrackMap>(dstNode, NodeName()))
+  {
+    AddNode(dstNode, NodeName(), new SvtxTrackMap_v2);
+  }
+  return 0;
+}
+
+int RNTupleSvtxTrackMapMapper::Read(PHCompositeNode *dstNode, const std::uint64_t entry)
+{
+  SvtxTrackMap *trackmap = findNode::getClass<SvtxTrackMap>(dstNode, NodeName());
+  if (!trackmap)
+  {
+    return -1;
+  }
+  trackmap->Reset();
+
+  const auto &id = (*m_IdView)(entry);
+  const auto &px = (*m_PxView)(entry);
+  const auto &py = (*m_PyView)(entry);
+  const auto &pz = (*m_PzView)(entry);
+  const auto &x = (*m_XView)(entry);
+  const auto &y = (*m_YView)(entry);
+  const auto &z = (*m_ZView)(entry);
+  const auto &chisq = (*m_ChisqView)(entry);
+  const auto &ndf = (*m_NdfView)(entry);
+  const auto &crossing = (*m_CrossingView)(entry);
+  const auto &charge = (*m_ChargeView)(entry);
+
+  // insertWithKey stores a copy, one scratch track is enough
+  SvtxTrack_v4 track;
+  for (size_t i = 0; i < id.size(); ++i)
+  {
+    track.set_px(px[i]);
+    track.set_py(py[i]);
+    track.set_pz(pz[i]);
+    track.set_x(x[i]);
+    track.set_y(y[i]);
+    track.set_z(z[i]);
+    track.set_chisq(chisq[i]);
+    track.set_ndf(static_cast<int>(ndf[i]));
+    track.set_crossing(crossing[i]);
+    track.set_charge(charge[i]);
+    trackmap->insertWithKey(&track, id[i]);
+  }
+  return 0;
+}
@@ -0,0 +1,71 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef RNTUPLEIO_RNTUPLESVTXTRACKMAPMAPPER_H
+#define RNTUPLEIO_RNTUPLESVTXTRACKMAPMAPPER_H
+
+#include "RNTupleNodeMapper.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*!
+ * SvtxTrackMap: one entry per track with the track parameters at the pca
+ * (momentum, position, charge, fit quality and bunch crossing).
+ * Track states, cluster keys and seeds are not stored, tracks are read back
+ * as SvtxTrack_v4 in a SvtxTrackMap_v2, which covers the analysis level use.
+ */
+class RNTupleSvtxTrackMapMapper : public RNTupleNodeMapper
+{
+ public:
+  static constexpr const char *TypeName = "SvtxTrackMap";
+
+  explicit RNTupleSvtxTrackMapMapper(const std::string &nodename)
+    : RNTupleNodeMapper(nodename)
+  {
+  }
+  ~RNTupleSvtxTrackMapMapper() override = default;
+
+  std::string Type() const override { return TypeName; }
+
+  void MakeFields(ROOT::Experimental::RNTupleModel &model) override;
+  int Fill(PHCompositeNode *topNode) override;
+
+  void ConnectFields(ROOT::Experimental::RNTupleReader &reader) override;
+  int CreateNode(PHCompositeNode *dstNode) override;
+  int Read(PHCompositeNode *dstNode, const std::uint64_t entry) override;
+
+ private:
+  template <class T>
+  using Column = std::shared_ptr<std::vector<T>>;
+
+  template <class T>
+  using View = std::unique_ptr<ROOT::Experimental::RNTupleView<std::vector<T>>>;
+
+  Column<std::uint32_t> m_Id;
+  Column<float> m_Px;
+  Column<float> m_Py;
+  Column<float> m_Pz;
+  Column<float> m_X;
+  Column<float> m_Y;
+  Column<float> m_Z;
+  Column<float> m_Chisq;
+  Column<std::uint32_t> m_Ndf;
+  Column<std::int16_t> m_Crossing;
+  Column<std::int8_t> m_Charge;
+
+  View<std::uint32_t> m_IdView;
+  View<float> m_PxView;
+  View<float> m_PyView;
+  View<float> m_PzView;
+  View<float> m_XView;
+  View<float> m_YView;
+  View<float> m_ZView;
+  View<float> m_ChisqView;
+  View<std::uint32_t> m_NdfView;
+  View<std::int16_t> m_CrossingView;
+  View<std::int8_t> m_ChargeView;
+};
+
+#endif
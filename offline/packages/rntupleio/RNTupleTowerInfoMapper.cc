@@ -0,0 +1,163 @@
+#include "RNTupleTowerInfoMapper.h"
+
+#include <calobase/TowerInfo.h>
+#include <calobase/TowerInfoContainer.h>
+#include <calobase/TowerInfoContainerv1.h>
+#include <calobase/TowerInfoContainerv2.h>
+#include <calobase/TowerInfoContainerv3.h>
+#include <calobase/TowerInfoContainerv4.h>
+#include <calobase/TowerInfoContainerv5.h>
+
+#include <phool/getClass.h>
+#include <phool/phool.h>
+
+#include <iostream>
+#include <sstream>
+
+RNTupleTowerInfoMapper::RNTupleTowerInfoMapper(const std::string &nodename, TowerInfoContainer *towers)
+  : RNTupleNodeMapper(nodename)
+{
+  if (towers)
+  {
+    m_ClassName = towers->ClassName();
+    m_Detector = towers->get_detectorid();
+  }
+}
+
+std::string RNTupleTowerInfoMapper::Config() const
+{
+  return m_ClassName + " " + std::to_string(m_Detector);
+}
+
+void RNTupleTowerInfoMapper::Config(const std::string &config)
+{
+  std::istringstream is(config);
+  is >> m_ClassName >> m_Detector;
+}
+
+void RNTupleTowerInfoMapper::MakeFields(ROOT::Experimental::RNTupleModel &model)
+{
+  m_Energy = MakeField<std::vector<float>>(model, "energy");
+  m_Time = MakeField<std::vector<float>>(model, "time");
+  m_Chi2 = MakeField<std::vector<float>>(model, "chi2");
+  m_Pedestal = MakeField<std::vector<float>>(model, "pedestal");
+  m_Status = MakeField<std::vector<std::uint8_t>>(model, "status");
+}
+
+int RNTupleTowerInfoMapper::Fill(PHCompositeNode *topNode)
+{
+  m_Energy->clear();
+  m_Time->clear();
+  m_Chi2->clear();
+  m_Pedestal->clear();
+  m_Status->clear();
+
+  TowerInfoContainer *towers = findNode::getClass<TowerInfoContainer>(topNode, NodeName());
+  if (!towers)
+  {
+    return -1;
+  }
+
+  const unsigned int nchannels = towers->size();
+  m_Energy->reserve(nchannels);
+  m_Time->reserve(nchannels);
+  m_Chi2->reserve(nchannels);
+  m_Pedestal->reserve(nchannels);
+  m_Status->reserve(nchannels);
+  for (unsigned int channel = 0; channel < nchannels; ++channel)
+  {
+    TowerInfo *tower = towers->get_tower_at_channel(channel);
+    m_Energy->push_back(tower->get_energy());
+    m_Time->push_back(UseShortTime() ? tower->get_time() : tower->get_time_float());
+    m_Chi2->push_back(tower->get_chi2());
+    m_Pedestal->push_back(tower->get_pedestal());
+    m_Status->push_back(tower->get_status());
+  }
+  return 0;
+}
+
+void RNTupleTowerInfoMapper::ConnectFields(ROOT::Experimental::RNTupleReader &reader)
+{
+  m_EnergyView = GetView<std::vector<float>>(reader, "energy");
+  m_TimeView = GetView<std::vector<float>>(reader, "time");
+  m_Chi2View = GetView<std::vector<float>>(reader, "chi2");
+  m_PedestalView = GetView<std::vector<float>>(reader, "pedestal");
+  m_StatusView = GetView<std::vector<std::uint8_t>>(reader, "status");
+}
+
+int RNTupleTowerInfoMapper::CreateNode(PHCompositeNode *dstNode)
+{
+  if (findNode::getClass<TowerInfoContainer>(dstNode, NodeName()))
+  {
+    return 0;
+  }
+  const auto detector = static_cast<TowerInfoContainer::DETECTOR>(m_Detector);
+  TowerInfoContainer *towers = nullptr;
+  if (m_ClassName == "TowerInfoContainerv1")
+  {
+    towers = new TowerInfoContainerv1(detector);
+  }
+  else if (m_ClassName == "TowerInfoContainerv2")
+  {
+    towers = new TowerInfoContainerv2(detector);
+  }
+  else if (m_ClassName == "TowerInfoContainerv3")
+  {
+    towers = new TowerInfoContainerv3(detector);
+  }
+  else if (m_ClassName == "TowerInfoContainerv4")
+  {
+    towers = new TowerInfoContainerv4(detector);
+  }
+  else if (m_ClassName == "TowerInfoContainerv5")
+  {
+    towers = new TowerInfoContainerv5(detector);
+  }
+  else
+  {
+    std::cout << PHWHERE << " unsupported tower container " << m_ClassName
+              << " for node " << NodeName() << std::endl;
+    return -1;
+  }
+  AddNode(dstNode, NodeName(), towers);
+  return 0;
+}
+
+int RNTupleTowerInfoMapper::Read(PHCompositeNode *dstNode, const std::uint64_t entry)
+{
+  TowerInfoContainer *towers = findNode::getClass<TowerInfoContainer>(dstNode, NodeName());
+  if (!towers)
+  {
+    return -1;
+  }
+
+  const auto &energy = (*m_EnergyView)(entry);
+  const auto &time = (*m_TimeView)(entry);
+  const auto &chi2 = (*m_Chi2View)(entry);
+  const auto &pedestal = (*m_PedestalView)(entry);
+  const auto &status = (*m_StatusView)(entry);
+  if (energy.size() != towers->size())
+  {
+    std::cout << PHWHERE << " " << NodeName() << ": number of channels in file " << energy.size()
+              << " does not match container size " << towers->size() << std::endl;
+    return -1;
+  }
+
+  for (unsigned int channel = 0; channel < energy.size(); ++channel)
+  {
+    TowerInfo *tower = towers->get_tower_at_channel(channel);
+    tower->set_energy(energy[channel]);
+    if (UseShortTime())
+    {
+      tower->set_time(static_cast<short>(time[channel]));
+    }
+    else
+    {
+      tower->set_time_float(time[channel]);
+    }
+    tower->set_chi2(chi2[channel]);
+    tower->set_pedestal(pedestal[channel]);
+    tower->set_status(status[channel]);
+  }
+  return 0;
+}
@@ -0,0 +1,58 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef RNTUPLEIO_RNTUPLETOWERINFOMAPPER_H
+#define RNTUPLEIO_RNTUPLETOWERINFOMAPPER_H
+
+#include "RNTupleNodeMapper.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class TowerInfoContainer;
+
+/*!
+ * TowerInfoContainer: one entry per channel in parallel energy/time/chi2/pedestal/status columns.
+ * The channel index is implicit, the key encoding is the one of the container version.
+ */
+class RNTupleTowerInfoMapper : public RNTupleNodeMapper
+{
+ public:
+  static constexpr const char *TypeName = "TowerInfoContainer";
+
+  explicit RNTupleTowerInfoMapper(const std::string &nodename, TowerInfoContainer *towers = nullptr);
+  ~RNTupleTowerInfoMapper() override = default;
+
+  std::string Type() const override { return TypeName; }
+  std::string Config() const override;
+  void Config(const std::string &config) override;
+
+  void MakeFields(ROOT::Experimental::RNTupleModel &model) override;
+  int Fill(PHCompositeNode *topNode) override;
+
+  void ConnectFields(ROOT::Experimental::RNTupleReader &reader) override;
+  int CreateNode(PHCompositeNode *dstNode) override;
+  int Read(PHCompositeNode *dstNode, const std::uint64_t entry) override;
+
+ private:
+  //! v1 towers store an integer time, later versions a float time
+  bool UseShortTime() const { return m_ClassName == "TowerInfoContainerv1"; }
+
+  std::string m_ClassName{"TowerInfoContainerv4"};
+  int m_Detector{0};
+
+  std::shared_ptr<std::vector<float>> m_Energy;
+  std::shared_ptr<std::vector<float>> m_Time;
+  std::shared_ptr<std::vector<float>> m_Chi2;
+  std::shared_ptr<std::vector<float>> m_Pedestal;
+  std::shared_ptr<std::vector<std::uint8_t>> m_Status;
+
+  std::unique_ptr<ROOT::Experimental::RNTupleView<std::vector<float>>> m_EnergyView;
+  std::unique_ptr<ROOT::Experimental::RNTupleView<std::vector<float>>> m_TimeView;
+  std::unique_ptr<ROOT::Experimental::RNTupleView<std::vector<float>>> m_Chi2View;
+  std::unique_ptr<ROOT::Experimental::RNTupleView<std::vector<float>>> m_PedestalView;
+  std::unique_ptr<ROOT::Experimental::RNTupleView<std::vector<std::uint8_t>>> m_StatusView;
+};
+
+#endif
@@ -0,0 +1,134 @@
+#include "RNTupleTrkrClusterMapper.h"
+
+#include <trackbase/TrkrCluster.h>
+#include <trackbase/TrkrClusterContainer.h>
+#include <trackbase/TrkrClusterContainerv4.h>
+#include <trackbase/TrkrClusterv5.h>
+
+#include <phool/getClass.h>
+
+void RNTupleTrkrClusterMapper::MakeFields(ROOT::Experimental::RNTupleModel &model)
+{
+  m_Key = MakeField<std::vector<std::uint64_t>>(model, "key");
+  m_LocalX = MakeField<std::vector<float>>(model, "localx");
+  m_LocalY = MakeField<std::vector<float>>(model, "localy");
+  m_PhiError = MakeField<std::vector<float>>(model, "phierr");
+  m_ZError = MakeField<std::vector<float>>(model, "zerr");
+  m_SubSurfKey = MakeField<std::vector<std::uint16_t>>(model, "subsurfkey");
+  m_Adc = MakeField<std::vector<std::uint16_t>>(model, "adc");
+  m_MaxAdc = MakeField<std::vector<std::uint16_t>>(model, "maxadc");
+  m_PhiSize = MakeField<std::vector<std::uint8_t>>(model, "phisize");
+  m_ZSize = MakeField<std::vector<std::uint8_t>>(model, "zsize");
+  m_Overlap = MakeField<std::vector<std::uint8_t>>(model, "overlap");
+  m_Edge = MakeField<std::vector<std::uint8_t>>(model, "edge");
+}
+
+int RNTupleTrkrClusterMapper::Fill(PHCompositeNode *topNode)
+{
+  m_Key->clear();
+  m_LocalX->clear();
+  m_LocalY->clear();
+  m_PhiError->clear();
+  m_ZError->clear();
+  m_SubSurfKey->clear();
+  m_Adc->clear();
+  m_MaxAdc->clear();
+  m_PhiSize->clear();
+  m_ZSize->clear();
+  m_Overlap->clear();
+  m_Edge->clear();
+
+  TrkrClusterContainer *clusters = findNode::getClass<TrkrClusterContainer>(topNode, NodeName());
+  if (!clusters)
+  {
+    return -1;
+  }
+
+  for (const auto &hitsetkey : clusters->getHitSetKeys())
+  {
+    auto range = clusters->getClusters(hitsetkey);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+      const TrkrCluster *cluster = iter->second;
+      m_Key->push_back(iter->first);
+      m_LocalX->push_back(cluster->getLocalX());
+      m_LocalY->push_back(cluster->getLocalY());
+      m_PhiError->push_back(cluster->getRPhiError());
+      m_ZError->push_back(cluster->getZError());
+      m_SubSurfKey->push_back(cluster->getSubSurfKey());
+      m_Adc->push_back(cluster->getAdc());
+      m_MaxAdc->push_back(cluster->getMaxAdc());
+      m_PhiSize->push_back(static_cast<std::uint8_t>(cluster->getPhiSize()));
+      m_ZSize->push_back(static_cast<std::uint8_t>(cluster->getZSize()));
+      m_Overlap->push_back(cluster->getOverlap());
+      m_Edge->push_back(cluster->getEdge());
+    }
+  }
+  return 0;
+}
+
+void RNTupleTrkrClusterMapper::ConnectFields(ROOT::Experimental::RNTupleReader &reader)
+{
+  m_KeyView = GetView<std::vector<std::uint64_t>>(reader, "key");
+  m_LocalXView = GetView<std::vector<float>>(reader, "localx");
+  m_LocalYView = GetView<std::vector<float>>(reader, "localy");
+  m_PhiErrorView = GetView<std::vector<float>>(reader, "phierr");
+  m_ZErrorView = GetView<std::vector<float>>(reader, "zerr");
+  m_SubSurfKeyView = GetView<std::vector<std::uint16_t>>(reader, "subsurfkey");
+  m_AdcView = GetView<std::vector<std::uint16_t>>(reader, "adc");
+  m_MaxAdcView = GetView<std::vector<std::uint16_t>>(reader, "maxadc");
+  m_PhiSizeView = GetView<std::vector<std::uint8_t>>(reader, "phisize");
+  m_ZSizeView = GetView<std::vector<std::uint8_t>>(reader, "zsize");
+  m_OverlapView = GetView<std::vector<std::uint8_t>>(reader, "overlap");
+  m_EdgeView = GetView<std::vector<std::uint8_t>>(reader, "edge");
+}
+
+int RNTupleTrkrClusterMapper::CreateNode(PHCompositeNode *dstNode)
+{
+  if (!findNode::getClass<TrkrClusterContainer>(dstNode, NodeName()))
+  {
+    AddNode(dstNode, NodeName(), new TrkrClusterContainerv4);
+  }
+  return 0;
+}
+
+int RNTupleTrkrClusterMapper::Read(PHCompositeNode *dstNode, const std::uint64_t entry)
+{
+  TrkrClusterContainer *clusters = findNode::getClass<TrkrClusterContainer>(dstNode, NodeName());
+  if (!clusters)
+  {
+    return -1;
+  }
+  clusters->Reset();
+
+  const auto &key = (*m_KeyView)(entry);
+  const auto &localx = (*m_LocalXView)(entry);
+  const auto &localy = (*m_LocalYView)(entry);
+  const auto &phierr = (*m_PhiErrorView)(entry);
+  const auto &zerr = (*m_ZErrorView)(entry);
+  const auto &subsurfkey = (*m_SubSurfKeyView)(entry);
+  const auto &adc = (*m_AdcView)(entry);
+  const auto &maxadc = (*m_MaxAdcView)(entry);
+  const auto &phisize = (*m_PhiSizeView)(entry);
+  const auto &zsize = (*m_ZSizeView)(entry);
+  const auto &overlap = (*m_OverlapView)(entry);
+  const auto &edge = (*m_EdgeView)(entry);
+
+  for (size_t i = 0; i < key.size(); ++i)
+  {
+    auto *cluster = new TrkrClusterv5;
+    cluster->setLocalX(localx[i]);
+    cluster->setLocalY(localy[i]);
+    cluster->setPhiError(phierr[i]);
+    cluster->setZError(zerr[i]);
+    cluster->setSubSurfKey(subsurfkey[i]);
+    cluster->setAdc(adc[i]);
+    cluster->setMaxAdc(maxadc[i]);
+    cluster->setPhiSize(static_cast<char>(phisize[i]));
+    cluster->setZSize(static_cast<char>(zsize[i]));
+    cluster->setOverlap(static_cast<char>(overlap[i]));
+    cluster->setEdge(static_cast<char>(edge[i]));
+    clusters->addClusterSpecifyKey(key[i], cluster);
+  }
+  return 0;
+}
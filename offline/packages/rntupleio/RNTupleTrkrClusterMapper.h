@@ -0,0 +1,72 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef RNTUPLEIO_RNTUPLETRKRCLUSTERMAPPER_H
+#define RNTUPLEIO_RNTUPLETRKRCLUSTERMAPPER_H
+
+#include "RNTupleNodeMapper.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*!
+ * TrkrClusterContainer: one entry per cluster, with the cluster key and the
+ * TrkrClusterv5 payload in parallel columns. Clusters are read back into a
+ * TrkrClusterContainerv4 of TrkrClusterv5.
+ */
+class RNTupleTrkrClusterMapper : public RNTupleNodeMapper
+{
+ public:
+  static constexpr const char *TypeName = "TrkrClusterContainer";
+
+  explicit RNTupleTrkrClusterMapper(const std::string &nodename)
+    : RNTupleNodeMapper(nodename)
+  {
+  }
+  ~RNTupleTrkrClusterMapper() override = default;
+
+  std::string Type() const override { return TypeName; }
+
+  void MakeFields(ROOT::Experimental::RNTupleModel &model) override;
+  int Fill(PHCompositeNode *topNode) override;
+
+  void ConnectFields(ROOT::Experimental::RNTupleReader &reader) override;
+  int CreateNode(PHCompositeNode *dstNode) override;
+  int Read(PHCompositeNode *dstNode, const std::uint64_t entry) override;
+
+ private:
+  template <class T>
+  using Column = std::shared_ptr<std::vector<T>>;
+
+  template <class T>
+  using View = std::unique_ptr<ROOT::Experimental::RNTupleView<std::vector<T>>>;
+
+  Column<std::uint64_t> m_Key;
+  Column<float> m_LocalX;
+  Column<float> m_LocalY;
+  Column<float> m_PhiError;
+  Column<float> m_ZError;
+  Column<std::uint16_t> m_SubSurfKey;
+  Column<std::uint16_t> m_Adc;
+  Column<std::uint16_t> m_MaxAdc;
+  Column<std::uint8_t> m_PhiSize;
+  Column<std::uint8_t> m_ZSize;
+  Column<std::uint8_t> m_Overlap;
+  Column<std::uint8_t> m_Edge;
+
+  View<std::uint64_t> m_KeyView;
+  View<float> m_LocalXView;
+  View<float> m_LocalYView;
+  View<float> m_PhiErrorView;
+  View<float> m_ZErrorView;
+  View<std::uint16_t> m_SubSurfKeyView;
+  View<std::uint16_t> m_AdcView;
+  View<std::uint16_t> m_MaxAdcView;
+  View<std::uint8_t> m_PhiSizeView;
+  View<std::uint8_t> m_ZSizeView;
+  View<std::uint8_t> m_OverlapView;
+  View<std::uint8_t> m_EdgeView;
+};
+
+#endif
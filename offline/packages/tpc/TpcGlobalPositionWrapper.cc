@@ -14,6 +14,20 @@
 #include <trackbase/ActsGeometry.h>
 #include <trackbase/TpcDefs.h>
 #include <trackbase/TrkrCluster.h>
+#include <trackbase/TrkrClusterGlobalPositionCache.h>
+
+#include <algorithm>
+#include <climits>
+#include <thread>
+
+namespace
+{
+  //! non TPC positions depend neither on crossing nor on distortion corrections, and are cached only once
+  bool is_tpc(TrkrDefs::cluskey key)
+  {
+    return TrkrDefs::getTrkrId(key) == TrkrDefs::TrkrId::tpcId;
+  }
+}  // namespace
 
 //____________________________________________________________________________________________________________________
 void TpcGlobalPositionWrapper::loadNodes( PHCompositeNode* topNode )
@@ -21,6 +35,13 @@ void TpcGlobalPositionWrapper::loadNodes( PHCompositeNode* topNode )
   // acts geometry
   m_tGeometry = findNode::getClass<ActsGeometry>(topNode, "ActsGeometry");
 
+  // global position cache
+  m_cache = findNode::getClass<TrkrClusterGlobalPositionCache>(topNode, "TRKR_CLUSTERGLOBALPOSITIONCACHE");
+  if (m_cache && m_verbosity > 0)
+  {
+    std::cout << "TpcGlobalPositionWrapper::loadNodes - found cluster global position cache" << std::endl;
+  }
+
   // tpc distortion corrections
   m_dcc_module_edge = findNode::getClass<TpcDistortionCorrectionContainer>(topNode, "TpcDistortionCorrectionContainerModuleEdge");
   if (m_dcc_module_edge && m_verbosity > 0)
@@ -72,8 +93,106 @@ Acts::Vector3 TpcGlobalPositionWrapper::applyDistortionCorrections(Acts::Vector3
   return global;
 }
 
+//____________________________________________________________________________________________________________________
+unsigned int TpcGlobalPositionWrapper::corrections() const
+{
+  unsigned int mask = 0;
+  if (m_enable_module_edge_corr && m_dcc_module_edge)
+  {
+    mask |= 1U << 0U;
+  }
+
+  if (m_enable_static_corr && m_dcc_static)
+  {
+    mask |= 1U << 1U;
+  }
+
+  if (m_enable_average_corr && m_dcc_average)
+  {
+    mask |= 1U << 2U;
+  }
+
+  if (m_enable_fluctuation_corr && m_dcc_fluctuation)
+  {
+    mask |= 1U << 3U;
+  }
+
+  return mask;
+}
+
 //____________________________________________________________________________________________________________________
 Acts::Vector3 TpcGlobalPositionWrapper::getGlobalPositionDistortionCorrected(const TrkrDefs::cluskey& key, TrkrCluster* cluster, short int crossing ) const
+{
+  // positions with invalid crossing or missing geometry are not cached
+  if (!m_cache || !m_tGeometry || (is_tpc(key) && crossing == SHRT_MAX))
+  {
+    return computeGlobalPositionDistortionCorrected(key, cluster, crossing);
+  }
+
+  const short int cache_crossing = is_tpc(key) ? crossing : 0;
+  const unsigned int cache_corrections = is_tpc(key) ? corrections() : 0;
+
+  Acts::Vector3 global;
+  if (!m_cache->find(cluster, cache_crossing, cache_corrections, global))
+  {
+    global = computeGlobalPositionDistortionCorrected(key, cluster, crossing);
+    m_cache->insert(cluster, cache_crossing, cache_corrections, global);
+  }
+
+  return global;
+}
+
+//____________________________________________________________________________________________________________________
+void TpcGlobalPositionWrapper::fillCache(const ClusterList& clusters, short int crossing, unsigned int nthreads) const
+{
+  if (!m_cache || !m_tGeometry || crossing == SHRT_MAX)
+  {
+    return;
+  }
+
+  // calculate positions, in parallel if requested
+  std::vector<Acts::Vector3> positions(clusters.size());
+  auto process = [&](size_t begin, size_t end)
+  {
+    for (size_t i = begin; i < end; ++i)
+    {
+      positions[i] = computeGlobalPositionDistortionCorrected(clusters[i].first, clusters[i].second, crossing);
+    }
+  };
+
+  nthreads = std::max(1U, std::min<unsigned int>(nthreads, clusters.size()));
+  if (nthreads == 1)
+  {
+    process(0, clusters.size());
+  }
+  else
+  {
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads);
+    const size_t chunk = (clusters.size() + nthreads - 1) / nthreads;
+    for (unsigned int ithread = 0; ithread < nthreads; ++ithread)
+    {
+      threads.emplace_back(process, std::min(clusters.size(), ithread * chunk), std::min(clusters.size(), (ithread + 1) * chunk));
+    }
+
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  // store
+  m_cache->reserve(m_cache->size() + clusters.size());
+  const unsigned int tpc_corrections = corrections();
+  for (size_t i = 0; i < clusters.size(); ++i)
+  {
+    const auto& [key, cluster] = clusters[i];
+    m_cache->insert(cluster, is_tpc(key) ? crossing : 0, is_tpc(key) ? tpc_corrections : 0, positions[i]);
+  }
+}
+
+//____________________________________________________________________________________________________________________
+Acts::Vector3 TpcGlobalPositionWrapper::computeGlobalPositionDistortionCorrected(const TrkrDefs::cluskey& key, TrkrCluster* cluster, short int crossing ) const
 {
 
   if( !m_tGeometry )
@@ -10,12 +10,22 @@
 
 #include <trackbase/TrkrDefs.h>
 
+#include <utility>
+#include <vector>
 
 class ActsGeometry;
 class PHCompositeNode;
 class TpcDistortionCorrectionContainer;
 class TrkrCluster;
-
+class TrkrClusterGlobalPositionCache;
+
+/*!
+ * threading: when the global position cache is found on the node tree,
+ * getGlobalPositionDistortionCorrected inserts new positions in it, even though it is const.
+ * The cache is shared across modules and is not protected against concurrent access,
+ * so getGlobalPositionDistortionCorrected is not thread-safe and must only be called from one thread at a time.
+ * fillCache handles its own threads, computing positions in parallel and inserting them serially.
+ */
 class TpcGlobalPositionWrapper
 {
   public:
@@ -54,12 +64,31 @@ class TpcGlobalPositionWrapper
   //! get distortion corrected global position from cluster
   /**
    * first converts cluster position local coordinate to global coordinates
-   * then, for TPC clusters only, applies crossing correction, and distortion corrections
+   * then, for TPC clusters only, applies crossing correction, and distortion corrections.
+   * Not thread-safe: newly computed positions are inserted in the shared cache, if any
    */
   Acts::Vector3 getGlobalPositionDistortionCorrected(const TrkrDefs::cluskey&, TrkrCluster*, short int /*crossing*/ ) const;
 
+  //! cluster list, for bulk position calculation
+  using ClusterList = std::vector<std::pair<TrkrDefs::cluskey, TrkrCluster*>>;
+
+  //! fill global position cache, if any, for a list of clusters and a given crossing, using nthreads threads
+  void fillCache(const ClusterList&, short int /*crossing*/, unsigned int /*nthreads*/ = 1) const;
+
+  //! true if global position cache was found on the node tree
+  bool has_cache() const
+  {
+    return m_cache != nullptr;
+  }
+
   private:
 
+  //! bit mask of the distortion corrections applied to TPC clusters, used to key cached positions
+  unsigned int corrections() const;
+
+  //! get distortion corrected global position from cluster, without using the cache
+  Acts::Vector3 computeGlobalPositionDistortionCorrected(const TrkrDefs::cluskey&, TrkrCluster*, short int /*crossing*/ ) const;
+
   //! verbosity
   unsigned int m_verbosity = 0;
 
@@ -71,6 +100,9 @@ class TpcGlobalPositionWrapper
   //! acts geometry
   ActsGeometry* m_tGeometry = nullptr;
 
+  //! global position cache, shared across modules. Optional. Modified by const methods, with no locking
+  TrkrClusterGlobalPositionCache* m_cache = nullptr;
+
   //! module edge distortion correction container
   TpcDistortionCorrectionContainer* m_dcc_module_edge{nullptr};
   bool m_enable_module_edge_corr = true;
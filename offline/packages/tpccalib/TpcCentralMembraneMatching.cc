@@ -36,6 +36,8 @@
 #include <algorithm>
 #include <boost/format.hpp>
 
+#include <omp.h>
+
 #include <cmath>
 #include <iomanip>
 #include <set>
@@ -982,6 +984,97 @@ int TpcCentralMembraneMatching::getClusterRMatch(double clusterR, int side)
   }
 }
 
+//____________________________________________________________________________..
+void TpcCentralMembraneMatching::buildTruthPhiIndex()
+{
+  for (int side = 0; side < 2; ++side)
+  {
+    // truth pads usable for this side. Pads with z = 0 go to both
+    std::vector<int> indices;
+    for (int i = 0; i < (int) m_truth_pos.size(); ++i)
+    {
+      const double tZ = m_truth_pos[i].Z();
+      if ((side == 0 && tZ > 0) || (side == 1 && tZ < 0))
+      {
+        continue;
+      }
+      indices.push_back(i);
+    }
+
+    // sort by phi. Stable sort keeps truth index ordering for pads with identical phi
+    std::stable_sort(indices.begin(), indices.end(), [this](int first, int second)
+                     { return m_truth_pos[first].Phi() < m_truth_pos[second].Phi(); });
+
+    m_truth_phi_index[side] = indices;
+    m_truth_phi_sorted[side].clear();
+    m_truth_phi_sorted[side].reserve(indices.size());
+    for (const int i : indices)
+    {
+      m_truth_phi_sorted[side].push_back(m_truth_pos[i].Phi());
+    }
+  }
+}
+
+//____________________________________________________________________________..
+int TpcCentralMembraneMatching::getNearestTruth(const TVector3& reco, bool side, double max_dR, double max_dphi) const
+{
+  const double rR = get_r(reco.X(), reco.Y());
+  const double rPhi = reco.Phi();
+
+  const auto& phis = m_truth_phi_sorted[side ? 1 : 0];
+  const auto& indices = m_truth_phi_index[side ? 1 : 0];
+
+  int match = -1;
+  double minNNDist = 100000.0;
+
+  // check all truth pads with phi in [phimin, phimax]
+  auto check_range = [&](double phimin, double phimax)
+  {
+    const auto first = std::lower_bound(phis.begin(), phis.end(), phimin);
+    const auto last = std::upper_bound(first, phis.end(), phimax);
+    for (auto iter = first; iter != last; ++iter)
+    {
+      const int truth_index = indices[iter - phis.begin()];
+      const auto& truth = m_truth_pos[truth_index];
+
+      // apply the same cuts as the exhaustive search
+      if (std::abs(get_r(truth.X(), truth.Y()) - rR) > max_dR)
+      {
+        continue;
+      }
+
+      if (std::abs(delta_phi(truth.Phi() - rPhi)) > max_dphi)
+      {
+        continue;
+      }
+
+      // lowest truth index wins ties, as when looping over all pads in order
+      const double dist = std::sqrt(std::pow(truth.X() - reco.X(), 2) + std::pow(truth.Y() - reco.Y(), 2));
+      if (dist < minNNDist || (dist == minNNDist && truth_index < match))
+      {
+        minNNDist = dist;
+        match = truth_index;
+      }
+    }
+  };
+
+  // window is slightly enlarged, exact cut is applied above. Handle wrapping at +/-pi
+  static constexpr double margin = 1e-6;
+  const double phimin = rPhi - max_dphi - margin;
+  const double phimax = rPhi + max_dphi + margin;
+  check_range(phimin, phimax);
+  if (phimin < -M_PI)
+  {
+    check_range(phimin + 2. * M_PI, M_PI);
+  }
+  if (phimax > M_PI)
+  {
+    check_range(-M_PI, phimax - 2. * M_PI);
+  }
+
+  return match;
+}
+
 //____________________________________________________________________________..
 int TpcCentralMembraneMatching::InitRun(PHCompositeNode* topNode)
 {
@@ -1261,6 +1354,8 @@ for (int j = 0; j < nRadii; ++j)
   }
 }
 
+buildTruthPhiIndex();
+
 int ret = GetNodes(topNode);
 return ret;
 }
@@ -1735,65 +1830,31 @@ int TpcCentralMembraneMatching::process_event(PHCompositeNode* topNode)
   } //end fancy
   else
   {
-    int reco_index = 0;
-    for (const auto& reco : reco_pos)
+    // find nearest truth pad for each reco cluster, in parallel
+    const int nReco = reco_pos.size();
+    const int nThreads = m_nThreads > 0 ? m_nThreads : omp_get_max_threads();
+    std::vector<int> reco_NNTruthIndex(nReco, -1);
+#pragma omp parallel for schedule(static) num_threads(nThreads)
+    for (int reco_index = 0; reco_index < nReco; ++reco_index)
     {
-      double rR = get_r(reco.X(), reco.Y());
-      double rPhi = reco.Phi();
-      bool side = reco_side[reco_index];
-
-      truth_index = 0;
-      double minNNDist = 100000.0;
-      int match_localTruth = -1;
-      for (const auto& truth : m_truth_pos)
-      {
-	//std::cout << "reco_index " << reco_index << "   truth_index " << truth_index << std::endl;
-	double tR = get_r(truth.X(), truth.Y());
-        double tPhi = truth.Phi();
-        double tZ = truth.Z();
-
-        if ((!side && tZ > 0) || (side && tZ < 0))
-        {
-          truth_index++;
-          continue;
-        }
-
-        auto dR = fabs(tR - rR);
-        if (dR > 5.0)
-        {
-          truth_index++;
-          continue;
-        }
-
-        auto dphi = delta_phi(tPhi - rPhi);
-        if (fabs(dphi) > 0.05)
-        {
-          truth_index++;
-          continue;
-        }
-
-        double dist = sqrt(pow(truth.X() - reco.X(),2) + pow(truth.Y() - reco.Y(),2));
-        if (dist < minNNDist)
-        {
-          minNNDist = dist;
-          match_localTruth = truth_index;
-        }
-	truth_index++;
-      } // end truth loop
+      reco_NNTruthIndex[reco_index] = getNearestTruth(reco_pos[reco_index], reco_side[reco_index], 5.0, 0.05);
+    }
 
+    // store, sequentially to preserve reco ordering in truth_NNRecoIndex
+    for (int reco_index = 0; reco_index < nReco; ++reco_index)
+    {
+      const int match_localTruth = reco_NNTruthIndex[reco_index];
       if(match_localTruth == -1)
       {
-	reco_index++;
 	continue;
       }
 
+      const auto& reco = reco_pos[reco_index];
       truth_NNRecoIndex[match_localTruth].push_back(reco_index);
       NNDist[reco_index] = sqrt(pow(m_truth_pos[match_localTruth].X() - reco.X(),2) + pow(m_truth_pos[match_localTruth].Y() - reco.Y(),2));
       NNR[reco_index] = get_r(m_truth_pos[match_localTruth].X(), m_truth_pos[match_localTruth].Y());
       NNPhi[reco_index] = m_truth_pos[match_localTruth].Phi();
       NNIndex[reco_index] = m_truth_index[match_localTruth];
-
-      reco_index++;
     } // end reco loop
 
     truth_index = 0;
@@ -105,6 +105,12 @@ class TpcCentralMembraneMatching : public SubsysReco
 
   void set_grid_dimensions(int phibins, int rbins);
 
+  /// number of threads used for matching reco clusters to truth pads. 0 means use OpenMP default
+  void set_nThreads(int nThreads)
+  {
+    m_nThreads = nThreads;
+  }
+
   //! run initialization
   int InitRun(PHCompositeNode *topNode) override;
 
@@ -127,6 +133,12 @@ class TpcCentralMembraneMatching : public SubsysReco
 
   int getClusterRMatch(double clusterR, int side);
 
+  /// sort truth pads by phi, separately for each side, for fast nearest neighbor search
+  void buildTruthPhiIndex();
+
+  /// index of the nearest truth pad on the same side within dR and dphi window, -1 if none
+  int getNearestTruth(const TVector3 &reco, bool side, double max_dR, double max_dphi) const;
+
   //! tpc distortion correction utility class
   TpcDistortionCorrection m_distortionCorrection;
 
@@ -327,6 +339,15 @@ class TpcCentralMembraneMatching : public SubsysReco
   std::vector<TVector3> m_truth_pos;
   std::vector<int> m_truth_index;
 
+  /// truth pad phi, sorted, per side
+  std::vector<double> m_truth_phi_sorted[2];
+
+  /// truth pad index in m_truth_pos matching m_truth_phi_sorted, per side
+  std::vector<int> m_truth_phi_index[2];
+
+  /// number of threads
+  int m_nThreads{1};
+
   std::vector<double> m_truth_RPeaks{22.709, 23.841, 24.973, 26.1049, 27.2369, 28.3689, 29.5009, 30.6328, 31.7648, 32.8968, 34.0288, 35.1607, 36.2927, 37.4247, 38.5566, 39.6886, 42.1706, 44.2119, 46.2533, 48.2947, 50.3361, 52.3774, 54.4188, 56.4602, 59.4605, 61.6546, 63.8487, 66.0428, 68.2369, 70.431, 72.6251, 74.8192};
 
   //@}
@@ -14,11 +14,16 @@
 #include <TFile.h>
 #include <TH2.h>
 #include <TH3.h>
+#include <TROOT.h>
 
 #include <Eigen/Core>
 #include <Eigen/Dense>
 
+#include <omp.h>
+
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace
 {
@@ -64,6 +69,32 @@ namespace
     return out;
   }
 
+  // solve contiguous set of fixed-size linear systems in parallel. error is the square root of the inverse matrix diagonal
+  template<int N>
+    void solve_cells(
+      const std::vector<Eigen::Matrix<float, N, N>>& lhs,
+      const std::vector<Eigen::Matrix<float, N, 1>>& rhs,
+      std::vector<Eigen::Matrix<float, N, 1>>& result,
+      std::vector<Eigen::Matrix<float, N, 1>>& error,
+      int num_threads )
+  {
+    const int ncells = lhs.size();
+    result.resize(ncells);
+    error.resize(ncells);
+
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+    for( int i = 0; i < ncells; ++i )
+    {
+      const Eigen::Matrix<float, N, N> cov = lhs[i].inverse();
+      result[i] = lhs[i].partialPivLu().solve(rhs[i]);
+      error[i] = cov.diagonal().cwiseSqrt();
+    }
+  }
+
+  // number of threads to be used. Zero or negative means OpenMP default
+  int get_num_threads( int num_threads )
+  { return num_threads > 0 ? num_threads:omp_get_max_threads(); }
+
 }  // namespace
 
 //_____________________________________________________________________
@@ -169,6 +200,91 @@ bool TpcSpaceChargeMatrixInversion::add_from_file(const std::string& shortfilena
   return add(*source.get());
 }
 
+//_____________________________________________________________________
+bool TpcSpaceChargeMatrixInversion::add_from_files(const std::vector<std::string>& shortfilenames, const std::string& objectname)
+{
+  // get filenames from frog. This is done sequentially
+  std::vector<std::string> filenames;
+  FROG frog;
+  for (const auto& shortfilename : shortfilenames)
+  {
+    filenames.emplace_back(frog.location(shortfilename));
+  }
+
+  // needed to read TFiles from multiple threads
+  ROOT::EnableThreadSafety();
+
+  const int nfiles = filenames.size();
+  const int num_threads = get_num_threads(m_num_threads);
+  bool success = true;
+
+#pragma omp parallel num_threads(num_threads)
+  {
+    // partial sum for this thread
+    std::unique_ptr<TpcSpaceChargeMatrixContainer> partial;
+    bool local_success = true;
+
+#pragma omp for schedule(dynamic)
+    for (int ifile = 0; ifile < nfiles; ++ifile)
+    {
+      const auto& filename = filenames[ifile];
+
+      // open TFile
+      std::unique_ptr<TFile> inputfile(TFile::Open(filename.c_str()));
+      if (!inputfile)
+      {
+#pragma omp critical(tpc_space_charge_matrix_inversion_print)
+        std::cout << "TpcSpaceChargeMatrixInversion::add_from_files - could not open file " << filename << std::endl;
+        local_success = false;
+        continue;
+      }
+
+      // load object from input file
+      std::unique_ptr<TpcSpaceChargeMatrixContainer> source(dynamic_cast<TpcSpaceChargeMatrixContainer*>(inputfile->Get(objectname.c_str())));
+      if (!source)
+      {
+#pragma omp critical(tpc_space_charge_matrix_inversion_print)
+        std::cout << "TpcSpaceChargeMatrixInversion::add_from_files - could not find object name " << objectname << " in file " << filename << std::endl;
+        local_success = false;
+        continue;
+      }
+
+      // create partial sum if necessary, with grid dimensions from source
+      if (!partial)
+      {
+        partial.reset(new TpcSpaceChargeMatrixContainerv2);
+        int phibins = 0;
+        int rbins = 0;
+        int zbins = 0;
+        source->get_grid_dimensions(phibins, rbins, zbins);
+        partial->set_grid_dimensions(phibins, rbins, zbins);
+      }
+
+      // add object
+      if (!partial->add(*source))
+      {
+        local_success = false;
+      }
+    }
+
+    // merge partial sums
+#pragma omp critical(tpc_space_charge_matrix_inversion_merge)
+    {
+      if (partial && !add(*partial))
+      {
+        local_success = false;
+      }
+
+      if (!local_success)
+      {
+        success = false;
+      }
+    }
+  }
+
+  return success;
+}
+
 //_____________________________________________________________________
 bool TpcSpaceChargeMatrixInversion::add(const TpcSpaceChargeMatrixContainer& source)
 {
@@ -220,131 +336,168 @@ void TpcSpaceChargeMatrixInversion::calculate_distortion_corrections(const Inver
     h->GetZaxis()->SetTitle("z (cm)");
   }
 
-  // loop over bins
+  // minimum number of entries per bin
+  static constexpr int min_cluster_count = 2;
+
+  // collect cells with enough entries
+  struct cell_t
+  {
+    int iphi = 0;
+    int ir = 0;
+    int iz = 0;
+    int index = 0;
+    int entries = 0;
+  };
+
+  std::vector<cell_t> cells;
+  cells.reserve(m_matrix_container->get_grid_size());
   for (int iphi = 0; iphi < phibins; ++iphi)
   {
     for (int ir = 0; ir < rbins; ++ir)
     {
       for (int iz = 0; iz < zbins; ++iz)
       {
-        // get cell index
         const auto icell = m_matrix_container->get_cell_index(iphi, ir, iz);
-
-        // minimum number of entries per bin
-        static constexpr int min_cluster_count = 2;
         const auto cell_entries = m_matrix_container->get_entries(icell);
         if (cell_entries < min_cluster_count)
         {
           continue;
         }
+        cells.push_back({iphi, ir, iz, icell, cell_entries});
+      }
+    }
+  }
+
+  const int ncells = cells.size();
+  const int num_threads = get_num_threads(m_num_threads);
+  if (Verbosity())
+  {
+    std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - inverting " << ncells << " cells using " << num_threads << " threads" << std::endl;
+  }
 
-        switch( inversionMode )
+  // fill histogram bin content and error for a given cell
+  auto fill = [](TH3* h, const cell_t& cell, float value, float error)
+  {
+    h->SetBinContent(cell.iphi + 1, cell.ir + 1, cell.iz + 1, value);
+    h->SetBinError(cell.iphi + 1, cell.ir + 1, cell.iz + 1, error);
+  };
+
+  switch (inversionMode)
+  {
+    case InversionMode::FullInversion:
+    {
+      /* number of coordinates must match that of the matrix container */
+      static constexpr int ncoord = 3;
+      using matrix_t = Eigen::Matrix<float, ncoord, ncoord>;
+      using column_t = Eigen::Matrix<float, ncoord, 1>;
+
+      // build contiguous eigen matrices from container
+      std::vector<matrix_t> lhs(ncells);
+      std::vector<column_t> rhs(ncells);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+      for (int i = 0; i < ncells; ++i)
+      {
+        lhs[i] = get_matrix<&TpcSpaceChargeMatrixContainer::get_lhs, ncoord>(m_matrix_container.get(), cells[i].index);
+        rhs[i] = get_column<&TpcSpaceChargeMatrixContainer::get_rhs, ncoord>(m_matrix_container.get(), cells[i].index);
+      }
+
+      // calculate result using linear solving
+      std::vector<column_t> result;
+      std::vector<column_t> error;
+      solve_cells<ncoord>(lhs, rhs, result, error, num_threads);
+
+      // fill histograms
+      for (int i = 0; i < ncells; ++i)
+      {
+        const auto& cell = cells[i];
+
+        if (Verbosity())
         {
-          case InversionMode::FullInversion:
-          {
-            /* number of coordinates must match that of the matrix container */
-            static constexpr int ncoord = 3;
-            using matrix_t = Eigen::Matrix<float, ncoord, ncoord>;
-            using column_t = Eigen::Matrix<float, ncoord, 1>;
-
-            // build eigen matrices from container
-            matrix_t lhs = get_matrix<&TpcSpaceChargeMatrixContainer::get_lhs,ncoord>(m_matrix_container.get(),icell);
-            column_t rhs = get_column<&TpcSpaceChargeMatrixContainer::get_rhs,ncoord>(m_matrix_container.get(),icell);
-
-            if (Verbosity())
-            {
-              // print matrices and entries
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - inverting bin " << iz << ", " << ir << ", " << iphi << std::endl;
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - entries: " << cell_entries << std::endl;
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - lhs: \n"
-                << lhs << std::endl;
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - rhs: \n"
-                << rhs << std::endl;
-            }
-
-            // calculate result using linear solving
-            const auto cov = lhs.inverse();
-            auto partialLu = lhs.partialPivLu();
-            const auto result = partialLu.solve(rhs);
-
-            // fill histograms
-            hentries->SetBinContent(iphi + 1, ir + 1, iz + 1, cell_entries);
-
-            hphi->SetBinContent(iphi + 1, ir + 1, iz + 1, result(0));
-            hphi->SetBinError(iphi + 1, ir + 1, iz + 1, std::sqrt(cov(0, 0)));
-
-            hz->SetBinContent(iphi + 1, ir + 1, iz + 1, result(1));
-            hz->SetBinError(iphi + 1, ir + 1, iz + 1, std::sqrt(cov(1, 1)));
-
-            hr->SetBinContent(iphi + 1, ir + 1, iz + 1, result(2));
-            hr->SetBinError(iphi + 1, ir + 1, iz + 1, std::sqrt(cov(2, 2)));
-
-            if (Verbosity())
-            {
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dphi: " << result(0) << " +/- " << std::sqrt(cov(0, 0)) << std::endl;
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dz: " << result(1) << " +/- " << std::sqrt(cov(1, 1)) << std::endl;
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dr: " << result(2) << " +/- " << std::sqrt(cov(2, 2)) << std::endl;
-              std::cout << std::endl;
-            }
-            break;
-          }
-
-          case InversionMode::ReducedInversion_phi:
-          case InversionMode::ReducedInversion_z:
-          {
-            /* number of coordinates must match that of the matrix container */
-            static constexpr int ncoord = 2;
-            using matrix_t = Eigen::Matrix<float, ncoord, ncoord>;
-            using column_t = Eigen::Matrix<float, ncoord, 1>;
-
-            // build rphi eigen matrices from container and invert
-            matrix_t lhs_rphi = get_matrix<&TpcSpaceChargeMatrixContainer::get_lhs_rphi,ncoord>(m_matrix_container.get(),icell);
-            column_t rhs_rphi = get_column<&TpcSpaceChargeMatrixContainer::get_rhs_rphi,ncoord>(m_matrix_container.get(),icell);
-            const auto cov_rphi = lhs_rphi.inverse();
-            auto partialLu_rphi = lhs_rphi.partialPivLu();
-            const auto result_rphi = partialLu_rphi.solve(rhs_rphi);
-
-            // build z eigen matrices from container and invert
-            matrix_t lhs_z = get_matrix<&TpcSpaceChargeMatrixContainer::get_lhs_z,ncoord>(m_matrix_container.get(),icell);
-            column_t rhs_z = get_column<&TpcSpaceChargeMatrixContainer::get_rhs_z,ncoord>(m_matrix_container.get(),icell);
-            const auto cov_z = lhs_z.inverse();
-            auto partialLu_z = lhs_z.partialPivLu();
-            const auto result_z = partialLu_z.solve(rhs_z);
-
-            // fill histograms
-            hentries->SetBinContent(iphi + 1, ir + 1, iz + 1, cell_entries);
-
-            hphi->SetBinContent(iphi + 1, ir + 1, iz + 1, result_rphi(0));
-            hphi->SetBinError(iphi + 1, ir + 1, iz + 1, std::sqrt(cov_rphi(0, 0)));
-
-            hz->SetBinContent(iphi + 1, ir + 1, iz + 1, result_z(0));
-            hz->SetBinError(iphi + 1, ir + 1, iz + 1, std::sqrt(cov_z(0, 0)));
-
-            if( inversionMode == InversionMode::ReducedInversion_phi )
-            {
-              hr->SetBinContent(iphi + 1, ir + 1, iz + 1, result_rphi(1));
-              hr->SetBinError(iphi + 1, ir + 1, iz + 1, std::sqrt(cov_rphi(1, 1)));
-            } else if( inversionMode == InversionMode::ReducedInversion_z ) {
-              hr->SetBinContent(iphi + 1, ir + 1, iz + 1, result_z(1));
-              hr->SetBinError(iphi + 1, ir + 1, iz + 1, std::sqrt(cov_z(1, 1)));
-            }
-
-
-            if (Verbosity())
-            {
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dphi: " << result_rphi(0) << " +/- " << std::sqrt(cov_rphi(0, 0)) << std::endl;
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dz: " << result_z(0) << " +/- " << std::sqrt(cov_z(0, 0)) << std::endl;
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dr (rphi): " << result_rphi(1) << " +/- " << std::sqrt(cov_rphi(1, 1)) << std::endl;
-              std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dr (z): " << result_z(1) << " +/- " << std::sqrt(cov_z(1, 1)) << std::endl;
-              std::cout << std::endl;
-            }
-            break;
-          }
+          // print matrices and entries
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - inverting bin " << cell.iz << ", " << cell.ir << ", " << cell.iphi << std::endl;
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - entries: " << cell.entries << std::endl;
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - lhs: \n"
+                    << lhs[i] << std::endl;
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - rhs: \n"
+                    << rhs[i] << std::endl;
         }
 
-      } // z-loop
-    } // r-loop
-  } // phi-loop
+        hentries->SetBinContent(cell.iphi + 1, cell.ir + 1, cell.iz + 1, cell.entries);
+        fill(hphi.get(), cell, result[i](0), error[i](0));
+        fill(hz.get(), cell, result[i](1), error[i](1));
+        fill(hr.get(), cell, result[i](2), error[i](2));
+
+        if (Verbosity())
+        {
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dphi: " << result[i](0) << " +/- " << error[i](0) << std::endl;
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dz: " << result[i](1) << " +/- " << error[i](1) << std::endl;
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dr: " << result[i](2) << " +/- " << error[i](2) << std::endl;
+          std::cout << std::endl;
+        }
+      }
+      break;
+    }
+
+    case InversionMode::ReducedInversion_phi:
+    case InversionMode::ReducedInversion_z:
+    {
+      /* number of coordinates must match that of the matrix container */
+      static constexpr int ncoord = 2;
+      using matrix_t = Eigen::Matrix<float, ncoord, ncoord>;
+      using column_t = Eigen::Matrix<float, ncoord, 1>;
+
+      // build contiguous rphi and z eigen matrices from container
+      std::vector<matrix_t> lhs_rphi(ncells);
+      std::vector<column_t> rhs_rphi(ncells);
+      std::vector<matrix_t> lhs_z(ncells);
+      std::vector<column_t> rhs_z(ncells);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+      for (int i = 0; i < ncells; ++i)
+      {
+        lhs_rphi[i] = get_matrix<&TpcSpaceChargeMatrixContainer::get_lhs_rphi, ncoord>(m_matrix_container.get(), cells[i].index);
+        rhs_rphi[i] = get_column<&TpcSpaceChargeMatrixContainer::get_rhs_rphi, ncoord>(m_matrix_container.get(), cells[i].index);
+        lhs_z[i] = get_matrix<&TpcSpaceChargeMatrixContainer::get_lhs_z, ncoord>(m_matrix_container.get(), cells[i].index);
+        rhs_z[i] = get_column<&TpcSpaceChargeMatrixContainer::get_rhs_z, ncoord>(m_matrix_container.get(), cells[i].index);
+      }
+
+      // invert
+      std::vector<column_t> result_rphi;
+      std::vector<column_t> error_rphi;
+      solve_cells<ncoord>(lhs_rphi, rhs_rphi, result_rphi, error_rphi, num_threads);
+
+      std::vector<column_t> result_z;
+      std::vector<column_t> error_z;
+      solve_cells<ncoord>(lhs_z, rhs_z, result_z, error_z, num_threads);
+
+      // fill histograms
+      for (int i = 0; i < ncells; ++i)
+      {
+        const auto& cell = cells[i];
+        hentries->SetBinContent(cell.iphi + 1, cell.ir + 1, cell.iz + 1, cell.entries);
+        fill(hphi.get(), cell, result_rphi[i](0), error_rphi[i](0));
+        fill(hz.get(), cell, result_z[i](0), error_z[i](0));
+
+        if (inversionMode == InversionMode::ReducedInversion_phi)
+        {
+          fill(hr.get(), cell, result_rphi[i](1), error_rphi[i](1));
+        }
+        else if (inversionMode == InversionMode::ReducedInversion_z)
+        {
+          fill(hr.get(), cell, result_z[i](1), error_z[i](1));
+        }
+
+        if (Verbosity())
+        {
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dphi: " << result_rphi[i](0) << " +/- " << error_rphi[i](0) << std::endl;
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dz: " << result_z[i](0) << " +/- " << error_z[i](0) << std::endl;
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dr (rphi): " << result_rphi[i](1) << " +/- " << error_rphi[i](1) << std::endl;
+          std::cout << "TpcSpaceChargeMatrixInversion::calculate_distortion_corrections - dr (z): " << result_z[i](1) << " +/- " << error_z[i](1) << std::endl;
+          std::cout << std::endl;
+        }
+      }
+      break;
+    }
+  }
 
   // split histograms in two along z axis and write
   // also write histograms suitable for space charge reconstruction
@@ -12,6 +12,8 @@
 #include <tpc/TpcDistortionCorrectionContainer.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * \class TpcSpaceChargeMatrixInversion
@@ -39,6 +41,19 @@ class TpcSpaceChargeMatrixInversion : public Fun4AllBase
   /// add space charge correction matrix, loaded from file, to current. Returns true on success
   bool add_from_file(const std::string& /*filename*/, const std::string& /*objectname*/ = "TpcSpaceChargeMatrixContainer");
 
+  /// add space charge correction matrices, loaded from several files, to current. Returns true on success
+  /**
+   * files are read in parallel, each thread accumulating its own partial sum, that are merged at the end.
+   * Result is identical to calling add_from_file for each file, up to float rounding from the summation order
+   */
+  bool add_from_files(const std::vector<std::string>& /*filenames*/, const std::string& /*objectname*/ = "TpcSpaceChargeMatrixContainer");
+
+  /// number of threads used for reading files and inverting matrices. 0 means use OpenMP default
+  void set_num_threads(int value)
+  {
+    m_num_threads = value;
+  }
+
   enum class InversionMode
   {
     FullInversion,        // use 3D matrices (phi,z,r)
@@ -47,6 +62,10 @@ class TpcSpaceChargeMatrixInversion : public Fun4AllBase
   };
 
   /// calculate distortions by inverting stored matrices, and save relevant histograms
+  /**
+   * matrices from all cells with enough entries are first copied to contiguous fixed-size Eigen matrices,
+   * then solved in parallel, before histograms are filled
+   */
   void calculate_distortion_corrections(const InversionMode = InversionMode::FullInversion);
 
   /// extrapolate distortions
@@ -58,6 +77,9 @@ class TpcSpaceChargeMatrixInversion : public Fun4AllBase
   //@}
 
  private:
+  /// number of threads
+  int m_num_threads = 0;
+
   /// matrix container
   std::unique_ptr<TpcSpaceChargeMatrixContainer> m_matrix_container;
 
@@ -135,13 +135,22 @@ Surface ActsGeometry::get_tpc_surface_from_coords(
     TrkrDefs::hitsetkey hitsetkey,
     Acts::Vector3 world,
     TrkrDefs::subsurfkey& subsurfkey) const
+{
+  return get_tpc_surface_from_coords(hitsetkey, world, subsurfkey, true);
+}
+
+//________________________________________________________________________________________________
+Surface ActsGeometry::get_tpc_surface_from_coords(
+    TrkrDefs::hitsetkey hitsetkey,
+    const Acts::Vector3& world,
+    TrkrDefs::subsurfkey& subsurfkey,
+    bool use_lookup_table) const
 {
   unsigned int layer = TrkrDefs::getLayer(hitsetkey);
   unsigned int side = TpcDefs::getSide(hitsetkey);
 
-  auto mapIter = m_surfMaps.m_tpcSurfaceMap.find(layer);
-
-  if (mapIter == m_surfMaps.m_tpcSurfaceMap.end())
+  const auto surf_vec_ptr = m_surfMaps.getTpcSurfaces(layer);
+  if (!surf_vec_ptr)
   {
     std::cout << "Error: hitsetkey not found in ActsGeometry::get_tpc_surface_from_coords, hitsetkey = "
               << hitsetkey << std::endl;
@@ -149,9 +158,22 @@ Surface ActsGeometry::get_tpc_surface_from_coords(
   }
   double world_phi = atan2(world[1], world[0]);
 
-  const auto& surf_vec = mapIter->second;
+  const auto& surf_vec = *surf_vec_ptr;
   unsigned int surf_index = 999;
 
+  // surface center azimuth, from lookup table if available
+  const auto surf_phi_vec = use_lookup_table ? m_surfMaps.getTpcSurfacePhi(layer) : nullptr;
+  auto get_surf_phi = [&](unsigned int index)
+  {
+    if (surf_phi_vec)
+    {
+      return (*surf_phi_vec)[index];
+    }
+
+    const auto vec3d = surf_vec[index]->center(m_tGeometry.getGeoContext());
+    return std::atan2(vec3d(1) / 10.0, vec3d(0) / 10.0);  // convert from mm to cm
+  };
+
   // Predict which surface index this phi and side will correspond to
   // assumes that the vector elements are ordered positive z, -pi to pi, then negative z, -pi to pi
   // we use TPC side from the hitsetkey, since z can be either sign in northa nd south, depending on crossing
@@ -166,11 +188,7 @@ Surface ActsGeometry::get_tpc_surface_from_coords(
   }
 
   unsigned int nsurf = nsurfm % surf_vec.size();
-  Surface this_surf = surf_vec[nsurf];
-
-  auto vec3d = this_surf->center(m_tGeometry.getGeoContext());
-  std::vector<double> surf_center = {vec3d(0) / 10.0, vec3d(1) / 10.0, vec3d(2) / 10.0};  // convert from mm to cm
-  double surf_phi = atan2(surf_center[1], surf_center[0]);
+  double surf_phi = get_surf_phi(nsurf);
   double surfStepPhi = m_tGeometry.tpcSurfStepPhi;
 
   if ((world_phi > surf_phi - surfStepPhi / 2.0 && world_phi < surf_phi + surfStepPhi / 2.0))
@@ -181,9 +199,7 @@ Surface ActsGeometry::get_tpc_surface_from_coords(
   else
   {
     // check for the periodic boundary condition
-    auto firstsurf = *surf_vec.begin();
-    auto firstsurfcenter = firstsurf->center(geometry().getGeoContext());
-    float firstsurf_phi = atan2(firstsurfcenter[1], firstsurfcenter[0]);
+    float firstsurf_phi = get_surf_phi(0);
     if (world_phi < firstsurf_phi - surfStepPhi / 2.0)
     {
       world_phi += 2.0 * M_PI;
@@ -196,10 +212,7 @@ Surface ActsGeometry::get_tpc_surface_from_coords(
         continue;
       }
       unsigned int new_nsurf = (nsurf+i) % surf_vec.size();
-      this_surf = surf_vec[new_nsurf];
-      vec3d = this_surf->center(geometry().getGeoContext());
-      surf_center = {vec3d(0) / 10.0, vec3d(1) / 10.0, vec3d(2) / 10.0};  // convert from mm to cm
-      surf_phi = atan2(surf_center[1], surf_center[0]);
+      surf_phi = get_surf_phi(new_nsurf);
 
       if ((world_phi > surf_phi - surfStepPhi / 2.0 && world_phi < surf_phi + surfStepPhi / 2.0))
       {
@@ -214,6 +227,63 @@ Surface ActsGeometry::get_tpc_surface_from_coords(
   return surf_vec[surf_index];
 }
 
+//________________________________________________________________________________________________
+unsigned int ActsGeometry::checkTpcSurfaceLookup() const
+{
+  // check ideal geometry, and aligned geometry if alignment transformations are in use
+  const bool use_alignment = alignmentTransformationContainer::use_alignment;
+  std::vector<bool> alignment_flags = {false};
+  if (use_alignment)
+  {
+    alignment_flags.push_back(true);
+  }
+
+  unsigned int nmismatch = 0;
+  for (const bool flag : alignment_flags)
+  {
+    alignmentTransformationContainer::use_alignment = flag;
+    for (const auto& [layer, surf_vec] : m_surfMaps.m_tpcSurfaceMap)
+    {
+      // surfaces are ordered positive z (side 1) first, then negative z (side 0)
+      for (unsigned int index = 0; index < surf_vec.size(); ++index)
+      {
+        const uint8_t side = (index < surf_vec.size() / 2) ? 1 : 0;
+        const auto hitsetkey = TpcDefs::genHitSetKey(layer, 0, side);
+
+        // probe positions across the surface azimuthal range
+        const auto center = surf_vec[index]->center(m_tGeometry.getGeoContext());
+        const double r = radius(center.x(), center.y());
+        const double center_phi = std::atan2(center.y(), center.x());
+        for (const double fraction : {-0.4, 0., 0.4})
+        {
+          const double phi = center_phi + fraction * m_tGeometry.tpcSurfStepPhi;
+          const Acts::Vector3 world(r * std::cos(phi), r * std::sin(phi), center.z());
+
+          TrkrDefs::subsurfkey subsurfkey_lookup = 0;
+          TrkrDefs::subsurfkey subsurfkey_loop = 0;
+          const auto surf_lookup = get_tpc_surface_from_coords(hitsetkey, world, subsurfkey_lookup, true);
+          const auto surf_loop = get_tpc_surface_from_coords(hitsetkey, world, subsurfkey_loop, false);
+          if (surf_lookup != surf_loop || (surf_loop && subsurfkey_lookup != subsurfkey_loop))
+          {
+            ++nmismatch;
+            std::cout << "ActsGeometry::checkTpcSurfaceLookup - mismatch."
+                      << " use_alignment: " << flag
+                      << " layer: " << layer
+                      << " surface: " << index
+                      << " phi: " << phi
+                      << " lookup: " << subsurfkey_lookup
+                      << " loop: " << subsurfkey_loop
+                      << std::endl;
+          }
+        }
+      }
+    }
+  }
+
+  alignmentTransformationContainer::use_alignment = use_alignment;
+  return nmismatch;
+}
+
 //________________________________________________________________________________________________
 Acts::Transform3 ActsGeometry::makeAffineTransform(Acts::Vector3 rot, Acts::Vector3 trans) const
 {
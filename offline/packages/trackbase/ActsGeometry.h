@@ -23,6 +23,12 @@ class ActsGeometry
     m_surfMaps = surfMaps;
   }
 
+  //! build surface lookup tables, using current geometry context
+  void buildSurfaceLookupTables()
+  {
+    m_surfMaps.buildLookupTables(m_tGeometry.getGeoContext());
+  }
+
   //! const accessor
   const ActsTrackingGeometry& geometry() const
   {
@@ -71,12 +77,26 @@ class ActsGeometry
       Acts::Vector3 world,
       TrkrDefs::subsurfkey& subsurfkey) const ;
 
+  /*!
+   * compare TPC surfaces returned by get_tpc_surface_from_coords using the surface center azimuth lookup tables,
+   * to those obtained by evaluating surface centers directly, for positions across each TPC surface.
+   * Both the ideal and, if in use, the aligned geometry are checked. Returns the number of mismatches
+   */
+  unsigned int checkTpcSurfaceLookup() const;
+
   Acts::Transform3 makeAffineTransform(Acts::Vector3 rotation, Acts::Vector3 translation) const;
 
   Acts::Vector2 getLocalCoords(TrkrDefs::cluskey key, TrkrCluster* cluster) const;
   Acts::Vector2 getLocalCoords(TrkrDefs::cluskey key, TrkrCluster* cluster, short int crossing) const;
 
  private:
+  //! get TPC surface from coordinates, optionally using the surface center azimuth lookup tables
+  Surface get_tpc_surface_from_coords(
+      TrkrDefs::hitsetkey hitsetkey,
+      const Acts::Vector3& world,
+      TrkrDefs::subsurfkey& subsurfkey,
+      bool use_lookup_table) const;
+
   ActsTrackingGeometry m_tGeometry;
   ActsSurfaceMaps m_surfMaps;
   double _drift_velocity = 8.0e-3;  // cm/ns
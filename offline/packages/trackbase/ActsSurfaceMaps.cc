@@ -8,10 +8,15 @@
 #include "InttDefs.h"
 #include "MvtxDefs.h"
 #include "TrkrCluster.h"
+#include "alignmentTransformationContainer.h"
 
 #include <Acts/Definitions/Units.hpp>
 #include <Acts/Surfaces/Surface.hpp>
 
+#include <cmath>
+#include <iostream>
+#include <utility>
+
 namespace
 {
   /// square
@@ -27,6 +32,24 @@ namespace
   {
     return std::sqrt(square(x) + square(y));
   }
+
+  /// true if hitset belongs to silicon detectors
+  bool is_silicon(TrkrDefs::hitsetkey hitsetkey)
+  {
+    const auto trkrid = TrkrDefs::getTrkrId(hitsetkey);
+    return trkrid == TrkrDefs::mvtxId || trkrid == TrkrDefs::inttId;
+  }
+
+  /// phi and z element of a silicon hitset, used to index silicon lookup tables
+  std::pair<unsigned int, unsigned int> silicon_elements(TrkrDefs::hitsetkey hitsetkey)
+  {
+    if (TrkrDefs::getTrkrId(hitsetkey) == TrkrDefs::mvtxId)
+    {
+      return {MvtxDefs::getStaveId(hitsetkey), MvtxDefs::getChipId(hitsetkey)};
+    }
+
+    return {InttDefs::getLadderPhiId(hitsetkey), InttDefs::getLadderZId(hitsetkey)};
+  }
 }  // namespace
 
 bool ActsSurfaceMaps::isTpcSurface(const Acts::Surface* surface) const
@@ -71,6 +94,25 @@ Surface ActsSurfaceMaps::getSurface(TrkrDefs::cluskey key,
 
 Surface ActsSurfaceMaps::getSiliconSurface(TrkrDefs::hitsetkey hitsetkey) const
 {
+  if (!m_siliconSurfaceTable.empty() && is_silicon(hitsetkey))
+  {
+    // crossing and strobe are not part of the table indexing
+    const unsigned int layer = TrkrDefs::getLayer(hitsetkey);
+    if (layer < m_siliconSurfaceTable.size())
+    {
+      const auto& table = m_siliconSurfaceTable[layer];
+      const auto [phi, z] = silicon_elements(hitsetkey);
+      const auto index = phi * table.nz + z;
+      if (z < table.nz && index < table.surfaces.size() && table.surfaces[index])
+      {
+        return table.surfaces[index];
+      }
+    }
+
+    std::cout << "Failed to find silicon surface for hitsetkey " << hitsetkey << std::endl;
+    return nullptr;
+  }
+
   unsigned int trkrid = TrkrDefs::getTrkrId(hitsetkey);
   TrkrDefs::hitsetkey tmpkey = hitsetkey;
 
@@ -105,17 +147,114 @@ Surface ActsSurfaceMaps::getSiliconSurface(TrkrDefs::hitsetkey hitsetkey) const
 Surface ActsSurfaceMaps::getTpcSurface(TrkrDefs::hitsetkey hitsetkey,
                                        TrkrDefs::subsurfkey surfkey) const
 {
-  unsigned int layer = TrkrDefs::getLayer(hitsetkey);
+  const auto surfvec = getTpcSurfaces(TrkrDefs::getLayer(hitsetkey));
+
+  /// If it can't be found, return nullptr to skip this cluster
+  return surfvec ? surfvec->at(surfkey) : nullptr;
+}
+
+const SurfaceVec* ActsSurfaceMaps::getTpcSurfaces(unsigned int layer) const
+{
+  if (!m_tpcSurfaceTable.empty())
+  {
+    return (layer < m_tpcSurfaceTable.size() && !m_tpcSurfaceTable[layer].empty()) ? &m_tpcSurfaceTable[layer] : nullptr;
+  }
+
   const auto iter = m_tpcSurfaceMap.find(layer);
+  return (iter == m_tpcSurfaceMap.end()) ? nullptr : &iter->second;
+}
 
-  if (iter != m_tpcSurfaceMap.end())
+const std::vector<double>* ActsSurfaceMaps::getTpcSurfacePhi(unsigned int layer) const
+{
+  const auto& table = alignmentTransformationContainer::use_alignment ? m_tpcSurfacePhiTableAligned : m_tpcSurfacePhiTableIdeal;
+  return (layer < table.size() && !table[layer].empty()) ? &table[layer] : nullptr;
+}
+
+void ActsSurfaceMaps::buildLookupTables(const Acts::GeometryContext& geoContext)
+{
+  // silicon
+  m_siliconSurfaceTable.clear();
+  for (const auto& [hitsetkey, surface] : m_siliconSurfaceMap)
   {
-    auto surfvec = iter->second;
-    return surfvec.at(surfkey);
+    const unsigned int layer = TrkrDefs::getLayer(hitsetkey);
+    const auto [phi, z] = silicon_elements(hitsetkey);
+    if (layer >= m_siliconSurfaceTable.size())
+    {
+      m_siliconSurfaceTable.resize(layer + 1);
+    }
+
+    auto& table = m_siliconSurfaceTable[layer];
+    if (z >= table.nz)
+    {
+      // re-layout existing surfaces with the larger number of z elements
+      const unsigned int nz = z + 1;
+      SurfaceVec surfaces((table.nz > 0 ? table.surfaces.size() / table.nz : 0) * nz);
+      for (size_t index = 0; index < table.surfaces.size(); ++index)
+      {
+        surfaces[(index / table.nz) * nz + index % table.nz] = std::move(table.surfaces[index]);
+      }
+      table.surfaces = std::move(surfaces);
+      table.nz = nz;
+    }
+
+    const auto index = phi * table.nz + z;
+    if (index >= table.surfaces.size())
+    {
+      table.surfaces.resize((phi + 1) * table.nz);
+    }
+    table.surfaces[index] = surface;
   }
 
-  /// If it can't be found, return nullptr to skip this cluster
-  return nullptr;
+  // tpc
+  m_tpcSurfaceTable.clear();
+  for (const auto& [layer, surfaces] : m_tpcSurfaceMap)
+  {
+    if (layer >= m_tpcSurfaceTable.size())
+    {
+      m_tpcSurfaceTable.resize(layer + 1);
+    }
+
+    m_tpcSurfaceTable[layer] = surfaces;
+  }
+
+  /*
+   * store surface center azimuth, consistently with ActsGeometry::get_tpc_surface_from_coords.
+   * Surface centers depend on whether alignment transformations are used or not.
+   * Since the flag can be changed after the tables are built (e.g. by the TPC clusterizer),
+   * one table is filled for the ideal geometry, and one for the aligned geometry, if available
+   */
+  const bool use_alignment = alignmentTransformationContainer::use_alignment;
+  alignmentTransformationContainer::use_alignment = false;
+  fillTpcSurfacePhiTable(geoContext, m_tpcSurfacePhiTableIdeal);
+
+  m_tpcSurfacePhiTableAligned.clear();
+  if (use_alignment)
+  {
+    alignmentTransformationContainer::use_alignment = true;
+    fillTpcSurfacePhiTable(geoContext, m_tpcSurfacePhiTableAligned);
+  }
+
+  alignmentTransformationContainer::use_alignment = use_alignment;
+}
+
+void ActsSurfaceMaps::fillTpcSurfacePhiTable(const Acts::GeometryContext& geoContext, std::vector<std::vector<double>>& table) const
+{
+  table.clear();
+  for (const auto& [layer, surfaces] : m_tpcSurfaceMap)
+  {
+    if (layer >= table.size())
+    {
+      table.resize(layer + 1);
+    }
+
+    auto& phi_vec = table[layer];
+    phi_vec.reserve(surfaces.size());
+    for (const auto& surface : surfaces)
+    {
+      const auto center = surface->center(geoContext);
+      phi_vec.push_back(std::atan2(center(1) / 10.0, center(0) / 10.0));
+    }
+  }
 }
 
 Surface ActsSurfaceMaps::getMMSurface(TrkrDefs::hitsetkey hitsetkey) const
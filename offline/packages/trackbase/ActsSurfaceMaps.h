@@ -11,6 +11,7 @@
 
 /// Acts includes to create all necessary definitions
 #include <Acts/Definitions/Algebra.hpp>
+#include <Acts/Geometry/GeometryContext.hpp>
 #include <Acts/Utilities/BinnedArray.hpp>
 #include <Acts/Utilities/Logger.hpp>
 
@@ -49,6 +50,25 @@ struct ActsSurfaceMaps
 
   Surface getMMSurface(TrkrDefs::hitsetkey hitsetkey) const;
 
+  //! TPC surfaces for a given layer, nullptr if not found
+  const SurfaceVec* getTpcSurfaces(unsigned int layer) const;
+
+  /*!
+   * azimuth of the TPC surface centers for a given layer,
+   * for the ideal or aligned geometry depending on alignmentTransformationContainer::use_alignment.
+   * nullptr if lookup tables are not built
+   */
+  const std::vector<double>* getTpcSurfacePhi(unsigned int layer) const;
+
+  /*!
+   * build flat lookup tables for silicon and TPC surfaces from the maps below,
+   * so that surfaces are found by direct indexing rather than map searches.
+   * Must be called once the maps are filled. Until then, surfaces are searched in the maps.
+   * The geometry context is used to store the TPC surface center azimuth, both for the ideal geometry,
+   * and, if alignmentTransformationContainer::use_alignment is set, for the aligned geometry
+   */
+  void buildLookupTables(const Acts::GeometryContext& geoContext);
+
   //! map hitset to Surface for the silicon detectors (MVTX and INTT)
   std::map<TrkrDefs::hitsetkey, Surface> m_siliconSurfaceMap;
 
@@ -68,6 +88,29 @@ struct ActsSurfaceMaps
   //! stores all acts volume ids relevant to the micromegas
   /** it is used to quickly tell if a given Acts Surface belongs to micromegas */
   std::set<int> m_micromegasVolumeIds;
+
+  //! flat silicon surface lookup table for a given layer, indexed by phi and z element
+  struct SiliconLayerTable
+  {
+    unsigned int nz = 0;
+    SurfaceVec surfaces;
+  };
+
+  //! silicon surface lookup tables, indexed by layer
+  std::vector<SiliconLayerTable> m_siliconSurfaceTable;
+
+  //! TPC surfaces, indexed by layer
+  std::vector<SurfaceVec> m_tpcSurfaceTable;
+
+  //! TPC surface center azimuth, ideal geometry, indexed by layer, then surface index
+  std::vector<std::vector<double>> m_tpcSurfacePhiTableIdeal;
+
+  //! TPC surface center azimuth, aligned geometry, indexed by layer, then surface index
+  std::vector<std::vector<double>> m_tpcSurfacePhiTableAligned;
+
+ private:
+  //! fill TPC surface center azimuth table, using current alignment flag
+  void fillTpcSurfacePhiTable(const Acts::GeometryContext& geoContext, std::vector<std::vector<double>>& table) const;
 };
 
 #endif
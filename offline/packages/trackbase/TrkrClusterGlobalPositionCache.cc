@@ -0,0 +1,14 @@
+/**
+ * @file trackbase/TrkrClusterGlobalPositionCache.cc
+ * @brief per event cache of cluster global positions, shared across tracking modules
+ */
+
+#include "TrkrClusterGlobalPositionCache.h"
+
+//_________________________________________________________________________
+void TrkrClusterGlobalPositionCache::identify(std::ostream& os) const
+{
+  os << "-----TrkrClusterGlobalPositionCache-----" << std::endl;
+  os << "Number of cached positions: " << size() << std::endl;
+  os << "------------------------------" << std::endl;
+}
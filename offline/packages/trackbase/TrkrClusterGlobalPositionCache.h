@@ -0,0 +1,104 @@
+#ifndef TRACKBASE_TRKRCLUSTERGLOBALPOSITIONCACHE_H
+#define TRACKBASE_TRKRCLUSTERGLOBALPOSITIONCACHE_H
+
+/**
+ * @file trackbase/TrkrClusterGlobalPositionCache.h
+ * @brief per event cache of cluster global positions, shared across tracking modules
+ */
+
+#include <Acts/Definitions/Algebra.hpp>
+
+#include <phool/PHObject.h>
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <unordered_map>
+
+class TrkrCluster;
+
+/**
+ * @brief per event cache of cluster global positions
+ *
+ * Positions are keyed by cluster, beam crossing and a bit mask of the corrections applied,
+ * so that modules configured with different corrections do not share entries.
+ * Clusters are identified by address rather than cluster key, since the same key can be used
+ * for different clusters in different cluster containers (e.g. CORRECTED_TRKR_CLUSTER).
+ *
+ * It is a transient object, stored in a PHDataNode, and is not saved to DST.
+ * It is reset at the end of each event, and must be reset by any module that modifies clusters in place
+ */
+class TrkrClusterGlobalPositionCache : public PHObject
+{
+ public:
+  //! constructor
+  TrkrClusterGlobalPositionCache() = default;
+
+  //! destructor
+  ~TrkrClusterGlobalPositionCache() override = default;
+
+  //! identify
+  void identify(std::ostream& os = std::cout) const override;
+
+  //! clear all positions. Memory is kept for next event
+  void Reset() override
+  {
+    m_positions.clear();
+  }
+
+  //! valid
+  int isValid() const override { return 1; }
+
+  //! number of cached positions
+  std::size_t size() const { return m_positions.size(); }
+
+  //! reserve space for a given number of positions
+  void reserve(std::size_t value) { m_positions.reserve(value); }
+
+  //! get position. Returns false if not found
+  bool find(const TrkrCluster* cluster, short int crossing, unsigned int corrections, Acts::Vector3& position) const
+  {
+    const auto iter = m_positions.find({cluster, crossing, corrections});
+    if (iter == m_positions.end())
+    {
+      return false;
+    }
+
+    position = iter->second;
+    return true;
+  }
+
+  //! store position
+  void insert(const TrkrCluster* cluster, short int crossing, unsigned int corrections, const Acts::Vector3& position)
+  {
+    m_positions.insert_or_assign({cluster, crossing, corrections}, position);
+  }
+
+ private:
+  //! position key
+  struct Key
+  {
+    const TrkrCluster* cluster = nullptr;
+    short int crossing = 0;
+    unsigned int corrections = 0;
+
+    bool operator==(const Key& other) const
+    {
+      return cluster == other.cluster && crossing == other.crossing && corrections == other.corrections;
+    }
+  };
+
+  //! position key hash
+  struct KeyHash
+  {
+    std::size_t operator()(const Key& key) const
+    {
+      return std::hash<const TrkrCluster*>()(key.cluster) ^ (static_cast<std::size_t>(static_cast<unsigned short>(key.crossing)) << 8U) ^ (static_cast<std::size_t>(key.corrections) << 24U);
+    }
+  };
+
+  //! cached positions
+  std::unordered_map<Key, Acts::Vector3, KeyHash> m_positions;
+};
+
+#endif  // TRACKBASE_TRKRCLUSTERGLOBALPOSITIONCACHE_H
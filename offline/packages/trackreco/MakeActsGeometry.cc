@@ -290,6 +290,14 @@ int MakeActsGeometry::InitRun(PHCompositeNode *topNode)
   }
   alignment_transformation.createMap(topNode);
 
+  // build flat surface lookup tables, once alignment transformations are in place
+  m_actsGeometry->buildSurfaceLookupTables();
+  if (Verbosity())
+  {
+    const auto nmismatch = m_actsGeometry->checkTpcSurfaceLookup();
+    std::cout << "MakeActsGeometry::InitRun - TPC surface lookup check: " << nmismatch << " mismatches" << std::endl;
+  }
+
   for (auto &[layer, factor] : m_misalignmentFactor)
   {
     alignment_transformation.misalignmentFactor(layer, factor);
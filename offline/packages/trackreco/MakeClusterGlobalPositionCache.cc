@@ -0,0 +1,110 @@
+/*!
+ * \file MakeClusterGlobalPositionCache.cc
+ * \brief creates the per event cluster global position cache and fills it in bulk
+ */
+
+#include "MakeClusterGlobalPositionCache.h"
+
+#include <trackbase/TrkrClusterContainer.h>
+#include <trackbase/TrkrClusterGlobalPositionCache.h>
+
+#include <fun4all/Fun4AllReturnCodes.h>
+
+#include <phool/PHCompositeNode.h>
+#include <phool/PHDataNode.h>
+#include <phool/PHNodeIterator.h>
+#include <phool/getClass.h>
+#include <phool/phool.h>
+
+#include <chrono>
+#include <iostream>
+
+//____________________________________________________________________________..
+MakeClusterGlobalPositionCache::MakeClusterGlobalPositionCache(const std::string &name)
+  : SubsysReco(name)
+{
+}
+
+//____________________________________________________________________________..
+int MakeClusterGlobalPositionCache::InitRun(PHCompositeNode *topNode)
+{
+  const auto ret = createNodes(topNode);
+  if (ret != Fun4AllReturnCodes::EVENT_OK)
+  {
+    return ret;
+  }
+
+  m_globalPositionWrapper.set_verbosity(Verbosity());
+  m_globalPositionWrapper.loadNodes(topNode);
+  return Fun4AllReturnCodes::EVENT_OK;
+}
+
+//____________________________________________________________________________..
+int MakeClusterGlobalPositionCache::process_event(PHCompositeNode *topNode)
+{
+  auto clusterContainer = findNode::getClass<TrkrClusterContainer>(topNode, m_clusterContainerName);
+  if (!clusterContainer)
+  {
+    std::cout << PHWHERE << " missing " << m_clusterContainerName << ", doing nothing" << std::endl;
+    return Fun4AllReturnCodes::EVENT_OK;
+  }
+
+  // distortion correction containers can be created after InitRun
+  m_globalPositionWrapper.loadNodes(topNode);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  // collect clusters
+  m_clusters.clear();
+  for (const auto &hitsetkey : clusterContainer->getHitSetKeys())
+  {
+    const auto range = clusterContainer->getClusters(hitsetkey);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+      m_clusters.emplace_back(iter->first, iter->second);
+    }
+  }
+
+  // fill
+  m_cache->Reset();
+  m_globalPositionWrapper.fillCache(m_clusters, 0, m_nthreads);
+
+  if (Verbosity() > 0)
+  {
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "MakeClusterGlobalPositionCache::process_event - cached " << m_cache->size() << " positions in " << elapsed.count() << " ms" << std::endl;
+  }
+
+  return Fun4AllReturnCodes::EVENT_OK;
+}
+
+//____________________________________________________________________________..
+int MakeClusterGlobalPositionCache::createNodes(PHCompositeNode *topNode)
+{
+  m_cache = findNode::getClass<TrkrClusterGlobalPositionCache>(topNode, "TRKR_CLUSTERGLOBALPOSITIONCACHE");
+  if (m_cache)
+  {
+    return Fun4AllReturnCodes::EVENT_OK;
+  }
+
+  PHNodeIterator iter(topNode);
+  auto dstNode = dynamic_cast<PHCompositeNode *>(iter.findFirst("PHCompositeNode", "DST"));
+  if (!dstNode)
+  {
+    std::cout << PHWHERE << "DST Node missing, doing nothing." << std::endl;
+    return Fun4AllReturnCodes::ABORTRUN;
+  }
+
+  PHNodeIterator dstiter(dstNode);
+  auto trkrNode = dynamic_cast<PHCompositeNode *>(dstiter.findFirst("PHCompositeNode", "TRKR"));
+  if (!trkrNode)
+  {
+    trkrNode = new PHCompositeNode("TRKR");
+    dstNode->addNode(trkrNode);
+  }
+
+  // transient node, not saved to DST, but reset at the end of each event
+  m_cache = new TrkrClusterGlobalPositionCache;
+  trkrNode->addNode(new PHDataNode<PHObject>(m_cache, "TRKR_CLUSTERGLOBALPOSITIONCACHE", "PHObject"));
+  return Fun4AllReturnCodes::EVENT_OK;
+}
@@ -0,0 +1,67 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef TRACKRECO_MAKECLUSTERGLOBALPOSITIONCACHE_H
+#define TRACKRECO_MAKECLUSTERGLOBALPOSITIONCACHE_H
+
+/*!
+ * \file MakeClusterGlobalPositionCache.h
+ * \brief creates the per event cluster global position cache and fills it in bulk
+ */
+
+#include <tpc/TpcGlobalPositionWrapper.h>
+
+#include <fun4all/SubsysReco.h>
+
+#include <string>
+
+class PHCompositeNode;
+class TrkrClusterGlobalPositionCache;
+
+/*!
+ * creates the TRKR_CLUSTERGLOBALPOSITIONCACHE node, and fills it at each event with the
+ * distortion corrected global position of all clusters, for crossing zero.
+ * All modules using TpcGlobalPositionWrapper then read positions from the cache rather than recomputing them,
+ * and store positions calculated for other crossings or corrections.
+ * Must be registered after clustering and distortion correction loading, and before any module that uses the cache
+ */
+class MakeClusterGlobalPositionCache : public SubsysReco
+{
+ public:
+  MakeClusterGlobalPositionCache(const std::string &name = "MakeClusterGlobalPositionCache");
+
+  int InitRun(PHCompositeNode *topNode) override;
+  int process_event(PHCompositeNode *topNode) override;
+
+  //! number of threads used to fill the cache
+  void set_nthreads(unsigned int value) { m_nthreads = value; }
+
+  //! cluster container name
+  void setTrkrClusterContainerName(const std::string &name) { m_clusterContainerName = name; }
+
+  //!@name distortion corrections used for bulk filling
+  //@{
+  void set_enable_module_edge_corr(bool flag) { m_globalPositionWrapper.set_enable_module_edge_corr(flag); }
+  void set_enable_static_corr(bool flag) { m_globalPositionWrapper.set_enable_static_corr(flag); }
+  void set_enable_average_corr(bool flag) { m_globalPositionWrapper.set_enable_average_corr(flag); }
+  void set_enable_fluctuation_corr(bool flag) { m_globalPositionWrapper.set_enable_fluctuation_corr(flag); }
+  //@}
+
+ private:
+  //! create cache node
+  int createNodes(PHCompositeNode *topNode);
+
+  //! cache
+  TrkrClusterGlobalPositionCache *m_cache = nullptr;
+
+  //! global position wrapper
+  TpcGlobalPositionWrapper m_globalPositionWrapper;
+
+  //! cluster list, kept across events
+  TpcGlobalPositionWrapper::ClusterList m_clusters;
+
+  unsigned int m_nthreads = 1;
+
+  std::string m_clusterContainerName = "TRKR_CLUSTER";
+};
+
+#endif
@@ -6,6 +6,7 @@
 
 #include <trackbase/TrkrCluster.h>  // for TrkrCluster
 #include <trackbase/TrkrClusterContainer.h>
+#include <trackbase/TrkrClusterGlobalPositionCache.h>
 #include <trackbase_historic/TrackSeed.h>
 #include <trackbase_historic/TrackSeedContainer.h>
 #include <trackbase_historic/TrackSeedHelper.h>
@@ -74,6 +75,14 @@ int PHTpcDeltaZCorrection::process_event(PHCompositeNode* topNode)
   }
 
   process_tracks();
+
+  // clusters are modified in place, invalidate cached global positions
+  auto cache = findNode::getClass<TrkrClusterGlobalPositionCache>(topNode, "TRKR_CLUSTERGLOBALPOSITIONCACHE");
+  if (cache)
+  {
+    cache->Reset();
+  }
+
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
@@ -23,6 +23,7 @@
 #include <phool/PHNode.h>
 #include <phool/PHNodeIterator.h>
 #include <phool/PHObject.h>
+#include <phool/PHTimer.h>
 #include <phool/getClass.h>
 #include <phool/phool.h>
 
@@ -41,9 +42,35 @@
 #include <string>
 #include <utility>
 
+namespace
+{
+  // peak - pedestal of the trigger samples of one channel, adc holds the waveform samples
+  template <typename T>
+  void fill_peak_sub_ped(unsigned int *peak_sub_ped, const T *adc, int sample_start, int sample_end, int sub_delay)
+  {
+    for (int i = sample_start; i < sample_end; i++)
+    {
+      int16_t maxim = (adc[i] > adc[i + 1] ? adc[i] : adc[i + 1]);
+      maxim = (maxim > adc[i + 2] ? maxim : adc[i + 2]);
+      uint16_t sam = 0;
+      if (i >= sub_delay)
+      {
+        sam = i - sub_delay;
+      }
+      unsigned int sub = 0;
+      if (maxim > adc[sam])
+      {
+        sub = (((uint16_t) (maxim - adc[sam])) & 0x3fffU);
+      }
+      peak_sub_ped[i - sample_start] = sub;
+    }
+  }
+}  // namespace
+
 // constructor
 CaloTriggerEmulator::CaloTriggerEmulator(const std::string &name)
   : SubsysReco(name)
+  , m_timer(new PHTimer("CaloTriggerEmulator"))
 {
   // is data flag is not used right now
 
@@ -74,23 +101,6 @@ CaloTriggerEmulator::CaloTriggerEmulator(const std::string &name)
     m_l1_slewing_table[i] = (i) & 0x3ffU;
   }
 
-  for (int i = 0; i < 24576; i++)
-  {
-    unsigned int key = TowerInfoDefs::encode_emcal(i);
-    h_emcal_lut[key] = nullptr;
-  }
-
-  for (int i = 0; i < 1536; i++)
-  {
-    unsigned int key = TowerInfoDefs::encode_hcal(i);
-    h_hcalin_lut[key] = nullptr;
-  }
-  for (int i = 0; i < 1536; i++)
-  {
-    unsigned int key = TowerInfoDefs::encode_hcal(i);
-    h_hcalout_lut[key] = nullptr;
-  }
-
   // Set HCAL LL1 lookup table for the cosmic coincidence trigger.
   if (m_triggerid == TriggerDefs::TriggerId::cosmic_coinTId)
   {
@@ -212,6 +222,11 @@ CaloTriggerEmulator::CaloTriggerEmulator(const std::string &name)
   m_masks_fiber = {};    //, 70385696};
 }
 
+CaloTriggerEmulator::~CaloTriggerEmulator()
+{
+  delete m_timer;
+}
+
 // check whether a channel has been masked
 bool CaloTriggerEmulator::CheckChannelMasks(TriggerDefs::TriggerSumKey key)
 {
@@ -404,6 +419,47 @@ int CaloTriggerEmulator::InitRun(PHCompositeNode *topNode)
     return Fun4AllReturnCodes::ABORTRUN;
   }
 
+  // flat peak minus pedestal storage, indexed by channel and trigger sample
+  m_n_peak_samples = (m_trig_sample > 0 ? 1 : m_nsamples - 1);
+  if (m_do_emcal)
+  {
+    m_peak_sub_ped_emcal.assign(m_n_emcal_channels * m_n_peak_samples, 0);
+  }
+  if (m_do_hcalin)
+  {
+    m_peak_sub_ped_hcalin.assign(m_n_hcal_channels * m_n_peak_samples, 0);
+  }
+  if (m_do_hcalout)
+  {
+    m_peak_sub_ped_hcalout.assign(m_n_hcal_channels * m_n_peak_samples, 0);
+  }
+
+  // channel numbers of the 4 towers in every sum, so the sums do not go through the tower keys
+  m_sum_channels_emcal.clear();
+  for (int ip = 0; ip < m_prim_map[TriggerDefs::DetectorId::emcalDId]; ip++)
+  {
+    for (int isum = 0; isum < m_n_sums; isum++)
+    {
+      for (int j = 0; j < 4; j++)
+      {
+        unsigned int key = TriggerDefs::GetTowerInfoKey(TriggerDefs::DetectorId::emcalDId, ip, isum, j);
+        m_sum_channels_emcal.push_back(TowerInfoDefs::decode_emcal(key));
+      }
+    }
+  }
+  m_sum_channels_hcal.clear();
+  for (int ip = 0; ip < m_prim_map[TriggerDefs::DetectorId::hcalDId]; ip++)
+  {
+    for (int isum = 0; isum < m_n_sums; isum++)
+    {
+      for (int j = 0; j < 4; j++)
+      {
+        unsigned int key = TriggerDefs::GetTowerInfoKey(TriggerDefs::DetectorId::hcalDId, ip, isum, j);
+        m_sum_channels_hcal.push_back(TowerInfoDefs::decode_hcal(key));
+      }
+    }
+  }
+
   CreateNodes(topNode);
 
   return 0;
@@ -451,15 +507,12 @@ int CaloTriggerEmulator::Download_Calibrations()
     if (cdbttree_emcal)
     {
       cdbttree_emcal->LoadCalibrations();
-
-      for (int i = 0; i < 24576; i++)
-      {
-        std::string histoname = "h_emcal_lut_" + std::to_string(i);
-        unsigned int key = TowerInfoDefs::encode_emcal(i);
-        h_emcal_lut[key] = cdbttree_emcal->getHisto(histoname);
-      }
     }
   }
+  if (m_do_emcal)
+  {
+    fill_lut(m_lut_emcal, m_lut_stride_emcal, m_default_lut_emcal ? nullptr : cdbttree_emcal, "h_emcal_lut_", m_n_emcal_channels);
+  }
   if (m_do_hcalin && !m_default_lut_hcalin)
   {
     if (!m_hcalin_lutname.empty())
@@ -482,15 +535,12 @@ int CaloTriggerEmulator::Download_Calibrations()
     if (cdbttree_hcalin)
     {
       cdbttree_hcalin->LoadCalibrations();
-
-      for (int i = 0; i < 1536; i++)
-      {
-        std::string histoname = "h_hcalin_lut_" + std::to_string(i);
-        unsigned int key = TowerInfoDefs::encode_hcal(i);
-        h_hcalin_lut[key] = cdbttree_hcalin->getHisto(histoname);
-      }
     }
   }
+  if (m_do_hcalin)
+  {
+    fill_lut(m_lut_hcalin, m_lut_stride_hcalin, m_default_lut_hcalin ? nullptr : cdbttree_hcalin, "h_hcalin_lut_", m_n_hcal_channels);
+  }
   if (m_do_hcalout && !m_default_lut_hcalout)
   {
     if (!m_hcalout_lutname.empty())
@@ -513,17 +563,44 @@ int CaloTriggerEmulator::Download_Calibrations()
     if (cdbttree_hcalout)
     {
       cdbttree_hcalout->LoadCalibrations();
-
-      for (int i = 0; i < 1536; i++)
-      {
-        std::string histoname = "h_hcalout_lut_" + std::to_string(i);
-        unsigned int key = TowerInfoDefs::encode_hcal(i);
-        h_hcalout_lut[key] = cdbttree_hcalout->getHisto(histoname);
-      }
     }
   }
+  if (m_do_hcalout)
+  {
+    fill_lut(m_lut_hcalout, m_lut_stride_hcalout, m_default_lut_hcalout ? nullptr : cdbttree_hcalout, "h_hcalout_lut_", m_n_hcal_channels);
+  }
   return 0;
 }
+
+void CaloTriggerEmulator::fill_lut(std::vector<uint8_t> &lut, unsigned int &stride, CDBHistos *histos, const std::string &histoprefix, unsigned int nchannels)
+{
+  // the tables hold the 8 bit value that goes into the sums, ((lut & 0x3ff) >> 2)
+  if (!histos)
+  {
+    // one identity table shared by all channels
+    stride = 0;
+    lut.resize(1024);
+    for (unsigned int i = 0; i < 1024; i++)
+    {
+      lut[i] = (m_l1_adc_table[i] >> 2U) & 0xffU;
+    }
+    return;
+  }
+
+  stride = 1024;
+  lut.resize(nchannels * stride);
+  for (unsigned int ichannel = 0; ichannel < nchannels; ichannel++)
+  {
+    std::string histoname = histoprefix + std::to_string(ichannel);
+    TH1 *h_lut = histos->getHisto(histoname);
+    for (unsigned int i = 0; i < 1024; i++)
+    {
+      unsigned int lut_output = (h_lut ? (unsigned int) h_lut->GetBinContent(i + 1) : m_l1_adc_table[i]) & 0x3ffU;
+      lut[ichannel * stride + i] = (lut_output >> 2U) & 0xffU;
+    }
+  }
+}
+
 // process event procedure
 int CaloTriggerEmulator::process_event(PHCompositeNode *topNode)
 {
@@ -532,12 +609,15 @@ int CaloTriggerEmulator::process_event(PHCompositeNode *topNode)
     std::cout << __FUNCTION__ << ": event " << m_nevent << std::endl;
   }
 
+  m_timer->restart();
+
   // Get all nodes needed fo
   GetNodes(topNode);
 
   // process waveforms from the waveform container into primitives
   if (process_waveforms())
   {
+    m_timer->stop();
     return Fun4AllReturnCodes::EVENT_OK;
   }
 
@@ -552,15 +632,18 @@ int CaloTriggerEmulator::process_event(PHCompositeNode *topNode)
   // calculate the true LL1 trigger at emcal and hcal.
   if (process_organizer())
   {
+    m_timer->stop();
     return Fun4AllReturnCodes::EVENT_OK;
   }
 
   // calculate the true LL1 trigger algorithm.
   if (process_trigger())
   {
+    m_timer->stop();
     return Fun4AllReturnCodes::EVENT_OK;
   }
 
+  m_timer->stop();
   m_nevent++;
 
   if (Verbosity() >= 2)
@@ -574,10 +657,10 @@ int CaloTriggerEmulator::process_event(PHCompositeNode *topNode)
 // RESET event procedure that takes all variables to 0 and clears the primitives.
 int CaloTriggerEmulator::ResetEvent(PHCompositeNode * /*topNode*/)
 {
-  // here, the peak minus pedestal map is cleanly disposed of
-  m_peak_sub_ped_emcal.clear();
-  m_peak_sub_ped_hcalin.clear();
-  m_peak_sub_ped_hcalout.clear();
+  // channels without data (suppressed, skipped or missing) keep a peak minus pedestal of 0
+  std::fill(m_peak_sub_ped_emcal.begin(), m_peak_sub_ped_emcal.end(), 0);
+  std::fill(m_peak_sub_ped_hcalin.begin(), m_peak_sub_ped_hcalin.end(), 0);
+  std::fill(m_peak_sub_ped_hcalout.begin(), m_peak_sub_ped_hcalout.end(), 0);
 
   return 0;
 }
@@ -591,6 +674,9 @@ int CaloTriggerEmulator::process_offline()
     sample_end = m_trig_sample + 1;
   }
 
+  // the peak finding looks two samples ahead
+  std::vector<int> adc(sample_end + 2, 0);
+
   if (m_do_emcal)
   {
     if (Verbosity())
@@ -621,68 +707,23 @@ int CaloTriggerEmulator::process_offline()
             unsigned int adcboard = (unsigned int) channel / 64;
             if ((adc_skip_mask >> adcboard) & 0x1U)
             {
-              for (int iskip = 0; iskip < 64; iskip++)
-              {
-                std::vector<unsigned int> v_peak_sub_ped;
-                for (int i = sample_start; i < sample_end; i++)
-                {
-                  v_peak_sub_ped.push_back(0);
-                }
-                unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-                m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
-                iwave++;
-              }
-            }
-          }
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              v_peak_sub_ped.push_back(0);
+              // skipped boards stay at 0
+              iwave += 64;
             }
           }
-          else
+          if (!packet->iValue(channel, "SUPPRESSED") && iwave < m_n_emcal_channels)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
+              adc[i] = packet->iValue(i, channel);
             }
+            fill_peak_sub_ped(&m_peak_sub_ped_emcal[iwave * m_n_peak_samples], adc.data(), sample_start, sample_end, m_trig_sub_delay);
           }
-          unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-          m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
           iwave++;
         }
         if (nchannels < 192 && !(adc_skip_mask < 4))
         {
-          for (int iskip = 0; iskip < 192 - nchannels; iskip++)
-          {
-            std::vector<unsigned int> v_peak_sub_ped;
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              v_peak_sub_ped.push_back(0);
-            }
-            unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-            m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
-            iwave++;
-          }
+          iwave += 192 - nchannels;
         }
       }
     }
@@ -709,40 +750,14 @@ int CaloTriggerEmulator::process_offline()
 
         for (int channel = 0; channel < nchannels; channel++)
         {
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              v_peak_sub_ped.push_back(0);
-            }
-          }
-          else
+          if (!packet->iValue(channel, "SUPPRESSED") && iwave < m_n_hcal_channels)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
+              adc[i] = packet->iValue(i, channel);
             }
+            fill_peak_sub_ped(&m_peak_sub_ped_hcalout[iwave * m_n_peak_samples], adc.data(), sample_start, sample_end, m_trig_sub_delay);
           }
-          unsigned int key = TowerInfoDefs::encode_hcal(iwave);
-          m_peak_sub_ped_hcalout[key] = v_peak_sub_ped;
           iwave++;
         }
       }
@@ -768,40 +783,14 @@ int CaloTriggerEmulator::process_offline()
 
         for (int channel = 0; channel < nchannels; channel++)
         {
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              v_peak_sub_ped.push_back(0);
-            }
-          }
-          else
+          if (!packet->iValue(channel, "SUPPRESSED") && iwave < m_n_hcal_channels)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
+              adc[i] = packet->iValue(i, channel);
             }
+            fill_peak_sub_ped(&m_peak_sub_ped_hcalin[iwave * m_n_peak_samples], adc.data(), sample_start, sample_end, m_trig_sub_delay);
           }
-          unsigned int key = TowerInfoDefs::encode_hcal(iwave);
-          m_peak_sub_ped_hcalin[key] = v_peak_sub_ped;
           iwave++;
         }
       }
@@ -846,6 +835,9 @@ int CaloTriggerEmulator::process_waveforms()
     sample_end = m_trig_sample + 1;
   }
 
+  // the peak finding looks two samples ahead
+  std::vector<int> adc(sample_end + 2, 0);
+
   if (m_do_emcal)
   {
     if (Verbosity())
@@ -870,54 +862,19 @@ int CaloTriggerEmulator::process_waveforms()
             unsigned int adcboard = (unsigned int) channel / 64;
             if ((adc_skip_mask >> adcboard) & 0x1U)
             {
-              for (int iskip = 0; iskip < 64; iskip++)
-              {
-                std::vector<unsigned int> v_peak_sub_ped;
-                for (int i = sample_start; i < sample_end; i++)
-                {
-                  v_peak_sub_ped.push_back(0);
-                }
-                unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-                m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
-                iwave++;
-              }
+              // skipped boards stay at 0
+              iwave += 64;
               continue;
             }
           }
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              v_peak_sub_ped.push_back(0);
-            }
-          }
-          else
+          if (!packet->iValue(channel, "SUPPRESSED") && iwave < m_n_emcal_channels)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
+              adc[i] = packet->iValue(i, channel);
             }
+            fill_peak_sub_ped(&m_peak_sub_ped_emcal[iwave * m_n_peak_samples], adc.data(), sample_start, sample_end, m_trig_sub_delay);
           }
-          unsigned int key = TowerInfoDefs::encode_emcal(iwave);
-          m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
           iwave++;
         }
       }
@@ -941,40 +898,14 @@ int CaloTriggerEmulator::process_waveforms()
 
         for (int channel = 0; channel < nchannels; channel++)
         {
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
+          if (!packet->iValue(channel, "SUPPRESSED") && iwave < m_n_hcal_channels)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              v_peak_sub_ped.push_back(0);
+              adc[i] = packet->iValue(i, channel);
             }
+            fill_peak_sub_ped(&m_peak_sub_ped_hcalout[iwave * m_n_peak_samples], adc.data(), sample_start, sample_end, m_trig_sub_delay);
           }
-          else
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
-            }
-          }
-          unsigned int key = TowerInfoDefs::encode_hcal(iwave);
-          m_peak_sub_ped_hcalout[key] = v_peak_sub_ped;
           iwave++;
         }
       }
@@ -998,40 +929,14 @@ int CaloTriggerEmulator::process_waveforms()
 
         for (int channel = 0; channel < nchannels; channel++)
         {
-          std::vector<unsigned int> v_peak_sub_ped;
-          if (packet->iValue(channel, "SUPPRESSED"))
+          if (!packet->iValue(channel, "SUPPRESSED") && iwave < m_n_hcal_channels)
           {
-            for (int i = sample_start; i < sample_end; i++)
+            for (int i = 0; i < sample_end + 2; i++)
             {
-              v_peak_sub_ped.push_back(0);
+              adc[i] = packet->iValue(i, channel);
             }
+            fill_peak_sub_ped(&m_peak_sub_ped_hcalin[iwave * m_n_peak_samples], adc.data(), sample_start, sample_end, m_trig_sub_delay);
           }
-          else
-          {
-            for (int i = sample_start; i < sample_end; i++)
-            {
-              int16_t maxim = (packet->iValue(i, channel) > packet->iValue(i + 1, channel) ? packet->iValue(i, channel) : packet->iValue(i + 1, channel));
-              maxim = (maxim > packet->iValue(i + 2, channel) ? maxim : packet->iValue(i + 2, channel));
-              uint16_t sam = 0;
-              if (i >= m_trig_sub_delay)
-              {
-                sam = i - m_trig_sub_delay;
-              }
-              else
-              {
-                sam = 0;
-              }
-              unsigned int sub = 0;
-              if (maxim > packet->iValue(sam, channel))
-              {
-                sub = (((uint16_t) (maxim - packet->iValue(sam, channel))) & 0x3fffU);
-              }
-
-              v_peak_sub_ped.push_back(sub);
-            }
-          }
-          unsigned int key = TowerInfoDefs::encode_hcal(iwave);
-          m_peak_sub_ped_hcalin[key] = v_peak_sub_ped;
           iwave++;
         }
       }
@@ -1058,6 +963,9 @@ int CaloTriggerEmulator::process_sim()
     sample_end = m_trig_sample + 1;
   }
 
+  // the peak finding looks two samples ahead
+  std::vector<int16_t> adc(sample_end + 2, 0);
+
   if (m_do_emcal)
   {
     if (Verbosity())
@@ -1069,44 +977,19 @@ int CaloTriggerEmulator::process_sim()
       return Fun4AllReturnCodes::EVENT_OK;
     }
     // for each waveform, clauclate the peak - pedestal given the sub-delay setting
-    for (unsigned int iwave = 0; iwave < (unsigned int) m_waveforms_emcal->size(); iwave++)
+    unsigned int nwaves = std::min((unsigned int) m_waveforms_emcal->size(), m_n_emcal_channels);
+    for (unsigned int iwave = 0; iwave < nwaves; iwave++)
     {
-      std::vector<unsigned int> v_peak_sub_ped;
       TowerInfo *tower = m_waveforms_emcal->get_tower_at_channel(iwave);
-      unsigned int key = TowerInfoDefs::encode_emcal(iwave);
       if (tower->get_isZS())
       {
-        for (int i = sample_start; i < sample_end; i++)
-        {
-          v_peak_sub_ped.push_back(0);
-        }
+        continue;
       }
-      else
+      for (int i = 0; i < sample_end + 2; i++)
       {
-        for (int i = sample_start; i < sample_end; i++)
-        {
-          int16_t maxim = (tower->get_waveform_value(i) > tower->get_waveform_value(i + 1) ? tower->get_waveform_value(i) : tower->get_waveform_value(i + 1));
-          maxim = (maxim > tower->get_waveform_value(i + 2) ? maxim : tower->get_waveform_value(i + 2));
-          uint16_t sam = 0;
-          if (i >= m_trig_sub_delay)
-          {
-            sam = i - m_trig_sub_delay;
-          }
-          else
-          {
-            sam = 0;
-          }
-          unsigned int sub = 0;
-          if (maxim > tower->get_waveform_value(sam))
-          {
-            sub = (((uint16_t) (maxim - tower->get_waveform_value(sam))) & 0x3fffU);
-          }
-
-          v_peak_sub_ped.push_back(sub);
-        }
+        adc[i] = tower->get_waveform_value(i);
       }
-      // save in global.
-      m_peak_sub_ped_emcal[key] = v_peak_sub_ped;
+      fill_peak_sub_ped(&m_peak_sub_ped_emcal[iwave * m_n_peak_samples], adc.data(), sample_start, sample_end, m_trig_sub_delay);
     }
   }
   if (m_do_hcalout)
@@ -1116,51 +999,25 @@ int CaloTriggerEmulator::process_sim()
       std::cout << __FILE__ << "::" << __FUNCTION__ << ":: ohcal" << std::endl;
     }
 
-    std::vector<int> wave;
     // for each waveform, clauclate the peak - pedestal given the sub-delay setting
     if (!m_waveforms_hcalout->size())
     {
       return Fun4AllReturnCodes::EVENT_OK;
     }
 
-    for (unsigned int iwave = 0; iwave < (unsigned int) m_waveforms_hcalout->size(); iwave++)
+    unsigned int nwaves = std::min((unsigned int) m_waveforms_hcalout->size(), m_n_hcal_channels);
+    for (unsigned int iwave = 0; iwave < nwaves; iwave++)
     {
-      std::vector<unsigned int> v_peak_sub_ped;
       TowerInfo *tower = m_waveforms_hcalout->get_tower_at_channel(iwave);
-      unsigned int key = TowerInfoDefs::encode_hcal(iwave);
       if (tower->get_isZS())
       {
-        for (int i = sample_start; i < sample_end; i++)
-        {
-          v_peak_sub_ped.push_back(0);
-        }
+        continue;
       }
-      else
+      for (int i = 0; i < sample_end + 2; i++)
       {
-        for (int i = sample_start; i < sample_end; i++)
-        {
-          int16_t maxim = (tower->get_waveform_value(i) > tower->get_waveform_value(i + 1) ? tower->get_waveform_value(i) : tower->get_waveform_value(i + 1));
-          maxim = (maxim > tower->get_waveform_value(i + 2) ? maxim : tower->get_waveform_value(i + 2));
-          uint16_t sam = 0;
-          if (i >= m_trig_sub_delay)
-          {
-            sam = i - m_trig_sub_delay;
-          }
-          else
-          {
-            sam = 0;
-          }
-          unsigned int sub = 0;
-          if (maxim > tower->get_waveform_value(sam))
-          {
-            sub = (((uint16_t) (maxim - tower->get_waveform_value(sam))) & 0x3fffU);
-          }
-
-          v_peak_sub_ped.push_back(sub);
-        }
+        adc[i] = tower->get_waveform_value(i);
       }
-      // save in global.
-      m_peak_sub_ped_hcalout[key] = v_peak_sub_ped;
+      fill_peak_sub_ped(&m_peak_sub_ped_hcalout[iwave * m_n_peak_samples], adc.data(), sample_start, sample_end, m_trig_sub_delay);
     }
   }
   if (m_do_hcalin)
@@ -1173,52 +1030,21 @@ int CaloTriggerEmulator::process_sim()
     {
       return Fun4AllReturnCodes::EVENT_OK;
     }
-    if (Verbosity())
-    {
-      std::cout << __FILE__ << "::" << __FUNCTION__ << ":: ihcal" << std::endl;
-    }
-
-    std::vector<unsigned int> wave;
 
     // for each waveform, clauclate the peak - pedestal given the sub-delay setting
-    for (unsigned int iwave = 0; iwave < (unsigned int) m_waveforms_hcalin->size(); iwave++)
+    unsigned int nwaves = std::min((unsigned int) m_waveforms_hcalin->size(), m_n_hcal_channels);
+    for (unsigned int iwave = 0; iwave < nwaves; iwave++)
     {
-      std::vector<unsigned int> v_peak_sub_ped;
       TowerInfo *tower = m_waveforms_hcalin->get_tower_at_channel(iwave);
-      unsigned int key = TowerInfoDefs::encode_hcal(iwave);
       if (tower->get_isZS())
       {
-        for (int i = sample_start; i < sample_end; i++)
-        {
-          v_peak_sub_ped.push_back(0);
-        }
+        continue;
       }
-      else
+      for (int i = 0; i < sample_end + 2; i++)
       {
-        for (int i = sample_start; i < sample_end; i++)
-        {
-          int16_t maxim = (tower->get_waveform_value(i) > tower->get_waveform_value(i + 1) ? tower->get_waveform_value(i) : tower->get_waveform_value(i + 1));
-          maxim = (maxim > tower->get_waveform_value(i + 2) ? maxim : tower->get_waveform_value(i + 2));
-          uint16_t sam = 0;
-          if (i >= m_trig_sub_delay)
-          {
-            sam = i - m_trig_sub_delay;
-          }
-          else
-          {
-            sam = 0;
-          }
-          unsigned int sub = 0;
-          if (maxim > tower->get_waveform_value(sam))
-          {
-            sub = (((uint16_t) (maxim - tower->get_waveform_value(sam))) & 0x3fffU);
-          }
-
-          v_peak_sub_ped.push_back(sub);
-        }
+        adc[i] = tower->get_waveform_value(i);
       }
-      // save in global.
-      m_peak_sub_ped_hcalin[key] = v_peak_sub_ped;
+      fill_peak_sub_ped(&m_peak_sub_ped_hcalin[iwave * m_n_peak_samples], adc.data(), sample_start, sample_end, m_trig_sub_delay);
     }
   }
 
@@ -1228,14 +1054,8 @@ int CaloTriggerEmulator::process_sim()
 // procedure to process the peak - pedestal into primitives.
 int CaloTriggerEmulator::process_primitives()
 {
-  int ip;
-  int i;
   bool mask;
-  int nsample = m_nsamples - 1;
-  if (m_trig_sample > 0)
-  {
-    nsample = 1;
-  }
+  int nsample = m_n_peak_samples;
 
   if (Verbosity())
   {
@@ -1249,17 +1069,10 @@ int CaloTriggerEmulator::process_primitives()
       std::cout << __FILE__ << "::" << __FUNCTION__ << ":: Processing primitives:: emcal" << std::endl;
     }
 
-    ip = 0;
-
     // get the number of primitives needed to process
     m_n_primitives = m_prim_map[TriggerDefs::DetectorId::emcalDId];
-    for (i = 0; i < m_n_primitives; i++, ip++)
+    for (int ip = 0; ip < m_n_primitives; ip++)
     {
-      if (Verbosity())
-      {
-        std::cout << __FILE__ << "::" << __FUNCTION__ << ":: Processing primitives:: adding " << i << std::endl;
-      }
-      unsigned int tmp = 0;
       // get the primitive key of what we are making, in order of the packet ID and channel number
       TriggerDefs::TriggerPrimKey primkey = TriggerDefs::getTriggerPrimKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("EMCAL"), TriggerDefs::GetPrimitiveId("EMCAL"), ip);
 
@@ -1280,39 +1093,27 @@ int CaloTriggerEmulator::process_primitives()
 
         // check to mask channel (if fiber masked, automatically mask the channel)
         bool mask_channel = mask || CheckChannelMasks(sumkey);
+
+        // if masked, just fill with 0s
+        if (mask_channel)
+        {
+          t_sum->resize(nsample, 0);
+          continue;
+        }
+
+        const unsigned int *channels = &m_sum_channels_emcal[4 * (ip * m_n_sums + isum)];
         for (int is = 0; is < nsample; is++)
         {
-          sum = 0;
           unsigned int temp_sum = 0;
-
-          // if masked, just fill with 0s
-          if (!mask_channel)
+          for (int j = 0; j < 4; j++)
           {
-            for (int j = 0; j < 4; j++)
-            {
-              // unsigned int iwave = 64*ip + isum*4 + j;
-              unsigned int key = TriggerDefs::GetTowerInfoKey(TriggerDefs::GetDetectorId("EMCAL"), ip, isum, j);
-              unsigned int lut_input = (m_peak_sub_ped_emcal[key].at(is) >> 4U) & 0x3ffU;
-              if (m_default_lut_emcal)
-              {
-                tmp = (m_l1_adc_table[lut_input] >> 2U);
-              }
-              else
-              {
-                unsigned int lut_output = ((unsigned int) h_emcal_lut[key]->GetBinContent(lut_input + 1)) & 0x3ffU;
-                tmp = (lut_output >> 2U);
-              }
-              temp_sum += (tmp & 0xffU);
-            }
-            sum = ((temp_sum & 0x3ffU) >> 2U) & 0xffU;
-            if (Verbosity() >= 10 && sum >= 1)
-            {
-              std::cout << __FILE__ << "::" << __FUNCTION__ << ":: emcal sum " << sumkey << " = " << sum << std::endl;
-            }
+            unsigned int lut_input = (m_peak_sub_ped_emcal[channels[j] * nsample + is] >> 4U) & 0x3ffU;
+            temp_sum += m_lut_emcal[channels[j] * m_lut_stride_emcal + lut_input];
           }
-          if (Verbosity())
+          sum = ((temp_sum & 0x3ffU) >> 2U) & 0xffU;
+          if (Verbosity() >= 10 && sum >= 1)
           {
-            std::cout << __FILE__ << "::" << __FUNCTION__ << ":: Processing primitives:: adding" << std::endl;
+            std::cout << __FILE__ << "::" << __FUNCTION__ << ":: emcal sum " << sumkey << " = " << sum << std::endl;
           }
 
           t_sum->push_back(sum);
@@ -1327,11 +1128,9 @@ int CaloTriggerEmulator::process_primitives()
       std::cout << __FILE__ << "::" << __FUNCTION__ << ":: Processing primitives:: ohcal" << std::endl;
     }
 
-    ip = 0;
-
     m_n_primitives = m_prim_map[TriggerDefs::DetectorId::hcaloutDId];
 
-    for (i = 0; i < m_n_primitives; i++, ip++)
+    for (int ip = 0; ip < m_n_primitives; ip++)
     {
       TriggerDefs::TriggerPrimKey primkey = TriggerDefs::getTriggerPrimKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("HCALOUT"), TriggerDefs::GetPrimitiveId("HCALOUT"), ip);
       TriggerPrimitive *primitive = m_primitives_hcalout->get_primitive_at_key(primkey);
@@ -1341,34 +1140,27 @@ int CaloTriggerEmulator::process_primitives()
       {
         TriggerDefs::TriggerSumKey sumkey = TriggerDefs::getTriggerSumKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("HCALOUT"), TriggerDefs::GetPrimitiveId("HCALOUT"), ip, isum);
         std::vector<unsigned int> *t_sum = primitive->get_sum_at_key(sumkey);
+        t_sum->clear();
         mask |= CheckChannelMasks(sumkey);
+        if (mask)
+        {
+          t_sum->resize(nsample, 0);
+          continue;
+        }
+
+        const unsigned int *channels = &m_sum_channels_hcal[4 * (ip * m_n_sums + isum)];
         for (int is = 0; is < nsample; is++)
         {
-          sum = 0;
           unsigned int temp_sum = 0;
-          if (!mask)
+          for (int j = 0; j < 4; j++)
           {
-            for (int j = 0; j < 4; j++)
-            {
-              unsigned int key = TriggerDefs::GetTowerInfoKey(TriggerDefs::GetDetectorId("HCAL"), ip, isum, j);
-              unsigned int lut_input = (m_peak_sub_ped_hcalout[key].at(is) >> 4U) & 0x3ffU;
-              unsigned int tmp = 0;
-              if (m_default_lut_hcalout)
-              {
-                tmp = (m_l1_adc_table[lut_input] >> 2U);
-              }
-              else
-              {
-                unsigned int lut_output = ((unsigned int) h_hcalout_lut[key]->GetBinContent(lut_input + 1)) & 0x3ffU;
-                tmp = (lut_output >> 2U);
-              }
-              temp_sum += (tmp & 0xffU);
-            }
-            sum = ((temp_sum & 0x3ffU) >> 2U) & 0xffU;
-            if (Verbosity() >= 10 && sum >= 1)
-            {
-              std::cout << __FILE__ << "::" << __FUNCTION__ << ":: hcalout sum " << sumkey << " = " << sum << std::endl;
-            }
+            unsigned int lut_input = (m_peak_sub_ped_hcalout[channels[j] * nsample + is] >> 4U) & 0x3ffU;
+            temp_sum += m_lut_hcalout[channels[j] * m_lut_stride_hcalout + lut_input];
+          }
+          sum = ((temp_sum & 0x3ffU) >> 2U) & 0xffU;
+          if (Verbosity() >= 10 && sum >= 1)
+          {
+            std::cout << __FILE__ << "::" << __FUNCTION__ << ":: hcalout sum " << sumkey << " = " << sum << std::endl;
           }
           t_sum->push_back(sum);
         }
@@ -1377,8 +1169,6 @@ int CaloTriggerEmulator::process_primitives()
   }
   if (m_do_hcalin)
   {
-    ip = 0;
-
     if (Verbosity())
     {
       std::cout << __FILE__ << "::" << __FUNCTION__ << ":: Processing primitives:: ihcal" << std::endl;
@@ -1386,7 +1176,7 @@ int CaloTriggerEmulator::process_primitives()
 
     m_n_primitives = m_prim_map[TriggerDefs::DetectorId::hcalinDId];
 
-    for (i = 0; i < m_n_primitives; i++, ip++)
+    for (int ip = 0; ip < m_n_primitives; ip++)
     {
       TriggerDefs::TriggerPrimKey primkey = TriggerDefs::getTriggerPrimKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("HCALIN"), TriggerDefs::GetPrimitiveId("HCALIN"), ip);
       TriggerPrimitive *primitive = m_primitives_hcalin->get_primitive_at_key(primkey);
@@ -1396,34 +1186,27 @@ int CaloTriggerEmulator::process_primitives()
       {
         TriggerDefs::TriggerSumKey sumkey = TriggerDefs::getTriggerSumKey(TriggerDefs::GetTriggerId("NONE"), TriggerDefs::GetDetectorId("HCALIN"), TriggerDefs::GetPrimitiveId("HCALIN"), ip, isum);
         std::vector<unsigned int> *t_sum = primitive->get_sum_at_key(sumkey);
+        t_sum->clear();
         mask |= CheckChannelMasks(sumkey);
+        if (mask)
+        {
+          t_sum->resize(nsample, 0);
+          continue;
+        }
+
+        const unsigned int *channels = &m_sum_channels_hcal[4 * (ip * m_n_sums + isum)];
         for (int is = 0; is < nsample; is++)
         {
-          sum = 0;
           unsigned int temp_sum = 0;
-          if (!mask)
+          for (int j = 0; j < 4; j++)
           {
-            for (int j = 0; j < 4; j++)
-            {
-              unsigned int key = TriggerDefs::GetTowerInfoKey(TriggerDefs::GetDetectorId("HCAL"), ip, isum, j);
-              unsigned int lut_input = (m_peak_sub_ped_hcalin[key].at(is) >> 4U) & 0x3ffU;
-              unsigned int tmp = 0;
-              if (m_default_lut_hcalin)
-              {
-                tmp = (m_l1_adc_table[lut_input] >> 2U);
-              }
-              else
-              {
-                unsigned int lut_output = ((unsigned int) h_hcalin_lut[key]->GetBinContent(lut_input + 1)) & 0x3ffU;
-                tmp = (lut_output >> 2U);
-              }
-              temp_sum += (tmp & 0x3ffU);
-            }
-            sum = ((temp_sum & 0xfffU) >> 2U) & 0xffU;
-            if (Verbosity() >= 10 && sum >= 1)
-            {
-              std::cout << __FILE__ << "::" << __FUNCTION__ << ":: hcalin sum " << sumkey << " = " << sum << std::endl;
-            }
+            unsigned int lut_input = (m_peak_sub_ped_hcalin[channels[j] * nsample + is] >> 4U) & 0x3ffU;
+            temp_sum += m_lut_hcalin[channels[j] * m_lut_stride_hcalin + lut_input];
+          }
+          sum = ((temp_sum & 0xfffU) >> 2U) & 0xffU;
+          if (Verbosity() >= 10 && sum >= 1)
+          {
+            std::cout << __FILE__ << "::" << __FUNCTION__ << ":: hcalin sum " << sumkey << " = " << sum << std::endl;
           }
           t_sum->push_back(sum);
         }
@@ -2437,6 +2220,8 @@ int CaloTriggerEmulator::End(PHCompositeNode * /*topNode*/)
   delete cdbttree_hcalout;
   delete cdbttree_hcalin;
 
+  m_timer->print_stat();
+
   std::cout << "------------------------" << std::endl;
   std::cout << "Total Jet passed: " << m_jet_npassed << "/" << m_nevent << std::endl;
   std::cout << "Total Photon passed: " << m_photon_npassed << "/" << m_nevent << std::endl;
@@ -5,6 +5,7 @@
 
 #include <fun4all/SubsysReco.h>
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -18,7 +19,7 @@ class Event;
 class TowerInfoContainer;
 class CaloPacketContainer;
 class PHCompositeNode;
-class TH1;
+class PHTimer;
 
 class CaloTriggerEmulator : public SubsysReco
 {
@@ -27,7 +28,7 @@ class CaloTriggerEmulator : public SubsysReco
   explicit CaloTriggerEmulator(const std::string &name);
 
   //! destructor
-  ~CaloTriggerEmulator() override = default;
+  ~CaloTriggerEmulator() override;
 
   //! full initialization
   int Init(PHCompositeNode *) override;
@@ -66,6 +67,9 @@ class CaloTriggerEmulator : public SubsysReco
 
   int Download_Calibrations();
 
+  //! flatten the LUT histograms (or the default table if histos is null) into lut
+  void fill_lut(std::vector<uint8_t> &lut, unsigned int &stride, CDBHistos *histos, const std::string &histoprefix, unsigned int nchannels);
+
   //! Set TriggerType
   void setTriggerType(const std::string &name);
   void setTriggerType(TriggerDefs::TriggerId triggerid);
@@ -195,18 +199,32 @@ class CaloTriggerEmulator : public SubsysReco
   unsigned int m_l1_8x8_table[1024]{};
   unsigned int m_l1_slewing_table[4096]{};
 
-  std::map<unsigned int, TH1 *> h_emcal_lut{};
-  std::map<unsigned int, TH1 *> h_hcalin_lut{};
-  std::map<unsigned int, TH1 *> h_hcalout_lut{};
+  //! LUT output per channel (stride 1024) or one table for all channels (stride 0)
+  std::vector<uint8_t> m_lut_emcal{};
+  std::vector<uint8_t> m_lut_hcalin{};
+  std::vector<uint8_t> m_lut_hcalout{};
+  unsigned int m_lut_stride_emcal{0};
+  unsigned int m_lut_stride_hcalin{0};
+  unsigned int m_lut_stride_hcalout{0};
+
+  //! channel numbers of the 4 towers of each sum, in primitive and sum order
+  std::vector<unsigned int> m_sum_channels_emcal{};
+  std::vector<unsigned int> m_sum_channels_hcal{};
 
   CDBTTree *cdbttree_adcmask{nullptr};
   CDBHistos *cdbttree_emcal{nullptr};
   CDBHistos *cdbttree_hcalin{nullptr};
   CDBHistos *cdbttree_hcalout{nullptr};
 
-  std::map<unsigned int, std::vector<unsigned int>> m_peak_sub_ped_emcal{};
-  std::map<unsigned int, std::vector<unsigned int>> m_peak_sub_ped_hcalin{};
-  std::map<unsigned int, std::vector<unsigned int>> m_peak_sub_ped_hcalout{};
+  //! peak - pedestal, [channel * m_n_peak_samples + sample]
+  std::vector<unsigned int> m_peak_sub_ped_emcal{};
+  std::vector<unsigned int> m_peak_sub_ped_hcalin{};
+  std::vector<unsigned int> m_peak_sub_ped_hcalout{};
+  int m_n_peak_samples{0};
+  unsigned int m_n_emcal_channels{24576};
+  unsigned int m_n_hcal_channels{1536};
+
+  PHTimer *m_timer{nullptr};
 
   //! Verbosity.
   int m_nevent{0};
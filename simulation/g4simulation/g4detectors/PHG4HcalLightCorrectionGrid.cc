@@ -0,0 +1,35 @@
+#include "PHG4HcalLightCorrectionGrid.h"
+
+#include <TH2.h>
+
+void PHG4HcalLightCorrectionGrid::SetMap(const unsigned int itile, const TH2 *hist)
+{
+  if (itile >= m_Maps.size())
+  {
+    m_Maps.resize(itile + 1);
+  }
+  Map &tilemap = m_Maps[itile];
+  tilemap = Map();
+  if (!hist)
+  {
+    return;
+  }
+  // appended at the end, the values of a replaced map are simply not referenced anymore
+  tilemap.offset = m_Values.size();
+  tilemap.nx = hist->GetNbinsX();
+  tilemap.ny = hist->GetNbinsY();
+  m_Values.reserve(m_Values.size() + static_cast<std::size_t>(tilemap.nx) * tilemap.ny);
+  for (int iy = 1; iy <= tilemap.ny; iy++)
+  {
+    for (int ix = 1; ix <= tilemap.nx; ix++)
+    {
+      m_Values.push_back(hist->GetBinContent(ix, iy));
+    }
+  }
+}
+
+void PHG4HcalLightCorrectionGrid::Reset()
+{
+  m_Maps.clear();
+  m_Values.clear();
+}
@@ -0,0 +1,65 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef G4DETECTORS_PHG4HCALLIGHTCORRECTIONGRID_H
+#define G4DETECTORS_PHG4HCALLIGHTCORRECTIONGRID_H
+
+#include <cstddef>
+#include <vector>
+
+class TH2;
+
+/*!
+  \class PHG4HcalLightCorrectionGrid
+  \brief flat copy of the per tile (tower) light collection efficiency maps
+
+  The maps are copied once from their TH2 at initialization, the stepping actions then
+  look up a bin with direct index arithmetic instead of TH2::GetBinContent
+*/
+class PHG4HcalLightCorrectionGrid
+{
+ public:
+  PHG4HcalLightCorrectionGrid() = default;
+  ~PHG4HcalLightCorrectionGrid() = default;
+
+  //! copy the bin contents of hist as map of tile itile, a nullptr removes the map
+  void SetMap(const unsigned int itile, const TH2 *hist);
+
+  //! true if tile itile has a map
+  bool HasMap(const unsigned int itile) const
+  {
+    return itile < m_Maps.size() && m_Maps[itile].nx > 0;
+  }
+
+  //! number of bins of the map of tile itile
+  int GetNbinsX(const unsigned int itile) const { return m_Maps[itile].nx; }
+  int GetNbinsY(const unsigned int itile) const { return m_Maps[itile].ny; }
+
+  //! correction for tile itile in bin (ix, iy), numbered like TH2 bins starting at 1.
+  //! Returns 0 outside of the map
+  double GetCorrection(const unsigned int itile, const int ix, const int iy) const
+  {
+    const Map &tilemap = m_Maps[itile];
+    if (ix < 1 || ix > tilemap.nx || iy < 1 || iy > tilemap.ny)
+    {
+      return 0.;
+    }
+    return m_Values[tilemap.offset + static_cast<std::size_t>(iy - 1) * tilemap.nx + (ix - 1)];
+  }
+
+  void Reset();
+
+ private:
+  struct Map
+  {
+    std::size_t offset{0};
+    int nx{0};
+    int ny{0};
+  };
+
+  std::vector<Map> m_Maps;
+
+  //! bin contents of all maps, row by row
+  std::vector<double> m_Values;
+};
+
+#endif
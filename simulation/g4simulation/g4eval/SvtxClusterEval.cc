@@ -23,6 +23,7 @@
 
 #include <TVector3.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
@@ -64,9 +65,147 @@ void SvtxClusterEval::next_event(PHCompositeNode* topNode)
   _cache_best_cluster_from_gtrackid_layer.clear();
   _clusters_per_layer.clear();
   //  _g4hits_per_layer.clear();
+  _bulk_cluster_truth.clear();
+  _bulk_clusters_from_g4hit.clear();
+  _bulk_clusters_from_particle.clear();
+  _bulk_filled = false;
   _hiteval.next_event(topNode);
 
   get_node_pointers(topNode);
+
+  if (_do_bulk_cache && has_node_pointers())
+  {
+    fill_bulk_tables();
+  }
+}
+
+void SvtxClusterEval::fill_bulk_tables()
+{
+  if (!_cluster_hit_map || !_hit_truth_map)
+  {
+    ++_errors;
+    return;
+  }
+
+  auto Mytimer = std::make_unique<PHTimer>("BulkCl_timer");
+  Mytimer->stop();
+  Mytimer->restart();
+
+  _bulk_cluster_truth.reserve(_clustermap->size());
+
+  std::multimap<TrkrDefs::hitsetkey, std::pair<TrkrDefs::hitkey, PHG4HitDefs::keytype>> temp_map;
+  for (const auto& hitsetkey : _clustermap->getHitSetKeys())
+  {
+    // the g4hit container only depends on the detector, resolve it once per hitset
+    PHG4HitContainer* g4hits = nullptr;
+    switch (TrkrDefs::getTrkrId(hitsetkey))
+    {
+    case TrkrDefs::tpcId:
+      g4hits = _g4hits_tpc;
+      break;
+    case TrkrDefs::inttId:
+      g4hits = _g4hits_intt;
+      break;
+    case TrkrDefs::mvtxId:
+      g4hits = _g4hits_mvtx;
+      break;
+    case TrkrDefs::micromegasId:
+      g4hits = _g4hits_mms;
+      break;
+    default:
+      break;
+    }
+
+    auto range = _clustermap->getClusters(hitsetkey);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+      const TrkrDefs::cluskey cluster_key = iter->first;
+      BulkClusterTruth& record = _bulk_cluster_truth[cluster_key];
+
+      if (g4hits)
+      {
+        const auto hitrange = _cluster_hit_map->getHits(cluster_key);
+        for (auto clushititer = hitrange.first; clushititer != hitrange.second; ++clushititer)
+        {
+          temp_map.clear();
+          _hit_truth_map->getG4Hits(hitsetkey, clushititer->second, temp_map);
+          for (const auto& htiter : temp_map)
+          {
+            PHG4Hit* g4hit = g4hits->findHit(htiter.second.second);
+            if (g4hit)
+            {
+              record.g4hits.push_back(g4hit);
+            }
+          }
+        }
+      }
+
+      // same ordering as the std::set used by the lazy caches, so that
+      // ties in the max-energy searches are resolved identically
+      std::sort(record.g4hits.begin(), record.g4hits.end());
+      record.g4hits.erase(std::unique(record.g4hits.begin(), record.g4hits.end()), record.g4hits.end());
+
+      float max_hit_e = FLT_MAX * -1.0;
+      for (auto g4hit : record.g4hits)
+      {
+        if (g4hit->get_edep() > max_hit_e)
+        {
+          max_hit_e = g4hit->get_edep();
+          record.max_g4hit = g4hit;
+        }
+        _bulk_clusters_from_g4hit[g4hit].push_back(cluster_key);
+
+        PHG4Particle* particle = get_truth_eval()->get_particle(g4hit);
+        if (_strict)
+        {
+          assert(particle);
+        }
+        else if (!particle)
+        {
+          ++_errors;
+          continue;
+        }
+
+        auto piter = std::find_if(record.particle_energies.begin(), record.particle_energies.end(),
+                                  [particle](const auto& entry)
+                                  { return entry.first == particle; });
+        if (piter == record.particle_energies.end())
+        {
+          record.particle_energies.emplace_back(particle, g4hit->get_edep());
+        }
+        else
+        {
+          piter->second += g4hit->get_edep();
+        }
+      }
+
+      std::sort(record.particle_energies.begin(), record.particle_energies.end(),
+                [](const auto& lhs, const auto& rhs)
+                { return lhs.first < rhs.first; });
+
+      float max_particle_e = FLT_MAX * -1.0;
+      for (const auto& [particle, energy] : record.particle_energies)
+      {
+        if (energy > max_particle_e)
+        {
+          max_particle_e = energy;
+          record.max_particle = particle;
+        }
+        _bulk_clusters_from_particle[particle].push_back(cluster_key);
+      }
+    }
+  }
+
+  _bulk_filled = true;
+
+  Mytimer->stop();
+  if (_verbosity > 0)
+  {
+    std::cout << "SvtxClusterEval::fill_bulk_tables - " << _bulk_cluster_truth.size()
+              << " clusters, " << _bulk_clusters_from_g4hit.size() << " g4hits, "
+              << _bulk_clusters_from_particle.size() << " particles in "
+              << Mytimer->elapsed() << " ms" << std::endl;
+  }
 }
 
 std::map<TrkrDefs::cluskey, std::shared_ptr<TrkrCluster>> SvtxClusterEval::all_truth_clusters(TrkrDefs::cluskey cluster_key)
@@ -343,6 +482,15 @@ std::set<PHG4Hit*> SvtxClusterEval::all_truth_hits(TrkrDefs::cluskey cluster_key
     return std::set<PHG4Hit*>();
   }
 
+  if (_bulk_filled)
+  {
+    const auto iter = _bulk_cluster_truth.find(cluster_key);
+    if (iter != _bulk_cluster_truth.end())
+    {
+      return std::set<PHG4Hit*>(iter->second.g4hits.begin(), iter->second.g4hits.end());
+    }
+  }
+
   if (_do_cache)
   {
     std::map<TrkrDefs::cluskey, std::set<PHG4Hit*>>::iterator iter =
@@ -747,6 +895,15 @@ PHG4Hit* SvtxClusterEval::max_truth_hit_by_energy(TrkrDefs::cluskey cluster_key)
     return nullptr;
   }
 
+  if (_bulk_filled)
+  {
+    const auto iter = _bulk_cluster_truth.find(cluster_key);
+    if (iter != _bulk_cluster_truth.end())
+    {
+      return iter->second.max_g4hit;
+    }
+  }
+
   if (_do_cache)
   {
     std::map<TrkrDefs::cluskey, PHG4Hit*>::iterator iter =
@@ -785,6 +942,20 @@ std::set<PHG4Particle*> SvtxClusterEval::all_truth_particles(TrkrDefs::cluskey c
     return std::set<PHG4Particle*>();
   }
 
+  if (_bulk_filled)
+  {
+    const auto iter = _bulk_cluster_truth.find(cluster_key);
+    if (iter != _bulk_cluster_truth.end())
+    {
+      std::set<PHG4Particle*> truth_particles;
+      for (const auto& entry : iter->second.particle_energies)
+      {
+        truth_particles.insert(entry.first);
+      }
+      return truth_particles;
+    }
+  }
+
   if (_do_cache)
   {
     std::map<TrkrDefs::cluskey, std::set<PHG4Particle*>>::iterator iter =
@@ -886,6 +1057,15 @@ PHG4Particle* SvtxClusterEval::max_truth_particle_by_energy(TrkrDefs::cluskey cl
     return nullptr;
   }
 
+  if (_bulk_filled)
+  {
+    const auto iter = _bulk_cluster_truth.find(cluster_key);
+    if (iter != _bulk_cluster_truth.end())
+    {
+      return iter->second.max_particle;
+    }
+  }
+
   if (_do_cache)
   {
     std::map<TrkrDefs::cluskey, PHG4Particle*>::iterator iter =
@@ -936,6 +1116,16 @@ std::set<TrkrDefs::cluskey> SvtxClusterEval::all_clusters_from(PHG4Particle* tru
     ++_errors;
     return std::set<TrkrDefs::cluskey>();
   }
+  if (_bulk_filled)
+  {
+    const auto iter = _bulk_clusters_from_particle.find(truthparticle);
+    if (iter == _bulk_clusters_from_particle.end())
+    {
+      return std::set<TrkrDefs::cluskey>();
+    }
+    return std::set<TrkrDefs::cluskey>(iter->second.begin(), iter->second.end());
+  }
+
   // check if cache is filled, if not fill it.
   //   if(_cache_all_clusters_from_particle.count(truthparticle)==0){
   if (_cache_all_clusters_from_particle.empty())
@@ -1018,6 +1208,16 @@ std::set<TrkrDefs::cluskey> SvtxClusterEval::all_clusters_from(PHG4Hit* truthhit
     return std::set<TrkrDefs::cluskey>();
   }
 
+  if (_bulk_filled)
+  {
+    const auto iter = _bulk_clusters_from_g4hit.find(truthhit);
+    if (iter == _bulk_clusters_from_g4hit.end())
+    {
+      return std::set<TrkrDefs::cluskey>();
+    }
+    return std::set<TrkrDefs::cluskey>(iter->second.begin(), iter->second.end());
+  }
+
   // one time, fill cache of g4hit/cluster pairs
   if (_cache_all_clusters_from_g4hit.size() == 0)
   {
@@ -1277,6 +1477,19 @@ float SvtxClusterEval::get_energy_contribution(TrkrDefs::cluskey cluster_key, PH
     return NAN;
   }
 
+  if (_bulk_filled)
+  {
+    const auto iter = _bulk_cluster_truth.find(cluster_key);
+    if (iter != _bulk_cluster_truth.end())
+    {
+      const auto& energies = iter->second.particle_energies;
+      const auto piter = std::lower_bound(energies.begin(), energies.end(), particle,
+                                          [](const auto& entry, PHG4Particle* p)
+                                          { return entry.first < p; });
+      return (piter != energies.end() && piter->first == particle) ? piter->second : 0.0;
+    }
+  }
+
   if (_do_cache)
   {
     std::map<std::pair<TrkrDefs::cluskey, PHG4Particle*>, float>::iterator iter =
@@ -1324,6 +1537,16 @@ float SvtxClusterEval::get_energy_contribution(TrkrDefs::cluskey cluster_key, PH
     return NAN;
   }
 
+  if (_bulk_filled)
+  {
+    const auto iter = _bulk_cluster_truth.find(cluster_key);
+    if (iter != _bulk_cluster_truth.end())
+    {
+      const auto& g4hits = iter->second.g4hits;
+      return std::binary_search(g4hits.begin(), g4hits.end(), g4hit) ? g4hit->get_edep() : 0.0;
+    }
+  }
+
   if ((_do_cache) &&
       (_cache_get_energy_contribution_g4hit.find(std::make_pair(cluster_key, g4hit)) !=
        _cache_get_energy_contribution_g4hit.end()))
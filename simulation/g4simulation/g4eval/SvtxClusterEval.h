@@ -9,7 +9,9 @@
 #include <map>
 #include <memory>  // for shared_ptr, less
 #include <set>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 class PHCompositeNode;
 
@@ -38,6 +40,9 @@ class SvtxClusterEval
     _do_cache = do_cache;
     _hiteval.do_caching(do_cache);
   }
+  //! build all cluster <-> g4hit <-> particle associations once per event
+  //! in next_event() and serve the truth queries from flat tables
+  void do_bulk_caching(bool do_bulk_cache) { _do_bulk_cache = do_bulk_cache; }
   void set_strict(bool strict)
   {
     _strict = strict;
@@ -90,6 +95,9 @@ class SvtxClusterEval
   //  void fill_g4hit_layer_map();
   bool has_node_pointers();
 
+  //! fill the bulk association tables for all clusters of the event
+  void fill_bulk_tables();
+
   //! Fast approximation of atan2() for cluster searching
   //! From https://www.dsprelated.com/showarticle/1052.php
   float fast_approx_atan2(float y, float x);
@@ -128,6 +136,25 @@ class SvtxClusterEval
   std::map<std::pair<TrkrDefs::cluskey, PHG4Hit*>, float> _cache_get_energy_contribution_g4hit;
   std::map<std::shared_ptr<TrkrCluster>, std::pair<TrkrDefs::cluskey, TrkrCluster*>> _cache_reco_cluster_from_truth_cluster;
 
+  //! truth associations of one reco cluster, filled in bulk mode
+  struct BulkClusterTruth
+  {
+    //! sorted, unique g4hits contributing to the cluster
+    std::vector<PHG4Hit*> g4hits;
+
+    //! contributing particles with their summed g4hit energy, sorted by particle
+    std::vector<std::pair<PHG4Particle*, float>> particle_energies;
+
+    PHG4Hit* max_g4hit = nullptr;
+    PHG4Particle* max_particle = nullptr;
+  };
+
+  bool _do_bulk_cache = false;
+  bool _bulk_filled = false;
+  std::unordered_map<TrkrDefs::cluskey, BulkClusterTruth> _bulk_cluster_truth;
+  std::unordered_map<PHG4Hit*, std::vector<TrkrDefs::cluskey>> _bulk_clusters_from_g4hit;
+  std::unordered_map<PHG4Particle*, std::vector<TrkrDefs::cluskey>> _bulk_clusters_from_particle;
+
   // measured for low occupancy events, all in cm
   const float sig_tpc_rphi_inner = 220e-04;
   const float sig_tpc_rphi_mid = 155e-04;
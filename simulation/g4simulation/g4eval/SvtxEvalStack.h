@@ -25,6 +25,7 @@ class SvtxEvalStack
 
   void next_event(PHCompositeNode* topNode);
   void do_caching(bool do_cache) { _vertexeval.do_caching(do_cache); }
+  void do_bulk_caching(bool do_bulk_cache) { _vertexeval.do_bulk_caching(do_bulk_cache); }
   void set_strict(bool strict) { _vertexeval.set_strict(strict); }
   // void set_over_write_vertexmap(bool over_write) {_vertexeval.set_over_write_vertexmap(over_write);}
   void set_use_initial_vertex(bool use_init_vtx) { _vertexeval.set_use_initial_vertex(use_init_vtx); }
@@ -79,6 +79,7 @@ SvtxEvaluator::SvtxEvaluator(const std::string& /*name*/, const std::string& fil
 SvtxEvaluator::~SvtxEvaluator()
 {
   delete _timer;
+  delete _event_timer;
 }
 
 int SvtxEvaluator::Init(PHCompositeNode* /*topNode*/)
@@ -213,6 +214,9 @@ int SvtxEvaluator::Init(PHCompositeNode* /*topNode*/)
   _timer = new PHTimer("_eval_timer");
   _timer->stop();
 
+  _event_timer = new PHTimer("_eval_event_timer");
+  _event_timer->stop();
+
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
@@ -245,10 +249,13 @@ int SvtxEvaluator::process_event(PHCompositeNode* topNode)
     std::cout << "SvtxEvaluator::process_event - Seed = " << _iseed << std::endl;
   }
 
+  _event_timer->restart();
+
   if (!_svtxevalstack)
   {
     _svtxevalstack = new SvtxEvalStack(topNode);
     _svtxevalstack->set_strict(_strict);
+    _svtxevalstack->do_bulk_caching(_do_bulk_truth_caching);
     _svtxevalstack->set_verbosity(Verbosity());
     _svtxevalstack->set_use_initial_vertex(_use_initial_vertex);
     _svtxevalstack->set_use_genfit_vertex(_use_genfit_vertex);
@@ -277,6 +284,12 @@ int SvtxEvaluator::process_event(PHCompositeNode* topNode)
 
   // printOutputInfo(topNode);
 
+  _event_timer->stop();
+  if (Verbosity() > 1)
+  {
+    std::cout << "SvtxEvaluator::process_event - event time: " << _event_timer->elapsed() << " ms" << std::endl;
+  }
+
   ++_ievent;
   return Fun4AllReturnCodes::EVENT_OK;
 }
@@ -334,6 +347,11 @@ int SvtxEvaluator::End(PHCompositeNode* /*topNode*/)
   {
     std::cout << "========================= SvtxEvaluator::End() ============================" << std::endl;
     std::cout << " " << _ievent << " events of output written to: " << _filename << std::endl;
+    if (_ievent > 0)
+    {
+      std::cout << " average time per event: " << _event_timer->get_accumulated_time() / _ievent << " ms"
+                << (_do_bulk_truth_caching ? " (bulk truth caching)" : "") << std::endl;
+    }
     std::cout << "===========================================================================" << std::endl;
   }
 
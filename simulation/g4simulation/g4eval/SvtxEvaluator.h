@@ -72,6 +72,9 @@ class SvtxEvaluator : public SubsysReco
   void do_vtx_eval_light(bool b) { _do_vtx_eval_light = b; }
   void scan_for_embedded(bool b) { _scan_for_embedded = b; }
   void scan_for_primaries(bool b) { _scan_for_primaries = b; }
+
+  //! build cluster/truth associations once per event instead of lazily per query
+  void do_bulk_truth_caching(bool b) { _do_bulk_truth_caching = b; }
   
  private:
   unsigned int _ievent = 0;
@@ -110,6 +113,7 @@ class SvtxEvaluator : public SubsysReco
   bool _do_vtx_eval_light = true;
   bool _scan_for_embedded = false;
   bool _scan_for_primaries = false;
+  bool _do_bulk_truth_caching = false;
 
   unsigned int _nlayers_maps = 3;
   unsigned int _nlayers_intt = 4;
@@ -135,6 +139,9 @@ class SvtxEvaluator : public SubsysReco
 
   PHTimer *_timer = nullptr;
 
+  //! total time spent in process_event, reported at End
+  PHTimer *_event_timer = nullptr;
+
   // output subroutines
   void fillOutputNtuples(PHCompositeNode *topNode);  ///< dump the evaluator information into ntuple for external analysis
   void printInputInfo(PHCompositeNode *topNode);     ///< print out the input object information (debugging upstream components)
@@ -35,6 +35,7 @@ class SvtxTrackEval
     _do_cache = do_cache;
     _clustereval.do_caching(do_cache);
   }
+  void do_bulk_caching(bool do_bulk_cache) { _clustereval.do_bulk_caching(do_bulk_cache); }
   void set_strict(bool strict)
   {
     _strict = strict;
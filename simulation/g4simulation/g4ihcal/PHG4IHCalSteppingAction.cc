@@ -92,8 +92,6 @@ PHG4IHCalSteppingAction::~PHG4IHCalSteppingAction()
   // if the last hit was saved, hit is a nullptr pointer which are
   // legal to delete (it results in a no operation)
   delete m_Hit;
-  // since we have a copy in memory of this one - we need to delete it
-  delete m_MapCorrHist;
 }
 
 //____________________________________________________________________________..
@@ -113,13 +111,17 @@ int PHG4IHCalSteppingAction::InitWithNode(PHCompositeNode* topNode)
       gSystem->Exit(1);
     }
     TFile* file = TFile::Open(ihcalmapname.c_str());
-    file->GetObject(m_Params->get_string_param("MapHistoName").c_str(), m_MapCorrHist);
-    if (!m_MapCorrHist)
+    TH2* mapcorrhist = nullptr;
+    file->GetObject(m_Params->get_string_param("MapHistoName").c_str(), mapcorrhist);
+    if (!mapcorrhist)
     {
       std::cout << "ERROR: could not find Histogram " << m_Params->get_string_param("MapHistoName") << " in " << m_Params->get_string_param("MapFileName") << std::endl;
       gSystem->Exit(1);
     }
-    m_MapCorrHist->SetDirectory(nullptr);  // rootism: this needs to be set otherwise histo vanished when closing the file
+    // the same map is used for all tiles, it is copied into a flat grid
+    m_MapCorrGrid.Reset();
+    m_MapCorrGrid.SetMap(0, mapcorrhist);
+    delete mapcorrhist;
     file->Close();
     delete file;
   }
@@ -208,7 +210,7 @@ bool PHG4IHCalSteppingAction::NoHitSteppingAction(const G4Step* aStep)
   if (m_LightScintModelFlag)
   {
     light_yield = GetVisibleEnergyDeposition(aStep);
-    if (m_MapCorrHist)
+    if (m_MapCorrGrid.HasMap(0))
     {
       const G4TouchableHandle& theTouchable = prePoint->GetTouchableHandle();
       const G4ThreeVector& worldPosition = postPoint->GetPosition();
@@ -220,15 +222,8 @@ bool PHG4IHCalSteppingAction::NoHitSteppingAction(const G4Step* aStep)
       int lcx = (int) (5.0 * lx) + 1;
       int lcy = (int) (5.0 * (ly + 2.0)) + 1;
 
-      if ((lcy >= 1) && (lcy <= m_MapCorrHist->GetNbinsY()) &&
-          (lcx >= 1) && (lcx <= m_MapCorrHist->GetNbinsX()))
-      {
-        light_yield *= m_MapCorrHist->GetBinContent(lcx, lcy);
-      }
-      else
-      {
-        light_yield = 0.0;
-      }
+      // outside of the map there is no light
+      light_yield *= m_MapCorrGrid.GetCorrection(0, lcx, lcy);
     }
     else
     {
@@ -239,7 +234,8 @@ bool PHG4IHCalSteppingAction::NoHitSteppingAction(const G4Step* aStep)
   unsigned int ieta = tower_id;
   unsigned int iphi = (unsigned int) layer_id / 4;
   unsigned int tower_key = TowerInfoDefs::encode_hcal(ieta, iphi);
-  m_CaloInfoContainer->get_tower_at_key(tower_key)->set_energy(m_CaloInfoContainer->get_tower_at_key(tower_key)->get_energy() + light_yield);
+  TowerInfo* tower = m_CaloInfoContainer->get_tower_at_key(tower_key);
+  tower->set_energy(tower->get_energy() + light_yield);
   // set keep for the track
   if (light_yield > 0)
   {
@@ -468,7 +464,7 @@ bool PHG4IHCalSteppingAction::UserSteppingAction(const G4Step* aStep, bool /*was
       {
         light_yield = GetVisibleEnergyDeposition(aStep);                         // for scintillator only, calculate light yields
         m_Hit->set_raw_light_yield(m_Hit->get_raw_light_yield() + light_yield);  // save raw Birks light yield
-        if (m_MapCorrHist)
+        if (m_MapCorrGrid.HasMap(0))
         {
           const G4TouchableHandle& theTouchable = prePoint->GetTouchableHandle();
           const G4ThreeVector& worldPosition = postPoint->GetPosition();
@@ -480,15 +476,8 @@ bool PHG4IHCalSteppingAction::UserSteppingAction(const G4Step* aStep, bool /*was
           int lcx = (int) (5.0 * lx) + 1;
           int lcy = (int) (5.0 * (ly + 2.0)) + 1;
 
-          if ((lcy >= 1) && (lcy <= m_MapCorrHist->GetNbinsY()) &&
-              (lcx >= 1) && (lcx <= m_MapCorrHist->GetNbinsX()))
-          {
-            light_yield *= m_MapCorrHist->GetBinContent(lcx, lcy);
-          }
-          else
-          {
-            light_yield = 0.0;
-          }
+          // outside of the map there is no light
+          light_yield *= m_MapCorrGrid.GetCorrection(0, lcx, lcy);
         }
         else
         {
@@ -3,6 +3,8 @@
 #ifndef G4IHCAL_PHG4IHCALSTEPPINGACTION_H
 #define G4IHCAL_PHG4IHCALSTEPPINGACTION_H
 
+#include <g4detectors/PHG4HcalLightCorrectionGrid.h>
+
 #include <g4main/PHG4SteppingAction.h>
 
 #include <string>  // for string
@@ -16,7 +18,6 @@ class PHParameters;
 class PHG4Hit;
 class PHG4HitContainer;
 class PHG4Shower;
-class TH2;
 
 class PHG4IHCalSteppingAction : public PHG4SteppingAction
 {
@@ -44,8 +45,8 @@ class PHG4IHCalSteppingAction : public PHG4SteppingAction
   //! pointer to the detector
   PHG4IHCalDetector *m_Detector{nullptr};
 
-  //! efficiency maps from Mephi
-  TH2 *m_MapCorrHist{nullptr};
+  //! efficiency map from Mephi, the same for all tiles
+  PHG4HcalLightCorrectionGrid m_MapCorrGrid;
 
   //! pointer to hit container
   PHG4HitContainer *m_HitContainer{nullptr};
@@ -25,6 +25,7 @@
 #include <gsl/gsl_randist.h>
 
 #include <cassert>
+#include <chrono>
 #include <iostream>  // for operator<<, basic_ostream, endl
 #include <utility>   // for pair
 
@@ -178,12 +179,29 @@ int Fun4AllDstPileupInputManager::run(const int nevents)
 
   const int min_crossing = m_tmin / m_time_between_crossings;
   const int max_crossing = m_tmax / m_time_between_crossings;
+  double merge_time = 0;
   for (int icrossing = min_crossing; icrossing <= max_crossing; ++icrossing)
   {
     const double crossing_time = m_time_between_crossings * icrossing;
     const int ncollisions = gsl_ran_poisson(m_rng.get(), mu);
+    if (ncollisions > 0)
+    {
+      ++m_ncrossings;
+    }
+
     for (int icollision = 0; icollision < ncollisions; ++icollision)
     {
+      if (m_pool_size > 0)
+      {
+        // merge from background event pool
+        const auto result = mergeFromPool(merger, crossing_time, merge_time);
+        if (result != 0)
+        {
+          return result;
+        }
+        continue;
+      }
+
       // read one event
       const auto result = runOne(1);
       if (result != 0)
@@ -196,10 +214,67 @@ int Fun4AllDstPileupInputManager::run(const int nevents)
       {
         std::cout << "Fun4AllDstPileupInputManager::run - merged background event " << m_ievent_thisfile << " time: " << crossing_time << std::endl;
       }
+      const auto start = std::chrono::steady_clock::now();
       merger.copy_background_event(m_dstNodeInternal.get(), crossing_time);
+      merge_time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
     }
   }
 
+  m_merge_time_total += merge_time;
+  if (Verbosity() > 1)
+  {
+    std::cout << "Fun4AllDstPileupInputManager::run - background merging time: " << merge_time << " ms" << std::endl;
+  }
+
+  return 0;
+}
+
+//_____________________________________________________________________________
+int Fun4AllDstPileupInputManager::mergeFromPool(const Fun4AllDstPileupMerger &merger, double crossing_time, double &merge_time)
+{
+  if (static_cast<int>(m_pool.size()) < m_pool_size)
+  {
+    // read one event
+    const auto result = runOne(1);
+    if (result == 0)
+    {
+      // decode and store in pool
+      auto event = std::make_unique<Fun4AllDstPileupMerger::BackgroundEvent>();
+      if (!Fun4AllDstPileupMerger::decode_background_event(m_dstNodeInternal.get(), *event))
+      {
+        return 0;
+      }
+
+      if (Verbosity() > 0)
+      {
+        std::cout << "Fun4AllDstPileupInputManager::mergeFromPool - merged background event " << m_ievent_thisfile << " time: " << crossing_time << std::endl;
+      }
+      const auto start = std::chrono::steady_clock::now();
+      merger.merge_background_event(*event, crossing_time);
+      merge_time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+      m_pool.push_back(std::move(event));
+      return 0;
+    }
+
+    if (m_pool.empty())
+    {
+      return result;
+    }
+
+    // input exhausted. Keep re-using the events already in the pool
+    std::cout << "Fun4AllDstPileupInputManager::mergeFromPool - input exhausted, background pool size set to " << m_pool.size() << std::endl;
+    m_pool_size = static_cast<int>(m_pool.size());
+  }
+
+  // pick random event from pool
+  const auto index = gsl_rng_uniform_int(m_rng.get(), m_pool.size());
+  if (Verbosity() > 0)
+  {
+    std::cout << "Fun4AllDstPileupInputManager::mergeFromPool - merged pooled background event " << index << " time: " << crossing_time << std::endl;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  merger.merge_background_event(*m_pool[index], crossing_time);
+  merge_time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
   return 0;
 }
 
@@ -315,6 +390,17 @@ void Fun4AllDstPileupInputManager::Print(const std::string &what) const
     std::cout << "PHNodeIOManager print in Fun4AllDstPileupInputManager " << Name() << ":" << std::endl;
     m_IManager->print();
   }
+  if (what == "ALL" || what == "TIMING")
+  {
+    std::cout << "--------------------------------------" << std::endl
+              << std::endl;
+    std::cout << "Background merging in Fun4AllDstPileupInputManager " << Name() << ":" << std::endl;
+    std::cout << "background pool: " << m_pool.size() << "/" << m_pool_size << " events" << std::endl;
+    if (m_ncrossings > 0)
+    {
+      std::cout << "average merging time: " << m_merge_time_total / m_ncrossings << " ms per crossing over " << m_ncrossings << " crossings (file I/O excluded)" << std::endl;
+    }
+  }
   Fun4AllInputManager::Print(what);
   return;
 }
@@ -8,6 +8,8 @@
  * \author Hugo Pereira Da Costa <hugo.pereira-da-costa@cea.fr>
  */
 
+#include "Fun4AllDstPileupMerger.h"
+
 #include <fun4all/Fun4AllInputManager.h>
 #include <fun4all/Fun4AllReturnCodes.h>  // for SYNC_NOOBJECT, SYNC_OK
 
@@ -21,6 +23,7 @@
 #include <memory>
 #include <string>
 #include <utility>  // for pair
+#include <vector>
 
 /*!
  * dedicated input manager that merges single events into "merged" events, containing a trigger event
@@ -66,10 +69,25 @@ class Fun4AllDstPileupInputManager : public Fun4AllInputManager
 
   void setDetectorActiveCrossings(const std::string &name, const int min, const int max);
 
+  /*!
+   * number of background events kept in memory.
+   * Once the pool is full, background events are picked randomly from the pool instead of being read from file,
+   * which avoids re-reading and re-decoding the input for each pile-up collision.
+   * Note that background events are then re-used across merged events.
+   * 0 (default) disables the pool
+   */
+  void setBackgroundPoolSize(int value)
+  {
+    m_pool_size = value;
+  }
+
  private:
   //! loads one event on internal DST node
   int runOne(const int nevents = 0);
 
+  //! merge one background event at a given time, using the background event pool. Time spent merging is added to merge_time (ms)
+  int mergeFromPool(const Fun4AllDstPileupMerger &, double crossing_time, double &merge_time);
+
   //!@name event counters
   //@{
   bool m_ReadRunTTree = true;
@@ -122,6 +140,21 @@ class Fun4AllDstPileupInputManager : public Fun4AllInputManager
   std::unique_ptr<gsl_rng, Deleter> m_rng;
 
   std::map<std::string, std::pair<double, double>> m_DetectorTiming;
+
+  //! max number of decoded background events kept in memory
+  int m_pool_size = 0;
+
+  //! decoded background events
+  std::vector<std::unique_ptr<Fun4AllDstPileupMerger::BackgroundEvent>> m_pool;
+
+  //!@name merging timing, excluding file I/O
+  //@{
+  //! number of crossings in which at least one background event was merged
+  unsigned int m_ncrossings = 0;
+
+  //! total time spent merging background events (ms)
+  double m_merge_time_total = 0;
+  //@}
 };
 
 #endif /* __Fun4AllDstPileupInputManager_H__ */
@@ -374,3 +374,287 @@ void Fun4AllDstPileupMerger::copy_background_event(PHCompositeNode *dstNode, dou
     }
   }
 }
+
+//_____________________________________________________________________________
+bool Fun4AllDstPileupMerger::decode_background_event(PHCompositeNode *dstNode, BackgroundEvent &event)
+{
+  event.genevent.reset();
+  event.primary_vertices.clear();
+  event.secondary_vertices.clear();
+  event.primary_particles.clear();
+  event.secondary_particles.clear();
+  event.hitcontainers.clear();
+  event.vtxid_map.clear();
+  event.trkid_map.clear();
+
+  // copy PHHepMCGenEvent
+  const auto map = findNode::getClass<PHHepMCGenEventMap>(dstNode, "PHHepMCGenEventMap");
+  if (map)
+  {
+    if (map->size() != 1)
+    {
+      std::cout << "Fun4AllDstPileupMerger::decode_background_event - cannot merge events that contain more than one PHHepMCGenEventMap" << std::endl;
+      return false;
+    }
+
+    auto genevent = map->get_map().begin()->second;
+    event.genevent.reset(static_cast<PHHepMCGenEvent *>(genevent->CloneMe()));
+
+    /*
+     * same hack as in copy_background_event:
+     * the internal node is overwritten when the next event is read,
+     * so the decoded event takes ownership of the original GenEvent and leaves the copy behind
+     */
+    event.genevent->getEvent()->swap(*genevent->getEvent());
+  }
+
+  // convert source vertex and track ids into ids relative to the destination containers
+  auto &vtxid_map = event.vtxid_map;
+  auto &trkid_map = event.trkid_map;
+
+  const auto container_truth = findNode::getClass<PHG4TruthInfoContainer>(dstNode, "G4TruthInfo");
+  if (container_truth)
+  {
+    {
+      // primary vertices
+      const auto range = container_truth->GetPrimaryVtxRange();
+      for (auto iter = range.first; iter != range.second; ++iter)
+      {
+        event.primary_vertices.emplace_back(iter->second);
+        const int key = event.primary_vertices.size();
+        event.primary_vertices.back().set_id(key);
+        vtxid_map.insert(std::make_pair(iter->second->get_id(), key));
+      }
+    }
+
+    {
+      // secondary vertices, from last to first to preserve order with respect to the original event
+      const auto range = container_truth->GetSecondaryVtxRange();
+      for (
+          auto iter = std::reverse_iterator<PHG4TruthInfoContainer::ConstVtxIterator>(range.second);
+          iter != std::reverse_iterator<PHG4TruthInfoContainer::ConstVtxIterator>(range.first);
+          ++iter)
+      {
+        event.secondary_vertices.emplace_back(iter->second);
+        const int key = -static_cast<int>(event.secondary_vertices.size());
+        event.secondary_vertices.back().set_id(key);
+        vtxid_map.insert(std::make_pair(iter->second->get_id(), key));
+      }
+    }
+
+    {
+      // primary particles
+      const auto range = container_truth->GetPrimaryParticleRange();
+      for (auto iter = range.first; iter != range.second; ++iter)
+      {
+        const auto &source = iter->second;
+        event.primary_particles.emplace_back(source);
+        auto &dest = event.primary_particles.back();
+
+        const int key = event.primary_particles.size();
+        dest.set_track_id(key);
+        dest.set_parent_id(0);
+        dest.set_primary_id(key);
+        trkid_map.insert(std::make_pair(source->get_track_id(), key));
+      }
+    }
+
+    {
+      /*
+       * secondary particles
+       * loop from last to first to preserve order with respect to the original event
+       * also this ensures that for a given particle its parent has already been converted and thus found in the map
+       */
+      const auto range = container_truth->GetSecondaryParticleRange();
+      for (
+          auto iter = std::reverse_iterator<PHG4TruthInfoContainer::ConstIterator>(range.second);
+          iter != std::reverse_iterator<PHG4TruthInfoContainer::ConstIterator>(range.first);
+          ++iter)
+      {
+        const auto &source = iter->second;
+        event.secondary_particles.emplace_back(source);
+        auto &dest = event.secondary_particles.back();
+
+        const int key = -static_cast<int>(event.secondary_particles.size());
+        dest.set_track_id(key);
+        trkid_map.insert(std::make_pair(source->get_track_id(), key));
+      }
+    }
+  }
+
+  // g4hits
+  FindG4HitContainer nodeFinder;
+  PHNodeIterator(dstNode).forEach(nodeFinder);
+  for (const auto &pair : nodeFinder.containers())
+  {
+    auto &hitcontainer = event.hitcontainers[pair.first];
+
+    {
+      // hits
+      const auto range = pair.second->getHits();
+      hitcontainer.hits.reserve(std::distance(range.first, range.second));
+      for (auto iter = range.first; iter != range.second; ++iter)
+      {
+        hitcontainer.hits.emplace_back(iter->second);
+
+        // reset shower ids, see copy_background_event
+        hitcontainer.hits.back().set_shower_id(std::numeric_limits<int>::min());
+      }
+    }
+
+    {
+      // layers
+      const auto range = pair.second->getLayers();
+      hitcontainer.layers.assign(range.first, range.second);
+    }
+  }
+
+  return true;
+}
+
+//_____________________________________________________________________________
+void Fun4AllDstPileupMerger::merge_background_event(BackgroundEvent &event, double delta_t) const
+{
+  // keep track of new embed id, after insertion as background event
+  int new_embed_id = -1;
+  if (event.genevent && m_geneventmap)
+  {
+    auto newevent = m_geneventmap->insert_background_event(event.genevent.get());
+
+    /*
+     * same hack as in copy_background_event:
+     * the output map gets the GenEvent that was read from file, the decoded event keeps the copy for later re-use
+     */
+    newevent->getEvent()->swap(*event.genevent->getEvent());
+    newevent->moveVertex(0, 0, 0, delta_t);
+    new_embed_id = newevent->get_embedding_id();
+  }
+
+  // destination id offsets
+  int max_vtx_index = 0;
+  int min_vtx_index = 0;
+  int max_trk_index = 0;
+  int min_trk_index = 0;
+
+  // convert relative id into destination id
+  auto vtx_id = [&max_vtx_index, &min_vtx_index](int id)
+  { return id > 0 ? max_vtx_index + id : min_vtx_index + id; };
+
+  auto trk_id = [&max_trk_index, &min_trk_index](int id)
+  { return id > 0 ? max_trk_index + id : min_trk_index + id; };
+
+  // convert source id into destination id. Unresolved ids are kept, as in copy_background_event
+  auto convert = [](const std::map<int, int> &conversion, const auto &to_destination, int id, const char *type)
+  {
+    const auto keyiter = conversion.find(id);
+    if (keyiter != conversion.end())
+    {
+      return to_destination(keyiter->second);
+    }
+
+    std::cout << "Fun4AllDstPileupMerger::merge_background_event - " << type << " id " << id << " not found in map" << std::endl;
+    return id;
+  };
+
+  auto source_vtx_id = [&](int id)
+  { return convert(event.vtxid_map, vtx_id, id, "vertex"); };
+
+  auto source_trk_id = [&](int id)
+  { return convert(event.trkid_map, trk_id, id, "track"); };
+
+  if (m_g4truthinfo)
+  {
+    max_vtx_index = m_g4truthinfo->maxvtxindex();
+    min_vtx_index = m_g4truthinfo->minvtxindex();
+    max_trk_index = m_g4truthinfo->maxtrkindex();
+    min_trk_index = m_g4truthinfo->mintrkindex();
+
+    // vertices
+    for (const auto &source : event.primary_vertices)
+    {
+      auto newVertex = new PHG4VtxPoint_t(source);
+      newVertex->set_t(source.get_t() + delta_t);
+      m_g4truthinfo->AddVertex(vtx_id(source.get_id()), newVertex);
+
+      // embed flag is stored only for primary vertices, consistently with PHG4TruthEventAction
+      m_g4truthinfo->AddEmbededVtxId(newVertex->get_id(), new_embed_id);
+    }
+
+    for (const auto &source : event.secondary_vertices)
+    {
+      auto newVertex = new PHG4VtxPoint_t(source);
+      newVertex->set_t(source.get_t() + delta_t);
+      m_g4truthinfo->AddVertex(vtx_id(source.get_id()), newVertex);
+    }
+
+    // particles
+    for (const auto &source : event.primary_particles)
+    {
+      auto dest = new PHG4Particle_t(source);
+      dest->set_track_id(trk_id(source.get_track_id()));
+      dest->set_primary_id(dest->get_track_id());
+      dest->set_vtx_id(source_vtx_id(source.get_vtx_id()));
+      m_g4truthinfo->AddParticle(dest->get_track_id(), dest);
+
+      // embed flag is stored only for primary tracks, consistently with PHG4TruthEventAction
+      m_g4truthinfo->AddEmbededTrkId(dest->get_track_id(), new_embed_id);
+    }
+
+    for (const auto &source : event.secondary_particles)
+    {
+      auto dest = new PHG4Particle_t(source);
+      dest->set_track_id(trk_id(source.get_track_id()));
+      dest->set_parent_id(source_trk_id(source.get_parent_id()));
+      dest->set_primary_id(source_trk_id(source.get_primary_id()));
+      dest->set_vtx_id(source_vtx_id(source.get_vtx_id()));
+      m_g4truthinfo->AddParticle(dest->get_track_id(), dest);
+    }
+  }
+
+  // copy g4hits
+  for (const auto &pair : m_g4hitscontainers)
+  {
+    // check destination node
+    if (!pair.second)
+    {
+      std::cout << "Fun4AllDstPileupMerger::merge_background_event - invalid destination container " << pair.first << std::endl;
+      continue;
+    }
+
+    // find source container
+    const auto hititer = event.hitcontainers.find(pair.first);
+    if (hititer == event.hitcontainers.end())
+    {
+      std::cout << "Fun4AllDstPileupMerger::merge_background_event - invalid source container " << pair.first << std::endl;
+      continue;
+    }
+
+    // apply special cuts for selected detectors
+    auto detiter = m_DetectorTiming.find(pair.first);
+    if (detiter != m_DetectorTiming.end())
+    {
+      if (delta_t < detiter->second.first || delta_t > detiter->second.second)
+      {
+        continue;
+      }
+    }
+
+    // hits
+    for (const auto &source : hititer->second.hits)
+    {
+      auto newHit = new PHG4Hit_t(&source);
+      newHit->set_t(0, source.get_t(0) + delta_t);
+      newHit->set_t(1, source.get_t(1) + delta_t);
+      newHit->set_trkid(source_trk_id(source.get_trkid()));
+
+      // this will generate a new key for the hit, see copy_background_event
+      pair.second->AddHit(newHit->get_detid(), newHit);
+    }
+
+    // layers
+    for (const auto &layer : hititer->second.layers)
+    {
+      pair.second->AddLayer(layer);
+    }
+  }
+}
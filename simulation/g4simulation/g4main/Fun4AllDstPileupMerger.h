@@ -8,9 +8,17 @@
  * \author Hugo Pereira Da Costa <hugo.pereira-da-costa@cea.fr>
  */
 
+#include "PHG4Hitv1.h"
+#include "PHG4Particlev3.h"
+#include "PHG4VtxPointv1.h"
+
+#include <phhepmc/PHHepMCGenEvent.h>
+
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>  // for pair
+#include <vector>
 
 class PHCompositeNode;
 class PHG4HitContainer;
@@ -37,6 +45,51 @@ class Fun4AllDstPileupMerger final
   //! time-shift and copy content of source nodes to destination
   void copy_background_event(PHCompositeNode *, double delta_t) const;
 
+  /*!
+   * background event decoded once from the source nodes, so that it can be merged many times.
+   * Vertex and track ids are stored relative to the destination containers:
+   * primary vertices and particles count up (> 0) from the destination maximum index,
+   * secondary ones count down (< 0) from the destination minimum index.
+   * References to other vertices and tracks (vertex, parent and primary ids, hit track ids)
+   * keep the source ids and are converted when merging, using the maps below,
+   * so that unresolved ids are kept unchanged, as in copy_background_event.
+   * Shower ids of the hits are already reset
+   */
+  class BackgroundEvent
+  {
+   public:
+    //! hits and layers of one g4hit container
+    struct HitContainer
+    {
+      std::vector<PHG4Hitv1> hits;
+      std::vector<unsigned int> layers;
+    };
+
+    std::unique_ptr<PHHepMCGenEvent> genevent;
+    std::vector<PHG4VtxPointv1> primary_vertices;
+    std::vector<PHG4VtxPointv1> secondary_vertices;
+    std::vector<PHG4Particlev3> primary_particles;
+    std::vector<PHG4Particlev3> secondary_particles;
+
+    //! hit containers, by node name
+    std::map<std::string, HitContainer> hitcontainers;
+
+    //! source to relative vertex id
+    std::map<int, int> vtxid_map;
+
+    //! source to relative track id
+    std::map<int, int> trkid_map;
+  };
+
+  //! decode content of source nodes into background event. Returns false if the event cannot be merged
+  static bool decode_background_event(PHCompositeNode *, BackgroundEvent &);
+
+  /*!
+   * time-shift and copy decoded background event to destination.
+   * The event HepMC GenEvent is swapped with the copy inserted in the destination map, see copy_background_event
+   */
+  void merge_background_event(BackgroundEvent &, double delta_t) const;
+
   void copyDetectorActiveCrossings(const std::map<std::string, std::pair<double, double>> &dmap) { m_DetectorTiming = dmap; }
 
  private:
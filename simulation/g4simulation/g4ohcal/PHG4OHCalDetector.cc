@@ -69,6 +69,7 @@
 #include <filesystem>
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>   // for unique_ptr
 #include <utility>  // for pair, make_pair
 #include <vector>   // for vector, vector<>::iter...
@@ -6,10 +6,10 @@
 #include <g4main/PHG4Detector.h>
 
 #include <limits>
-#include <map>
-#include <set>
 #include <string>  // for string
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 
 class G4AssemblyVolume;
 class G4LogicalVolume;
@@ -76,9 +76,9 @@ class PHG4OHCalDetector : public PHG4Detector
 
   int m_Layer{0};
   std::string m_SuperDetector;
-  std::set<G4LogicalVolume *> m_SteelAbsorberLogVolSet;
-  std::set<G4LogicalVolume *> m_ScintiTileLogVolSet;
-  std::map<G4VPhysicalVolume *, std::tuple<int, int, int>> m_ScintiTilePhysVolMap;
+  std::unordered_set<G4LogicalVolume *> m_SteelAbsorberLogVolSet;
+  std::unordered_set<G4LogicalVolume *> m_ScintiTileLogVolSet;
+  std::unordered_map<G4VPhysicalVolume *, std::tuple<int, int, int>> m_ScintiTilePhysVolMap;
 
   std::string m_GDMPath;
   std::string m_TowerGeomNodeName;
@@ -5,6 +5,7 @@
 // our own headers in alphabetical order
 
 #include <g4detectors/PHG4HcalDefs.h>
+#include <g4detectors/PHG4HcalLightCorrectionGrid.h>
 #include <g4detectors/PHG4StepStatusDecode.h>
 
 #include <phparameter/PHParameters.h>
@@ -110,16 +111,6 @@ PHG4OHCalSteppingAction::~PHG4OHCalSteppingAction()
   // if the last hit was saved, hit is a nullptr pointer which are
   // legal to delete (it results in a no operation)
   delete m_Hit;
-
-  // since we have a copy in memory of this one - we need to delete it
-  for (auto it : m_MapCorrHist)
-  {
-    delete it;
-  }
-  for (int j = 0; j < 4; j++)
-  {
-    delete m_MapCorrHistChim[j];
-  }
 }
 
 int PHG4OHCalSteppingAction::InitWithNode(PHCompositeNode* topNode)
@@ -143,26 +134,36 @@ int PHG4OHCalSteppingAction::InitWithNode(PHCompositeNode* topNode)
     TFile* file = TFile::Open(mappingfilename.c_str());
     std::string Tilehist = m_Params->get_string_param("MapHistoName");
 
+    // the maps are copied into flat grids, the histograms are not needed afterwards
+    m_MapCorrGrid.Reset();
+    m_MapCorrGridChim.Reset();
     for (int i = 0; i < 24; i++)
     {
       std::string str2 = std::to_string(i);
       Tilehist += str2;
-      file->GetObject(Tilehist.c_str(), m_MapCorrHist[i]);
+      TH2* mapcorrhist = nullptr;
+      TH2* mapcorrhistchim = nullptr;
+      file->GetObject(Tilehist.c_str(), mapcorrhist);
       if (i < 4)
       {
         Tilehist += "_chimney";
       }
-      file->GetObject(Tilehist.c_str(), m_MapCorrHistChim[i]);
+      file->GetObject(Tilehist.c_str(), mapcorrhistchim);
       Tilehist = m_Params->get_string_param("MapHistoName");
 
-      if ((!m_MapCorrHist[i]) || (!m_MapCorrHistChim[i]))
+      if ((!mapcorrhist) || (!mapcorrhistchim))
       {
         std::cout << "ERROR: could not find Histogram " << Tilehist << i << " in " << m_Params->get_string_param("MapFileName") << std::endl;
         gSystem->Exit(1);
       }
 
-      m_MapCorrHist[i]->SetDirectory(nullptr);  // rootism: this needs to be set otherwise histo vanished when closing the file
-      m_MapCorrHistChim[i]->SetDirectory(nullptr);
+      m_MapCorrGrid.SetMap(i, mapcorrhist);
+      m_MapCorrGridChim.SetMap(i, mapcorrhistchim);
+      delete mapcorrhist;
+      if (mapcorrhistchim != mapcorrhist)
+      {
+        delete mapcorrhistchim;
+      }
     }
 
     file->Close();
@@ -256,7 +257,7 @@ bool PHG4OHCalSteppingAction::NoHitSteppingAction(const G4Step* aStep)
   if (m_LightScintModelFlag)
   {
     light_yield = GetVisibleEnergyDeposition(aStep);
-    if ((m_MapCorrHistChim[tower_id]) || (m_MapCorrHist[tower_id]))
+    if (m_MapCorrGrid.HasMap(tower_id) || m_MapCorrGridChim.HasMap(tower_id))
     {
       const G4TouchableHandle& theTouchable = prePoint->GetTouchableHandle();
       const G4ThreeVector& worldPosition = postPoint->GetPosition();
@@ -268,30 +269,9 @@ bool PHG4OHCalSteppingAction::NoHitSteppingAction(const G4Step* aStep)
       int lcx = (int) (2.0 * lx) + 1;
       int lcy = (int) (2.0 * (ly + 0.5)) + 1;
 
-      if ((sector_id == 29) || (sector_id == 30) || (sector_id == 31))
-      {
-        if ((lcy >= 1) && (lcy <= m_MapCorrHistChim[tower_id]->GetNbinsY()) &&
-            (lcx >= 1) && (lcx <= m_MapCorrHistChim[tower_id]->GetNbinsX()))
-        {
-          light_yield *= (double) (m_MapCorrHistChim[tower_id]->GetBinContent(lcx, lcy));
-        }
-        else
-        {
-          light_yield = 0.0;
-        }
-      }
-      else
-      {
-        if ((lcy >= 1) && (lcy <= m_MapCorrHist[tower_id]->GetNbinsY()) &&
-            (lcx >= 1) && (lcx <= m_MapCorrHist[tower_id]->GetNbinsX()))
-        {
-          light_yield *= (double) (m_MapCorrHist[tower_id]->GetBinContent(lcx, lcy));
-        }
-        else
-        {
-          light_yield = 0.0;
-        }
-      }
+      // chimney sectors have their own maps, outside of the map there is no light
+      const PHG4HcalLightCorrectionGrid& grid = ((sector_id == 29) || (sector_id == 30) || (sector_id == 31)) ? m_MapCorrGridChim : m_MapCorrGrid;
+      light_yield *= grid.GetCorrection(tower_id, lcx, lcy);
     }
     else
     {
@@ -303,7 +283,8 @@ bool PHG4OHCalSteppingAction::NoHitSteppingAction(const G4Step* aStep)
   unsigned int ieta = tower_id;
   unsigned int iphi = (unsigned int) layer_id / 5;
   unsigned int tower_key = TowerInfoDefs::encode_hcal(ieta, iphi);
-  m_CaloInfoContainer->get_tower_at_key(tower_key)->set_energy(m_CaloInfoContainer->get_tower_at_key(tower_key)->get_energy() + light_yield);
+  TowerInfo* tower = m_CaloInfoContainer->get_tower_at_key(tower_key);
+  tower->set_energy(tower->get_energy() + light_yield);
   // set keep for the track
   if (light_yield > 0)
   {
@@ -538,7 +519,7 @@ bool PHG4OHCalSteppingAction::UserSteppingAction(const G4Step* aStep, bool /*was
       {
         light_yield = GetVisibleEnergyDeposition(aStep);
         m_Hit->set_raw_light_yield(m_Hit->get_raw_light_yield() + light_yield);  // save raw Birks light yield
-        if ((m_MapCorrHistChim[tower_id]) || (m_MapCorrHist[tower_id]))
+        if (m_MapCorrGrid.HasMap(tower_id) || m_MapCorrGridChim.HasMap(tower_id))
         {
           const G4TouchableHandle& theTouchable = prePoint->GetTouchableHandle();
           const G4ThreeVector& worldPosition = postPoint->GetPosition();
@@ -550,30 +531,9 @@ bool PHG4OHCalSteppingAction::UserSteppingAction(const G4Step* aStep, bool /*was
           int lcx = (int) (2.0 * lx) + 1;
           int lcy = (int) (2.0 * (ly + 0.5)) + 1;
 
-          if ((sector_id == 29) || (sector_id == 30) || (sector_id == 31))
-          {
-            if ((lcy >= 1) && (lcy <= m_MapCorrHistChim[tower_id]->GetNbinsY()) &&
-                (lcx >= 1) && (lcx <= m_MapCorrHistChim[tower_id]->GetNbinsX()))
-            {
-              light_yield *= (double) (m_MapCorrHistChim[tower_id]->GetBinContent(lcx, lcy));
-            }
-            else
-            {
-              light_yield = 0.0;
-            }
-          }
-          else
-          {
-            if ((lcy >= 1) && (lcy <= m_MapCorrHist[tower_id]->GetNbinsY()) &&
-                (lcx >= 1) && (lcx <= m_MapCorrHist[tower_id]->GetNbinsX()))
-            {
-              light_yield *= (double) (m_MapCorrHist[tower_id]->GetBinContent(lcx, lcy));
-            }
-            else
-            {
-              light_yield = 0.0;
-            }
-          }
+          // chimney sectors have their own maps, outside of the map there is no light
+          const PHG4HcalLightCorrectionGrid& grid = ((sector_id == 29) || (sector_id == 30) || (sector_id == 31)) ? m_MapCorrGridChim : m_MapCorrGrid;
+          light_yield *= grid.GetCorrection(tower_id, lcx, lcy);
         }
         else
         {
@@ -3,6 +3,8 @@
 #ifndef G4OHCAL_PHG4OHCALSTEPPINGACTION_H
 #define G4OHCAL_PHG4OHCALSTEPPINGACTION_H
 
+#include <g4detectors/PHG4HcalLightCorrectionGrid.h>
+
 #include <g4main/PHG4SteppingAction.h>
 
 #include <string>  // for string
@@ -16,7 +18,6 @@ class PHParameters;
 class PHG4Hit;
 class PHG4HitContainer;
 class PHG4Shower;
-class TH2;
 
 class PHG4OHCalSteppingAction : public PHG4SteppingAction
 {
@@ -46,9 +47,9 @@ class PHG4OHCalSteppingAction : public PHG4SteppingAction
   //! pointer to the detector
   PHG4OHCalDetector *m_Detector{nullptr};
 
-  //! efficiency maps from Mephi
-  TH2 *m_MapCorrHist[24]{0};
-  TH2 *m_MapCorrHistChim[24]{0};
+  //! efficiency maps from Mephi, one per tower (tile in row)
+  PHG4HcalLightCorrectionGrid m_MapCorrGrid;
+  PHG4HcalLightCorrectionGrid m_MapCorrGridChim;
 
   //! pointer to hit container
   PHG4HitContainer *m_HitContainer{nullptr};
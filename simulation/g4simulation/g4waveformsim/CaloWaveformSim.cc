@@ -36,7 +36,10 @@
 #include <TProfile.h>
 #include <TSystem.h>
 #include <TTree.h>
+
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <sstream>
 #include <string>
 
@@ -182,6 +185,24 @@ int CaloWaveformSim::InitRun(PHCompositeNode *topNode)
   // Prepare waveform buffers
   m_waveforms.assign(m_nchannels, std::vector<float>(m_nsamples));
 
+  // the template peak position does not change during the run
+  TF1 *f_peak = new TF1(
+      "f_peak", [this](double *x, double *par)
+      { return this->template_function(x, par); },
+      0, m_nsamples, 3);
+  f_peak->SetParameter(0, 1.0);
+  f_peak->SetParameter(1, 0.0);
+  m_template_peak = f_peak->GetMaximumX();
+  delete f_peak;
+
+  if (m_use_template_table)
+  {
+    build_template_table();
+    m_tower_pulses.assign(m_nchannels, std::vector<std::pair<int, float>>());
+    m_hit_towers.clear();
+    m_hit_towers.reserve(m_nchannels);
+  }
+
   // Create node tree and finish
   CreateNodeTree(topNode);
   return Fun4AllReturnCodes::EVENT_OK;
@@ -229,20 +250,20 @@ int CaloWaveformSim::process_event(PHCompositeNode *topNode)
       sample = 0.;
     }
   }
-  // waveform TH1
-  TF1 *f_fit = new TF1(
-      "f_fit", [this](double *x, double *par)
-      { return this->template_function(x, par); },
-      0, m_nsamples, 3);
-  f_fit->SetParameter(0, 1.0);
-  f_fit->SetParameter(1, 0.0);
-  float template_peak = f_fit->GetMaximumX();
+  // waveform TH1, only needed when the template is evaluated hit by hit
+  TF1 *f_fit = nullptr;
+  if (!m_use_template_table)
+  {
+    f_fit = new TF1(
+        "f_fit", [this](double *x, double *par)
+        { return this->template_function(x, par); },
+        0, m_nsamples, 3);
+  }
+  float template_peak = m_template_peak;
   float shift_of_shift = m_timeshiftwidth * gsl_rng_uniform(m_RandomGenerator);
 
   float _shiftval = m_peakpos + shift_of_shift - template_peak;
 
-  f_fit->SetParameters(1, _shiftval, 0);
-
   // get G4Hits
   std::string nodename = "G4HIT_" + m_detector;
   PHG4HitContainer *hits = findNode::getClass<PHG4HitContainer>(topNode, nodename);
@@ -306,12 +327,21 @@ int CaloWaveformSim::process_event(PHCompositeNode *topNode)
     edepMap[hit->get_hit_id()] += hitEdep;
     showerMap[showerID] += hitEdep;
 
+    if (m_use_template_table)
+    {
+      add_pulse(tower_index, ADC, _shiftval + t0);
+      continue;
+    }
     f_fit->SetParameters(ADC, _shiftval + t0, 0.);
     for (int i = 0; i < m_nsamples; i++)
     {
       m_waveforms.at(tower_index).at(i) += f_fit->Eval(i);
     }
   }
+  if (m_use_template_table)
+  {
+    synthesize_waveforms();
+  }
 
   // do noise here and add to waveform
 
@@ -328,10 +358,9 @@ int CaloWaveformSim::process_event(PHCompositeNode *topNode)
     }
   }
 
+  std::vector<float> m_waveform_pedestal(m_nsamples);
   for (int i = 0; i < m_nchannels; i++)
   {
-    std::vector<float> m_waveform_pedestal;
-    m_waveform_pedestal.resize(m_nsamples);
     if (m_noiseType == NoiseType::NOISE_TREE)
     {
       TowerInfo *pedestal_tower = m_PedestalContainer->get_tower_at_channel(i);
@@ -357,7 +386,7 @@ int CaloWaveformSim::process_event(PHCompositeNode *topNode)
       }
       if (m_noiseType == NoiseType::NOISE_GAUSSIAN)
       {
-        m_waveforms.at(i).at(j) += gsl_ran_gaussian(m_RandomGenerator, m_gaussian_noise);
+        m_waveforms.at(i).at(j) += m_use_template_table ? gsl_ran_gaussian_ziggurat(m_RandomGenerator, m_gaussian_noise) : gsl_ran_gaussian(m_RandomGenerator, m_gaussian_noise);
       }
       if (m_noiseType == NoiseType::NOISE_NONE)
       {
@@ -380,6 +409,100 @@ int CaloWaveformSim::process_event(PHCompositeNode *topNode)
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
+void CaloWaveformSim::build_template_table()
+{
+  // the template is linear between bin centers and constant outside of them (TH1::Interpolate).
+  // Sample it with m_template_table_steps points per sample, starting at the first bin center
+  const int steps = m_template_table_steps;
+  const int nbins = h_template->GetNbinsX();
+  const double xfirst = h_template->GetBinCenter(1);
+  const double xlast = h_template->GetBinCenter(nbins);
+  const int npoints = static_cast<int>(std::ceil((xlast - xfirst) * steps)) + 1;
+  std::vector<float> points(npoints);
+  for (int ipoint = 0; ipoint < npoints; ipoint++)
+  {
+    points[ipoint] = h_template->Interpolate(xfirst + static_cast<double>(ipoint) / steps);
+  }
+
+  // table point k is stored at row k % steps, column k / steps + m_nsamples, so that
+  // the points seen by consecutive samples of one pulse (k, k + steps, k + 2*steps...) are contiguous.
+  // m_nsamples columns of padding on each side hold the constant template edges
+  const int ncolumns = (npoints - 1 + steps - 1) / steps;
+  m_template_table_stride = ncolumns + 2 * m_nsamples;
+  m_template_table_offset = xfirst;
+  m_template_table.assign(static_cast<size_t>(steps) * m_template_table_stride, 0);
+  for (int irow = 0; irow < steps; irow++)
+  {
+    for (int icolumn = 0; icolumn < m_template_table_stride; icolumn++)
+    {
+      int ipoint = std::clamp(irow + steps * (icolumn - m_nsamples), 0, npoints - 1);
+      m_template_table[irow * m_template_table_stride + icolumn] = points[ipoint];
+    }
+  }
+  if (Verbosity() > 0)
+  {
+    std::cout << "CaloWaveformSim::build_template_table " << npoints << " template points, "
+              << steps << " per sample" << std::endl;
+  }
+}
+
+void CaloWaveformSim::add_pulse(unsigned int tower_index, float amplitude, float shift)
+{
+  // table position seen by sample 0, sample i sees position + i * steps.
+  // Splitting the amplitude between the two neighbouring table points reproduces
+  // the linear interpolation of the template, and lets pulses of one tower at
+  // the same table point add up before synthesis
+  const int steps = m_template_table_steps;
+  double position = -(shift + m_template_table_offset) * steps;
+  // pulses far outside of the readout window only see the constant template edges
+  position = std::clamp(position, -(m_nsamples + 2.) * steps, (m_template_table_stride + 2.) * steps);
+  const int k = static_cast<int>(std::floor(position));
+  const float frac = position - k;
+
+  std::vector<std::pair<int, float>> &pulses = m_tower_pulses.at(tower_index);
+  if (pulses.empty())
+  {
+    m_hit_towers.push_back(tower_index);
+  }
+  const std::pair<int, float> points[2] = {{k, amplitude * (1 - frac)}, {k + 1, amplitude * frac}};
+  for (const auto &point : points)
+  {
+    auto iter = std::find_if(pulses.begin(), pulses.end(), [&point](const std::pair<int, float> &pulse)
+                             { return pulse.first == point.first; });
+    if (iter == pulses.end())
+    {
+      pulses.push_back(point);
+    }
+    else
+    {
+      iter->second += point.second;
+    }
+  }
+}
+
+void CaloWaveformSim::synthesize_waveforms()
+{
+  const int steps = m_template_table_steps;
+  for (unsigned int tower_index : m_hit_towers)
+  {
+    float *waveform = m_waveforms[tower_index].data();
+    for (const auto &[k, amplitude] : m_tower_pulses[tower_index])
+    {
+      // row and column of table point k, columns beyond the padding hold the same edge values
+      const int column = (k >= 0) ? k / steps : -((steps - 1 - k) / steps);
+      const int row = k - column * steps;
+      const int first = std::clamp(column + m_nsamples, 0, m_template_table_stride - m_nsamples);
+      const float *table = &m_template_table[row * m_template_table_stride + first];
+      for (int i = 0; i < m_nsamples; i++)
+      {
+        waveform[i] += amplitude * table[i];
+      }
+    }
+    m_tower_pulses[tower_index].clear();
+  }
+  m_hit_towers.clear();
+}
+
 void CaloWaveformSim::maphitetaphi(PHG4Hit *g4hit, unsigned short &etabin, unsigned short &phibin, float &correction)
 {
   if (m_dettype == CaloTowerDefs::CEMC)
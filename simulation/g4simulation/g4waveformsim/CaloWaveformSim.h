@@ -17,6 +17,7 @@
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_rng.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 class PHCompositeNode;
@@ -80,6 +81,12 @@ public:
   void set_nchannels(int nchannels) { m_nchannels = nchannels; }
   void set_sampling_fraction(float fraction) { m_sampling_fraction = fraction; }
 
+  // synthesize the waveforms from a pre-sampled template table once per tower,
+  // instead of evaluating the template TF1 for every hit
+  void set_template_table(bool use = true) { m_use_template_table = use; }
+  // number of template table points per sample
+  void set_template_table_steps(int steps) { m_template_table_steps = steps; }
+
   // Signal shaping parameters
   void set_deltaT(float deltaT) { m_deltaT = deltaT; }
   void set_timewidth(float timewidth) { m_timeshiftwidth = timewidth; }
@@ -139,6 +146,17 @@ private:
   float       m_sampletime{50. / 3.};
   int         m_nchannels{24576};
   float       m_sampling_fraction{1.0f};
+  float       m_template_peak{0};
+
+  // template table synthesis
+  bool               m_use_template_table{false};
+  int                m_template_table_steps{32};
+  int                m_template_table_stride{0};
+  float              m_template_table_offset{0};
+  std::vector<float> m_template_table;
+  // per tower (table index, amplitude) pulses accumulated over the event
+  std::vector<std::vector<std::pair<int, float>>> m_tower_pulses;
+  std::vector<unsigned int> m_hit_towers;
 
   //containers
   TowerInfoContainer *m_CaloWaveformContainer{nullptr};
@@ -176,6 +194,9 @@ private:
                     unsigned short &phibin,
                     float &correction);
   double template_function(double *x, double *par);
+  void build_template_table();
+  void add_pulse(unsigned int tower_index, float amplitude, float shift);
+  void synthesize_waveforms();
 };
 
 #endif  // CALOWAVEFORMSIM_H
\ No newline at end of file